@@ -5,14 +5,16 @@
 DEMO NAME:          benchmark.c
 DEMO WRITTEN BY:    Muukid
 CREATION DATE:      2024-12-19
-LAST UPDATED:       2024-12-19
+LAST UPDATED:       2026-10-16
 
 ============================================================
                         DEMO PURPOSE
 
-This demo tests the performance of rasterization by
-rasterizing a given font at several different sizes with
-several different rasterization methods.
+This demo tests the performance of glyph decoding by
+decoding every simple glyph of a given font, and the
+performance of rasterization by rasterizing the font at
+several different sizes with several different
+rasterization methods.
 
 This demo is dependent on the 'resources' folder within the
 demos folder, and will, upon success, generate several files
@@ -80,41 +82,19 @@ More explicit license information at the end of file.
 	// Max number of glyphs to test each pass
 	#define MAX_GLYPH_COUNT 32
 
+	// Number of times to decode every glyph
+	#define DECODE_PASS_COUNT 100
+
 int main(void)
 {
 	/* Load font */
 	{
-		// Open file in binary
-		FILE* fptr = fopen("resources/font.ttf", "rb");
-		if (!fptr) {
-			printf("Couldn't open 'font.ttf'\n");
-			return -1;
-		}
-
-		// Get size
-		fseek(fptr, 0L, SEEK_END);
-		size_m fptr_size = ftell(fptr);
-		fseek(fptr, 0L, SEEK_SET);
-
-		// Load data into buffer
-		muByte* data = (muByte*)malloc(fptr_size);
-		if (!data) {
-			printf("Couldn't allocate data for loading file\n");
-			fclose(fptr);
-			return -1;
-		}
-		fread(data, fptr_size, 1, fptr);
-
-		// Close file
-		fclose(fptr);
-
-		// Load everything in the font
-		result = mutt_load(data, (uint64_m)fptr_size, &font, MUTT_LOAD_ALL);
-		free(data); // (We no longer need the orig raw data)
+		// Load everything in the font, mapped straight from the file
+		result = mutt_load_file("resources/font.ttf", &font, MUTT_LOAD_ALL);
 
 		// Print if not successful
 		if (result != MUTT_SUCCESS) {
-			printf("'mutt_load' returned non-success value: %s\n", mutt_result_get_name(result));
+			printf("'mutt_load_file' returned non-success value: %s\n", mutt_result_get_name(result));
 			// Exit if result is fatal
 			if (mutt_result_is_fatal(result)) {
 				printf("Result is fatal, exiting...\n");
@@ -133,6 +113,45 @@ int main(void)
 		printf("\n");
 	}
 
+	/* Decode every simple glyph */
+	{
+		// Allocate simple glyph data
+		muByte* sdata = (muByte*)malloc(mutt_simple_glyph_max_size(&font));
+		uint32_m decoded_count = 0;
+
+		uint64_t start = nanotime_now();
+
+		// Decode every glyph several times
+		for (uint32_m p = 0; p < DECODE_PASS_COUNT; ++p) {
+			for (uint32_m g = 0; g < font.maxp->num_glyphs; ++g) {
+				// Get header (skipping composite and empty glyphs)
+				muttGlyphHeader header;
+				result = mutt_glyph_header(&font, (uint16_m)g, &header);
+				if (mutt_result_is_fatal(result) || header.number_of_contours <= 0) {
+					continue;
+				}
+
+				// Decode simple glyph
+				muttSimpleGlyph glyph;
+				result = mutt_simple_glyph(&font, &header, &glyph, sdata, 0);
+				if (!mutt_result_is_fatal(result)) {
+					++decoded_count;
+				}
+			}
+		}
+
+		uint64_t end = nanotime_now();
+		free(sdata);
+
+		// Calculate and print time
+		double decode_time = nanotime_interval(start, end, nanotime_now_max()) / (double)NANOTIME_NSEC_PER_SEC;
+		printf("== Simple glyph decoding ==\n");
+		printf("Decoded %" PRIu32 " simple glyphs in %f seconds\n", decoded_count, decode_time);
+		if (decoded_count != 0) {
+			printf("Average time: %f microseconds per glyph\n\n", (decode_time * 1000000.0) / ((double)decoded_count));
+		}
+	}
+
 	// Allocate rglyph data
 	uint32_m rdata_len = mutt_header_rglyph_max(&font);
 	printf("rdata_len = %" PRIu32 "\n\n", rdata_len);
@@ -0,0 +1,299 @@
+/*
+============================================================
+                        DEMO INFO
+
+DEMO NAME:          cmap_benchmark.c
+DEMO WRITTEN BY:    Muukid
+CREATION DATE:      2026-10-16
+LAST UPDATED:       2026-10-16
+
+============================================================
+                        DEMO PURPOSE
+
+This demo tests the performance of converting codepoints to
+glyph IDs with 'mutt_cmap4_get_glyph' by converting every
+16-bit codepoint several times, both with the format 4
+subtable of a given font and with a generated format 4
+subtable with many segments, and compares it to going
+through each segment one by one (which is how segments used
+to be searched through). It also checks that both give the
+same glyph ID for every codepoint.
+
+This demo is dependent on the 'resources' folder within the
+demos folder.
+
+This demo is also dependent on 'nanotime.h' being in the
+include directory, which is provided in the demos folder.
+
+============================================================
+                        LICENSE INFO
+
+All code is licensed under MIT License or public domain, 
+whichever you prefer.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+/* Including */
+	
+	// Include muTrueType
+	#define MUTT_NAMES // (for name functions)
+	#define MUTT_IMPLEMENTATION
+	#include "muTrueType.h"
+
+	// For getting the time
+	#define NANOTIME_IMPLEMENTATION
+	#include "nanotime.h"
+
+	// For printing and file loading:
+	#include <stdio.h>
+
+	// For allocation:
+	#include <stdlib.h>
+
+/* Global variables */
+
+	// Amount of passes over every codepoint
+	#define PASS_COUNT 20
+
+	// Amount of segments in the generated subtable
+	// (Each segment is 4 codepoints wide with a gap of 2, plus the final 0xFFFF segment)
+	#define GEN_SEGMENT_COUNT 10923
+
+/* Reference search */
+
+	// Searches through each segment one by one
+	uint16_m linear_get_glyph(muttFont* font, muttCmap4* f4, uint16_m codepoint) {
+		for (uint16_m s = 0; s < f4->seg_count; ++s) {
+			muttCmap4Segment* seg = &f4->seg[s];
+			if (codepoint < seg->start_code || codepoint > seg->end_code) {
+				continue;
+			}
+
+			uint16_m glyph;
+			if (seg->id_range_offset_orig == 0) {
+				glyph = mutt_id_delta(codepoint, seg->id_delta);
+			} else {
+				glyph = f4->glyph_ids[seg->id_range_offset+(codepoint-seg->start_code)];
+				if (glyph != 0) {
+					glyph = mutt_id_delta(glyph, seg->id_delta);
+				}
+			}
+			if (glyph != 0 && glyph < font->maxp->num_glyphs) {
+				return glyph;
+			}
+		}
+		return 0;
+	}
+
+/* Benchmarking */
+
+	// Converts every codepoint with both searches, checks that they match, and
+	// prints the time each took; returns 0 if they don't match
+	int benchmark(const char* name, muttFont* font, muttCmap4* f4) {
+		// Check that every codepoint matches
+		uint32_m mapped = 0;
+		for (uint32_m c = 0; c <= 0xFFFF; ++c) {
+			uint16_m a = mutt_cmap4_get_glyph(font, f4, (uint16_m)c);
+			uint16_m b = linear_get_glyph(font, f4, (uint16_m)c);
+			if (a != b) {
+				printf("Codepoint %04X mismatched: %i (search) vs %i (linear)\n", (int)c, (int)a, (int)b);
+				return 0;
+			}
+			mapped += (a != 0);
+		}
+
+		// Time binary search
+		// (The sum is printed so that the calls can't be optimized out)
+		uint64_m sum = 0;
+		uint64_t start = nanotime_now();
+		for (uint32_m p = 0; p < PASS_COUNT; ++p) {
+			for (uint32_m c = 0; c <= 0xFFFF; ++c) {
+				sum += mutt_cmap4_get_glyph(font, f4, (uint16_m)c);
+			}
+		}
+		uint64_t end = nanotime_now();
+		double search_time = nanotime_interval(start, end, nanotime_now_max()) / (double)NANOTIME_NSEC_PER_SEC;
+
+		// Time linear search
+		start = nanotime_now();
+		for (uint32_m p = 0; p < PASS_COUNT; ++p) {
+			for (uint32_m c = 0; c <= 0xFFFF; ++c) {
+				sum += linear_get_glyph(font, f4, (uint16_m)c);
+			}
+		}
+		end = nanotime_now();
+		double linear_time = nanotime_interval(start, end, nanotime_now_max()) / (double)NANOTIME_NSEC_PER_SEC;
+
+		// Print results
+		double lookups = 65536.0 * PASS_COUNT;
+		printf("%s: %i segments, %i codepoints mapped (checksum %llu)\n", name, (int)f4->seg_count, (int)mapped, (unsigned long long)sum);
+		printf("\tlinear search: %8.2f ns/lookup\n", linear_time * 1e9 / lookups);
+		printf("\tbinary search: %8.2f ns/lookup (%.2fx)\n\n", search_time * 1e9 / lookups, linear_time / search_time);
+		return 1;
+	}
+
+int main(void)
+{
+	/* Read font file */
+
+	muByte* file_data;
+	uint64_m file_len;
+	{
+		// Open file
+		FILE* file = fopen("resources/font.ttf", "rb");
+		if (!file) {
+			printf("Failed to open 'resources/font.ttf'\n");
+			return -1;
+		}
+
+		// Get length
+		fseek(file, 0, SEEK_END);
+		file_len = (uint64_m)ftell(file);
+		fseek(file, 0, SEEK_SET);
+
+		// Read data
+		file_data = (muByte*)malloc(file_len);
+		if (!file_data || fread(file_data, file_len, 1, file) != 1) {
+			printf("Failed to read 'resources/font.ttf'\n");
+			fclose(file);
+			free(file_data);
+			return -1;
+		}
+		fclose(file);
+	}
+
+	/* Load font */
+
+	muttFont font;
+	muttResult result = mutt_load(file_data, file_len, &font, MUTT_LOAD_MAXP | MUTT_LOAD_CMAP);
+	if (mutt_result_is_fatal(result)) {
+		printf("Failed to load font: %s\n", mutt_result_get_name(result));
+		free(file_data);
+		return -1;
+	}
+	if (!(font.load_flags & MUTT_LOAD_CMAP)) {
+		printf("Failed to load cmap: %s\n", mutt_result_get_name(font.cmap_res));
+		mutt_deload(&font);
+		free(file_data);
+		return -1;
+	}
+
+	/* Benchmark the font's format 4 subtable */
+
+	muttCmap4* f4 = 0;
+	for (uint16_m r = 0; r < font.cmap->num_tables; ++r) {
+		muttEncodingRecord* record = &font.cmap->encoding_records[r];
+		if (record->format == 4 && !mutt_result_is_fatal(record->result)) {
+			f4 = record->encoding.f4;
+			break;
+		}
+	}
+	if (!f4) {
+		printf("Font has no format 4 subtable\n");
+		mutt_deload(&font);
+		free(file_data);
+		return -1;
+	}
+	if (!benchmark("Font subtable", &font, f4)) {
+		mutt_deload(&font);
+		free(file_data);
+		return -1;
+	}
+
+	/* Benchmark a generated subtable with many segments */
+
+	{
+		// Allocate segments
+		muttCmap4 gen;
+		gen.seg_count = GEN_SEGMENT_COUNT;
+		gen.seg = (muttCmap4Segment*)malloc(sizeof(muttCmap4Segment) * GEN_SEGMENT_COUNT);
+		gen.end_codes = (uint16_m*)malloc(2 * GEN_SEGMENT_COUNT);
+		gen.overlapping = MU_FALSE;
+		gen.glyph_ids = 0;
+		gen.glyph_id_count = 0;
+		if (!gen.seg || !gen.end_codes) {
+			printf("Failed to allocate generated subtable\n");
+			free(gen.seg);
+			free(gen.end_codes);
+			mutt_deload(&font);
+			free(file_data);
+			return -1;
+		}
+
+		// Fill segments, mapping each one onto the glyphs after 0 with idDelta
+		for (uint16_m s = 0; s < GEN_SEGMENT_COUNT; ++s) {
+			muttCmap4Segment* seg = &gen.seg[s];
+			if (s == GEN_SEGMENT_COUNT-1) {
+				seg->start_code = seg->end_code = 0xFFFF;
+			} else {
+				seg->start_code = s * 6;
+				seg->end_code = seg->start_code + 3;
+			}
+			gen.end_codes[s] = seg->end_code;
+			seg->id_delta = (int16_m)(uint16_m)(1 + (s % (font.maxp->num_glyphs - 4)) - seg->start_code);
+			seg->id_range_offset_orig = 0;
+			seg->id_range_offset = 0;
+			seg->start_glyph_id = mutt_id_delta(seg->start_code, seg->id_delta);
+			seg->end_glyph_id = mutt_id_delta(seg->end_code, seg->id_delta);
+		}
+
+		int success = benchmark("Generated subtable", &font, &gen);
+		free(gen.end_codes);
+		free(gen.seg);
+		if (!success) {
+			mutt_deload(&font);
+			free(file_data);
+			return -1;
+		}
+	}
+
+	mutt_deload(&font);
+	free(file_data);
+	printf("Successful\n");
+	return 0;
+}
+
+/*
+------------------------------------------------------------------------------
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2024 Hum
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+------------------------------------------------------------------------------
+*/
+
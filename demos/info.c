@@ -5,7 +5,7 @@
 DEMO NAME:          info.c
 DEMO WRITTEN BY:    Muukid
 CREATION DATE:      2024-08-18
-LAST UPDATED:       2024-08-28
+LAST UPDATED:       2026-10-16
 
 ============================================================
                         DEMO PURPOSE
@@ -93,39 +93,12 @@ int main(void)
 {
 	/* Load font */
 	{
-		// Open font file
-		FILE* fptr = fopen("resources/font.ttf", "rb");
-		if (!fptr) {
-			printf("Couldn't open 'resources/font.ttf'\n");
-			return -1;
-		}
-
-		// Get size
-		fseek(fptr, 0L, SEEK_END);
-		size_m fptr_size = ftell(fptr);
-		fseek(fptr, 0L, SEEK_SET);
-
-		// Allocate data
-		muByte* data = (muByte*)malloc(fptr_size);
-		if (!data) {
-			printf("Insufficient memory to open file\n");
-			fclose(fptr);
-			return -1;
-		}
-
-		// Read data into buffer
-		fread(data, fptr_size, 1, fptr);
-
-		// Close file
-		fclose(fptr);
-
-		// Load font with the data
-		result = mutt_load(data, (uint64_m)fptr_size, &font, MUTT_LOAD_ALL);
-		free(data); // (No longer need original raw data)
+		// Load everything in the font, mapped straight from the file
+		result = mutt_load_file("resources/font.ttf", &font, MUTT_LOAD_ALL);
 
 		// Print if not successful
 		if (result != MUTT_SUCCESS) {
-			printf("'mutt_load' returned non-success value: %s\n", mutt_result_get_name(result));
+			printf("'mutt_load_file' returned non-success value: %s\n", mutt_result_get_name(result));
 			// Exit if result is fatal
 			if (mutt_result_is_fatal(result)) {
 				printf("Result is fatal, exiting...\n");
@@ -0,0 +1,188 @@
+/*
+============================================================
+                        DEMO INFO
+
+DEMO NAME:          load_benchmark.c
+DEMO WRITTEN BY:    Muukid
+CREATION DATE:      2026-10-16
+LAST UPDATED:       2026-10-16
+
+============================================================
+                        DEMO PURPOSE
+
+This demo tests the performance of loading many fonts at
+once by loading a given font several hundred times with
+'mutt_load_batch' across different amounts of threads, and
+prints how many fonts were loaded per second and how well
+that scales with the amount of threads.
+
+This demo is dependent on the 'resources' folder within the
+demos folder.
+
+This demo is also dependent on 'nanotime.h' being in the
+include directory, which is provided in the demos folder.
+
+============================================================
+                        LICENSE INFO
+
+All code is licensed under MIT License or public domain, 
+whichever you prefer.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+/* Including */
+	
+	// Include muTrueType
+	#define MUTT_NAMES // (for name functions)
+	#define MUTT_IMPLEMENTATION
+	#include "muTrueType.h"
+
+	// For getting the time
+	#define NANOTIME_IMPLEMENTATION
+	#include "nanotime.h"
+
+	// For printing and file loading:
+	#include <stdio.h>
+
+	// For allocation:
+	#include <stdlib.h>
+
+/* Global variables */
+
+	// Amount of fonts to load each pass
+	#define FONT_COUNT 400
+
+	// Thread counts to test
+	uint32_m thread_counts[] = {
+		1, 2, 4, 8, 16
+	};
+	#define THREAD_COUNT_COUNT (sizeof(thread_counts) / sizeof(uint32_m))
+
+	// Amount of passes to average over for each thread count
+	#define PASS_COUNT 5
+
+	// Fonts and their info
+	muByte* data[FONT_COUNT];
+	uint64_m datalen[FONT_COUNT];
+	muttFont fonts[FONT_COUNT];
+	muttResult results[FONT_COUNT];
+
+int main(void)
+{
+	/* Read font file */
+
+	muByte* file_data;
+	uint64_m file_len;
+	{
+		// Open file
+		FILE* file = fopen("resources/font.ttf", "rb");
+		if (!file) {
+			printf("Failed to open 'resources/font.ttf'\n");
+			return -1;
+		}
+
+		// Get length
+		fseek(file, 0, SEEK_END);
+		file_len = (uint64_m)ftell(file);
+		fseek(file, 0, SEEK_SET);
+
+		// Read data
+		file_data = (muByte*)malloc(file_len);
+		if (!file_data || fread(file_data, file_len, 1, file) != 1) {
+			printf("Failed to read 'resources/font.ttf'\n");
+			fclose(file);
+			free(file_data);
+			return -1;
+		}
+		fclose(file);
+
+		// Every font in the batch is loaded from the same data
+		for (uint32_m f = 0; f < FONT_COUNT; ++f) {
+			data[f] = file_data;
+			datalen[f] = file_len;
+		}
+		printf("Loading %i copies of 'resources/font.ttf' (%i passes each)\n\n", FONT_COUNT, PASS_COUNT);
+	}
+
+	/* Load fonts with each thread count */
+
+	double single_rate = 0.0;
+	for (uint32_m t = 0; t < THREAD_COUNT_COUNT; ++t) {
+		uint32_m threads = thread_counts[t];
+		double total_time = 0.0;
+
+		for (uint32_m p = 0; p < PASS_COUNT; ++p) {
+			// Load
+			uint64_t start = nanotime_now();
+			mutt_load_batch(FONT_COUNT, data, datalen, fonts, MUTT_LOAD_ALL, results, threads);
+			uint64_t end = nanotime_now();
+			total_time += nanotime_interval(start, end, nanotime_now_max()) / (double)NANOTIME_NSEC_PER_SEC;
+
+			// Check results and deload
+			for (uint32_m f = 0; f < FONT_COUNT; ++f) {
+				if (mutt_result_is_fatal(results[f])) {
+					printf("Font %i failed to load: %s\n", (int)f, mutt_result_get_name(results[f]));
+					free(file_data);
+					return -1;
+				}
+				mutt_deload(&fonts[f]);
+			}
+		}
+
+		// Print fonts per second and scaling compared to one thread
+		double rate = ((double)FONT_COUNT * PASS_COUNT) / total_time;
+		if (t == 0) {
+			single_rate = rate;
+		}
+		printf("%2i thread(s): %10.1f fonts/sec (%.2fx)\n", (int)threads, rate, rate / single_rate);
+	}
+
+	free(file_data);
+	printf("\nSuccessful\n");
+	return 0;
+}
+
+/*
+------------------------------------------------------------------------------
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2024 Hum
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+------------------------------------------------------------------------------
+*/
+
@@ -0,0 +1,230 @@
+/*
+============================================================
+                        DEMO INFO
+
+DEMO NAME:          outline_cache.c
+DEMO WRITTEN BY:    Muukid
+CREATION DATE:      2026-10-16
+LAST UPDATED:       2026-10-16
+
+============================================================
+                        DEMO PURPOSE
+
+This demo tests converting glyphs to rglyphs by glyph ID
+through a font's outline cache, with each glyph given
+exactly as much memory as mutt says it needs (rather than
+one buffer of the maximum size). Every glyph is converted
+twice: once while its outline isn't cached yet (in which
+case it's decoded in the given memory, which can need more
+memory than the rglyph itself), and once from the cache.
+
+This demo is dependent on the 'resources' folder within the
+demos folder.
+
+============================================================
+                        LICENSE INFO
+
+All code is licensed under MIT License or public domain, 
+whichever you prefer.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+/* Including */
+	
+	// Include muTrueType
+	#define MUTT_NAMES // (for name functions)
+	#define MUTT_IMPLEMENTATION
+	#include "muTrueType.h"
+
+	// For printing:
+	#include <stdio.h>
+
+	// For print types:
+	#include <inttypes.h>
+
+	// For allocation:
+	#include <stdlib.h>
+
+/* Global variables */
+	
+	// Font information holder
+	muttFont font;
+
+	// Result value
+	muttResult result = MUTT_SUCCESS;
+
+	// Point size of rasterization
+	float point_size = 100.f;
+	// PPI of display for rasterization
+	float PPI = 96.f;
+
+	// Budget of the outline cache, in bytes
+	uint64_m cache_budget = 4 << 20;
+
+/* Functions */
+
+	// Converts a glyph to an rglyph with exactly as much memory as needed,
+	// adding the amount of memory used to "total"; returns if successful
+	muBool convert_glyph(uint16_m g, uint64_m* total) {
+		// Get memory needed
+		muttRGlyph glyph;
+		uint32_m size;
+		result = mutt_glyph_rglyph(&font, g, &glyph, point_size, PPI, 0, &size);
+		if (mutt_result_is_fatal(result)) {
+			printf("%" PRIu16 " (rglyph size) - %s\n", g, mutt_result_get_name(result));
+			return MU_FALSE;
+		}
+
+		// Allocate exactly that much
+		muByte* data = (muByte*)malloc(size);
+		if (!data) {
+			printf("%" PRIu16 " - failed to allocate %" PRIu32 " bytes\n", g, size);
+			return MU_FALSE;
+		}
+
+		// Convert
+		uint32_m written;
+		result = mutt_glyph_rglyph(&font, g, &glyph, point_size, PPI, data, &written);
+		free(data);
+		if (mutt_result_is_fatal(result)) {
+			printf("%" PRIu16 " (rglyph) - %s\n", g, mutt_result_get_name(result));
+			return MU_FALSE;
+		}
+		// - Memory written should never be more than asked for
+		if (written > size) {
+			printf("%" PRIu16 " - wrote %" PRIu32 " bytes into %" PRIu32 " bytes\n", g, written, size);
+			return MU_FALSE;
+		}
+
+		*total += size;
+		return MU_TRUE;
+	}
+
+int main(void)
+{
+	/* Load font */
+	{
+		// Load everything in the font, mapped straight from the file
+		result = mutt_load_file("resources/font.ttf", &font, MUTT_LOAD_ALL);
+
+		// Print if not successful
+		if (result != MUTT_SUCCESS) {
+			printf("'mutt_load_file' returned non-success value: %s\n", mutt_result_get_name(result));
+			// Exit if result is fatal
+			if (mutt_result_is_fatal(result)) {
+				printf("Result is fatal, exiting...\n");
+				return -1;
+			}
+		}
+		printf("Successfully loaded font file 'resources/font.ttf'\n\n");
+	}
+
+	/* Create outline cache */
+	{
+		result = mutt_outline_cache_create(&font, cache_budget);
+		if (mutt_result_is_fatal(result)) {
+			printf("'mutt_outline_cache_create' returned fatal value: %s\n", mutt_result_get_name(result));
+			mutt_deload(&font);
+			return -1;
+		}
+	}
+
+	/* Convert every glyph twice */
+	{
+		uint32_m max_size = mutt_header_rglyph_max(&font);
+		uint32_m glyphs = 0;
+		uint32_m failed = 0;
+		// (Memory given for each pass, and memory the rglyphs alone need)
+		uint64_m total = 0, cached_total = 0;
+		uint64_m rglyph_total = 0;
+
+		for (uint32_m pass = 0; pass < 2; ++pass) {
+			for (uint16_m g = 0; g < font.maxp->num_glyphs; ++g) {
+				// Skip glyphs with no outline
+				muttGlyphHeader header;
+				result = mutt_glyph_header(&font, g, &header);
+				if (mutt_result_is_fatal(result) || header.number_of_contours == 0) {
+					continue;
+				}
+
+				if (pass == 0) {
+					++glyphs;
+					// Add memory the rglyph alone needs
+					muttRGlyph glyph;
+					uint32_m size;
+					result = mutt_header_rglyph(&font, &header, &glyph, point_size, PPI, 0, &size);
+					if (!mutt_result_is_fatal(result)) {
+						rglyph_total += size;
+					}
+				}
+				if (!convert_glyph(g, (pass == 0) ?(&total) :(&cached_total))) {
+					++failed;
+				}
+			}
+		}
+
+		// Print how much memory exact sizing used compared to the maximum
+		printf("Converted %" PRIu32 " glyphs twice (%" PRIu32 " failures)\n", glyphs, failed);
+		printf("mutt_header_rglyph_max = %" PRIu32 " bytes\n", max_size);
+		printf("Rglyphs alone: average of %f bytes per glyph\n", ((double)rglyph_total) / ((double)glyphs));
+		printf("Exact sizes: average of %f bytes per glyph (%f%% of maximum)\n",
+			((double)total) / ((double)glyphs), (((double)total) / ((double)glyphs)) / ((double)max_size) * 100.0
+		);
+		// - Whether or not a glyph is cached shouldn't change how much memory it needs
+		if (cached_total != total) {
+			printf("Cached pass needed %" PRIu64 " bytes rather than %" PRIu64 "\n", cached_total, total);
+		}
+		printf("\n");
+	}
+
+	/* Deload font */
+	{
+		mutt_deload(&font);
+		printf("Successful\n");
+	}
+}
+
+/*
+------------------------------------------------------------------------------
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2024 Hum
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+------------------------------------------------------------------------------
+*/
+
@@ -5,7 +5,7 @@
 DEMO NAME:          raster.c
 DEMO WRITTEN BY:    Muukid
 CREATION DATE:      2024-09-04
-LAST UPDATED:       2024-09-09
+LAST UPDATED:       2026-10-16
 
 ============================================================
                         DEMO PURPOSE
@@ -82,37 +82,12 @@ int main(void)
 {
 	/* Load font */
 	{
-		// Open file in binary
-		FILE* fptr = fopen("resources/font.ttf", "rb");
-		if (!fptr) {
-			printf("Couldn't open 'font.ttf'\n");
-			return -1;
-		}
-
-		// Get size
-		fseek(fptr, 0L, SEEK_END);
-		size_m fptr_size = ftell(fptr);
-		fseek(fptr, 0L, SEEK_SET);
-
-		// Load data into buffer
-		muByte* data = (muByte*)malloc(fptr_size);
-		if (!data) {
-			printf("Couldn't allocate data for loading file\n");
-			fclose(fptr);
-			return -1;
-		}
-		fread(data, fptr_size, 1, fptr);
-
-		// Close file
-		fclose(fptr);
-
-		// Load everything in the font
-		result = mutt_load(data, (uint64_m)fptr_size, &font, MUTT_LOAD_ALL);
-		free(data); // (We no longer need the original raw data)
+		// Load everything in the font, mapped straight from the file
+		result = mutt_load_file("resources/font.ttf", &font, MUTT_LOAD_ALL);
 
 		// Print if not successful
 		if (result != MUTT_SUCCESS) {
-			printf("'mutt_load' returned non-success value: %s\n", mutt_result_get_name(result));
+			printf("'mutt_load_file' returned non-success value: %s\n", mutt_result_get_name(result));
 			// Exit if result is fatal
 			if (mutt_result_is_fatal(result)) {
 				printf("Result is fatal, exiting...\n");
@@ -98,7 +98,7 @@ mutt is developed primarily off of these sources of documentation:
 
 #ifndef MUTT_H
 	#define MUTT_H
-	
+
 	// @DOCLINE # Other library dependencies
 		// @DOCLINE mutt has a dependency on:
 		
@@ -886,14 +886,76 @@ mutt is developed primarily off of these sources of documentation:
 
 			// @DOCLINE If the result returned by mutt is fatal, the contents of `font` are undefined. If the result returned by mutt isn't fatal, the font has been successfully loaded, and must be deloaded at some point.
 
-			// @DOCLINE Once this function has finished executing, there are no internal dependencies on the pointer to the data given, and can be safely freed.
+			// @DOCLINE Once this function has finished executing, there are no internal dependencies on the pointer to the data given, and can be safely freed, unless the [borrow load mode](#font-load-modes) is used.
+
+		// @DOCLINE ## Loading a font file
+
+			// @DOCLINE A TrueType font can also be loaded directly from a file path using the function `mutt_load_file`, defined below: @NLNT
+			MUDEF muttResult mutt_load_file(const char* path, muttFont* font, muttLoadFlags load_flags);
+
+			// @DOCLINE `path` is the path to the font file, and `font` and `load_flags` are the same as in [`mutt_load`](#loading-a-font).
+
+			// @DOCLINE Rather than reading the file into a buffer, this function maps the file into memory read-only and loads the font from the mapping with the [borrow load mode](#font-load-modes) implied, meaning that only the pages of the file that are actually used get read from disk, and the pages are shared with every other process that maps the same file. The table directory and the cmap table are hinted to be read sequentially, and the glyf and loca tables are hinted to be accessed randomly.
+
+			// @DOCLINE Verifying table checksums reads every byte of every table, including the entire glyf table, which defeats reading only the pages that are used; because of this, it's recommended to load font files with [`MUTT_LOAD_SKIP_CHECKSUMS`](#font-load-modes) when the font is trusted, in which case the glyf and loca tables are hinted to be accessed randomly before the font is loaded rather than after.
+
+			// @DOCLINE On POSIX systems, the hints are given with `posix_madvise`, which is only used if `<sys/mman.h>` declares it; strict ISO C modes (such as `-std=c99`) hide it unless a feature-test macro such as `_POSIX_C_SOURCE` is defined as `200112L` or greater before any header is included, which mutt leaves to the user. Without it, the file is mapped the same way, just without the hints.
+
+			// @DOCLINE The mapping is owned by the font, and is unmapped by `mutt_deload`. The file should not be modified while the font is loaded.
+
+			// @DOCLINE > File mapping is implemented for Windows and POSIX systems; on other systems, this function returns `MUTT_FAILED_MAP_FILE`.
+
+		// @DOCLINE ## Loading a font stream
+
+			// @DOCLINE A TrueType font can also be loaded without having the entire font in memory by reading it through a callback, which is useful for fonts that are very large or stored somewhere that can only be read in parts (such as archives). The callback is of type `muttReadFunction`, defined below: @NLNT
+			typedef muBool (*muttReadFunction)(void* user, uint64_m offset, muByte* buffer, uint32_m length);
+
+			// @DOCLINE The callback should read `length` bytes starting at byte offset `offset` of the font into `buffer`, returning `MU_TRUE` if it was able to do so, and `MU_FALSE` if it wasn't. mutt never asks for bytes out of range of the font. `user` is the user pointer given when loading the font.
+
+			// @DOCLINE A font is loaded through a callback with the function `mutt_load_stream`, defined below: @NLNT
+			MUDEF muttResult mutt_load_stream(muttReadFunction read, void* user, uint64_m datalen, muttFont* font, muttLoadFlags load_flags);
+
+			// @DOCLINE `read` is the callback, `user` is the user pointer given to it, `datalen` is the length of the font in bytes, and `font` and `load_flags` are the same as in [`mutt_load`](#loading-a-font). `read` and `user` must stay valid until the font is deloaded.
+
+			// @DOCLINE Only the table directory and the requested tables other than glyf are read while loading, and each table is read directly into a temporary buffer that is freed once the table is parsed. The glyf table is never read as a whole; instead, the data of each glyph is read when its [header is retrieved](#get-glyph-header), through a page cache that holds the most recently read parts of the glyf table. This means that the memory used by a streamed font is bounded by its parsed tables, the page cache, and the glyphs currently being processed, rather than the size of the font file.
+
+			// @DOCLINE The page cache holds `MUTT_STREAM_PAGE_COUNT` pages of `MUTT_STREAM_PAGE_SIZE` bytes each (64 pages of 16384 bytes by default); both can be defined before the implementation is included to change them.
+
+			// @DOCLINE Tables that weren't requested can still be [required](#requiring-tables) later, in which case they are read through the callback, and `MUTT_LOAD_LAZY` can be used as well. `MUTT_LOAD_BORROW` is ignored, as there is no data to borrow. Since table checksums can't be verified from the directory alone, the checksum of each table is instead verified when the table is read (unless `MUTT_LOAD_SKIP_CHECKSUMS` is used); the checksum of the glyf table isn't verified, as it's never read as a whole.
+
+			// @DOCLINE > The glyph data of a streamed font is only valid until the next call to `mutt_glyph_header` with the same font, so a glyph should be fully processed before retrieving the header of another glyph, and the glyph functions of a streamed font shouldn't be used by multiple threads at the same time.
+
+		// @DOCLINE ## Loading fonts in parallel
+
+			// @DOCLINE Several fonts can be loaded at once across multiple threads using the function `mutt_load_batch`, defined below: @NLNT
+			MUDEF void mutt_load_batch(uint32_m count, muByte** data, uint64_m* datalen, muttFont* fonts, muttLoadFlags load_flags, muttResult* results, uint32_m threads);
+
+			// @DOCLINE `count` is the amount of fonts to load, and `data`, `datalen`, `fonts`, and `results` are arrays of length `count`, where font `i` is loaded from `data[i]` and `datalen[i]` into `fonts[i]`, and the result of loading it is written to `results[i]`. `load_flags` is used for every font, and is the same as in [`mutt_load`](#loading-a-font). `threads` is the amount of threads to load with, including the calling thread; if it's 0, the amount of processors on the system is used.
+
+			// @DOCLINE Fonts can also be loaded at once from file paths using the function `mutt_load_file_batch`, defined below: @NLNT
+			MUDEF void mutt_load_file_batch(uint32_m count, const char** paths, muttFont* fonts, muttLoadFlags load_flags, muttResult* results, uint32_m threads);
+
+			// @DOCLINE `paths` is an array of length `count`, where font `i` is loaded from `paths[i]` as if by [`mutt_load_file`](#loading-a-font-file), and the other parameters are the same as in `mutt_load_batch`.
+
+			// @DOCLINE Each thread takes the next font that hasn't been loaded yet until every font is loaded, so fonts that take longer to load don't hold up the others. Both functions return once every font has been loaded, and each font whose result isn't fatal must be deloaded like any other font. The amount of threads is capped at `MUTT_BATCH_MAX_THREADS` (64 by default), which can be defined before the implementation is included to change it.
+
+			// @DOCLINE > Threads are implemented for Windows and POSIX systems (POSIX systems may need to link with pthreads); on other systems, or if a thread can't be created, the fonts are loaded on the calling thread instead.
 
 		// @DOCLINE ## Deloading a font
 
 			// @DOCLINE To deload a font, the function `mutt_deload` is used, defined below: @NLNT
 			MUDEF void mutt_deload(muttFont* font);
 
-			// @DOCLINE This function must be called on every successfully loaded font at some point. The contents of `font` are undefined after `mutt_deload` has been called on it.
+			// @DOCLINE This function must be called on every successfully loaded font at some point. The contents of `font` are undefined after `mutt_deload` has been called on it. If the font was loaded with [`mutt_load_file`](#loading-a-font-file), this function also unmaps the file.
+
+		// @DOCLINE ## Reloading a font
+
+			// @DOCLINE A loaded font can be replaced with another font using the function `mutt_reload`, defined below: @NLNT
+			MUDEF muttResult mutt_reload(muttFont* font, muByte* data, uint64_m datalen, muttLoadFlags load_flags);
+
+			// @DOCLINE `font` must be a successfully loaded font (that isn't a [face of a collection](#font-collections)), and `data`, `datalen`, and `load_flags` are the same as in [`mutt_load`](#loading-a-font). This function is equivalent to calling `mutt_deload` on the font and then `mutt_load` with the given parameters, except that the font's table memory is kept and reused for the new font's tables if it's large enough (and is only reallocated if it isn't), meaning that switching between fonts of similar sizes doesn't allocate or free any memory. The old font's data (and anything retrieved from the old font) can be freed once this function is called.
+
+			// @DOCLINE Like `mutt_load`, if the result returned is fatal, the contents of `font` are undefined, and the font doesn't need to be deloaded; if it isn't fatal, the font has been successfully loaded, and must be deloaded (or reloaded) at some point.
 
 		// @DOCLINE ## Font load flags
 
@@ -927,8 +989,254 @@ mutt is developed primarily off of these sources of documentation:
 				// @DOCLINE * [0x000001FF] `MUTT_LOAD_REQUIRED` - load the tables required by the TrueType specification (maxp, head, hhea, hmtx, loca, post, name, glyf, and cmap).
 				#define MUTT_LOAD_REQUIRED 0x000001FF
 
-				// @DOCLINE * [0xFFFFFFFF] `MUTT_LOAD_ALL` - loads all tables that could be supported by mutt.
-				#define MUTT_LOAD_ALL 0xFFFFFFFF
+				// @DOCLINE * [0x0000FFFF] `MUTT_LOAD_ALL` - loads all tables that could be supported by mutt.
+				#define MUTT_LOAD_ALL 0x0000FFFF
+
+			// @DOCLINE ### Font load modes
+
+				// @DOCLINE The upper 16 bits of `muttLoadFlags` are reserved for flags that change *how* tables are loaded rather than *which* tables are loaded. These can be combined with any table flags or flag groups, and are never set by a flag group. The defined mode flags are:
+
+				// @DOCLINE * [0x00010000] `MUTT_LOAD_BORROW` - rather than copying table data that can be used as-is (such as the glyf table and the name table's string storage), the font points directly into the data given to `mutt_load`. When this flag is specified, the user guarantees that the data stays valid and unmodified until `mutt_deload` is called on the font.
+				#define MUTT_LOAD_BORROW 0x00010000
+
+				// @DOCLINE * [0x00020000] `MUTT_LOAD_LAZY` - only the table directory is loaded by `mutt_load`; each table is instead loaded the first time that it is [required](#requiring-tables). This flag implies `MUTT_LOAD_BORROW`, as the data needs to be around for tables to be loaded later on.
+				#define MUTT_LOAD_LAZY 0x00020000
+
+				// @DOCLINE * [0x00040000] `MUTT_LOAD_SKIP_CHECKSUMS` - the checksum of each table in the table directory isn't verified. Verifying checksums reads every byte of every table in the font, which is most of the cost of loading large fonts, so this is useful for fonts that are already known to be valid, such as fonts shipped with a program or previously validated fonts.
+				#define MUTT_LOAD_SKIP_CHECKSUMS 0x00040000
+
+				// @DOCLINE * [0x00080000] `MUTT_LOAD_COMPACT` - the hmtx and loca tables are kept in their raw big-endian form rather than being expanded into arrays, and each entry is instead decoded when it's used, which is done through [`mutt_glyph_advance`, `mutt_glyph_lsb`](#glyph-metrics), and [`mutt_loca_offset`](#glyph-offsets). The loca offsets are still verified when the table is loaded. This is mainly useful along with `MUTT_LOAD_BORROW` (or [`mutt_load_file`](#loading-a-font-file)), in which case the tables point directly into the font data and take up no memory of their own, which can save hundreds of kilobytes per font for fonts with many glyphs; without it, the raw tables are copied, which takes about as much memory as the expanded arrays.
+				#define MUTT_LOAD_COMPACT 0x00080000
+
+				// @DOCLINE * [0x00100000] `MUTT_LOAD_DENSE` - the hmtx table is expanded into two arrays indexed directly by glyph ID, `hmtx->advances` and `hmtx->lsbs`, rather than `hmtx->hmetrics` and `hmtx->left_side_bearings`, meaning that looking up the metrics of a glyph never branches on whether or not the glyph is past the end of hMetrics. This takes slightly more memory than the default layout (4 bytes per glyph), and takes priority over `MUTT_LOAD_COMPACT` for the hmtx table.
+				#define MUTT_LOAD_DENSE 0x00100000
+
+				// @DOCLINE * [0x00200000] `MUTT_LOAD_TRUSTED` - the glyphs of the font are trusted to be valid, so glyph headers and simple glyphs are decoded without verifying them against the TrueType specification or other tables (such as maxp and head), which is done by [`mutt_glyph_header`](#glyph-header), [`mutt_simple_glyph`](#load-simple-glyph), [`mutt_simple_header_rglyph`](#simple-glyph-header-to-rglyph), and everything that uses them. Using this flag with a font that isn't valid is undefined behavior; it's meant for fonts that have already been validated, such as fonts shipped with a program. Fonts that aren't known to be valid can rather be validated once with [`mutt_font_trust`](#trusting-a-font), after which each glyph that was found to be valid is decoded the same way.
+				#define MUTT_LOAD_TRUSTED 0x00200000
+
+		// @DOCLINE ## Requiring tables
+
+			// @DOCLINE Tables that weren't loaded by `mutt_load`, either because the font was loaded with `MUTT_LOAD_LAZY` or because they weren't specified in the load flags, can be loaded on demand using the function `mutt_font_require`, defined below: @NLNT
+			MUDEF muttResult mutt_font_require(muttFont* font, muttLoadFlags tables);
+
+			// @DOCLINE `tables` is a set of [table load flags](#font-load-flags) indicating the tables that need to be loaded. Any of these tables (and the tables they depend on) that haven't been attempted to be loaded yet are loaded, and tables that have already been attempted are left alone, meaning that after the first call, requiring a table that was loaded successfully is nearly free (and doesn't take any lock). This function is thread-safe; if multiple threads require the same table at once, the table is only loaded once, and every thread waits for it to be loaded.
+
+			// @DOCLINE This function returns `MUTT_SUCCESS` if all of the tables in `tables` are loaded, and otherwise returns the load result of the first table in `tables` that isn't loaded (in the order that the table flags are defined), or `MUTT_FAILED_FIND_TABLE` if it was never attempted to be loaded.
+
+			// @DOCLINE Tables can only be loaded after `mutt_load` if the font still has access to its data, which is only the case if the font was loaded with `MUTT_LOAD_BORROW` or `MUTT_LOAD_LAZY` (or with [`mutt_load_file`](#loading-a-font-file)); for other fonts, tables not loaded by `mutt_load` can't be required.
+
+			// @DOCLINE > When a font is loaded lazily, the rest of the mutt API assumes that every table that it uses has been required beforehand; for example, `mutt_glyph_header` assumes that maxp, head, loca, and glyf are loaded. The members `load_flags`, `fail_load_flags`, and each table's pointer and result should only be read for tables that have already been required.
+
+		// @DOCLINE ## Font caches
+
+			// @DOCLINE Loading a font parses every requested table, which includes expanding loca, hmtx, and cmap subtables, and reading name records. A program that loads the same fonts every time it starts can skip this by saving the parsed font as a cache once, and then loading the cache instead of the font afterwards.
+
+			// @DOCLINE ### Serializing a font
+
+				// @DOCLINE To save a loaded font as a cache, the [user-allocated function](#user-allocated-functions) `mutt_font_serialize` is used, defined below: @NLNT
+				MUDEF muttResult mutt_font_serialize(muttFont* font, muByte* data, uint32_m* written);
+
+				// @DOCLINE The cache holds the font's directory and every loaded table as a flat, position-independent blob, where pointers are stored as offsets along with a list of where each pointer is. Data that the font borrows (such as the glyf table and name strings of a font loaded with [`MUTT_LOAD_BORROW`](#font-load-modes) or [`mutt_load_file`](#loading-a-font-file)) isn't copied into the cache, and is instead referenced by its offset within the font data, meaning that the font data is needed to load the cache; data that the font owns is copied into the cache, so a cache of a font that doesn't borrow anything is self-contained. The glyf table of a [streamed font](#loading-a-font-stream) is never in memory, so it is left out of the cache, and can be required once the cache is loaded with the font data.
+
+				// @DOCLINE The cache also stores a checksum of the font's table directory (which includes the checksum and location of every table) and the length of the font data, which are used to make sure that the font data given when loading the cache is the font data that the cache was made from.
+
+			// @DOCLINE ### Loading a cache
+
+				// @DOCLINE To load a font from a cache, the function `mutt_font_load_cache` is used, defined below: @NLNT
+				MUDEF muttResult mutt_font_load_cache(muByte* cache, uint64_m cachelen, muByte* data, uint64_m datalen, muttFont* font);
+
+				// @DOCLINE `cache` and `cachelen` are the cache created by `mutt_font_serialize`, `data` and `datalen` are the data of the font that the cache was made from (which can be 0 if the cache is self-contained), and `font` is the font to be filled in. No table is parsed; the cache is copied into a single allocation made for the font, and each pointer within it is adjusted to where the cache and font data are. If `data` is given, the font is loaded with the [borrow load mode](#font-load-modes), so `data` must stay valid until the font is deloaded, and tables not in the cache can still be [required](#requiring-tables). The cache itself can be freed (or unmapped) once this function returns.
+
+				// @DOCLINE The font is deloaded with `mutt_deload` like any other font.
+
+				// @DOCLINE > Caches are only valid for the same version of mutt compiled for the same platform (caches store native structs and pointer sizes), which is checked when loading; a cache from a different version or platform gives `MUTT_INVALID_CACHE_VERSION`, in which case the font should be loaded normally and the cache recreated. The contents of a cache are otherwise trusted, so caches should only be loaded if they were created by mutt.
+
+		// @DOCLINE ## Font collections
+
+			typedef struct muttCollectionFace muttCollectionFace;
+			typedef struct muttSharedTable muttSharedTable;
+			typedef struct muttCollection muttCollection;
+
+			// @DOCLINE A TrueType collection (usually a file with the extension ".ttc") holds several fonts (called "faces") in one file, and faces can share tables with each other (commonly glyf, loca, and cmap) to save space. A collection is represented by the struct `muttCollection`, which has the following members:
+
+			struct muttCollection {
+				// @DOCLINE * `@NLFT num_faces` - the amount of faces within the collection; equivalent to "numFonts" in the TTC header.
+				uint32_m num_faces;
+				// @DOCLINE * `@NLFT major_version` - equivalent to "majorVersion" in the TTC header.
+				uint16_m major_version;
+				// @DOCLINE * `@NLFT minor_version` - equivalent to "minorVersion" in the TTC header.
+				uint16_m minor_version;
+				// @DOCLINE * `@NLFT load_flags` - the load flags that each face is loaded with.
+				muttLoadFlags load_flags;
+
+				// @DOCLINE * `@NLFT* data` - the collection file data.
+				muByte* data;
+				// @DOCLINE * `@NLFT datalen` - the length of `data`, in bytes.
+				uint64_m datalen;
+				// @DOCLINE * `@NLFT* file_data` - the memory-mapped contents of the collection file if the collection was loaded with `mutt_collection_load_file`; 0 otherwise.
+				muByte* file_data;
+				// @DOCLINE * `@NLFT file_len` - the length of `file_data`, in bytes.
+				uint64_m file_len;
+
+				// @DOCLINE * `@NLFT* faces` - the state of each face. This is used internally by mutt, and should only be modified by mutt.
+				muttCollectionFace* faces;
+				// @DOCLINE * `@NLFT* shared` - the tables loaded by faces, which other faces can share. This is used internally by mutt, and should only be modified by mutt.
+				muttSharedTable* shared;
+				// @DOCLINE * `@NLFT lock` - a lock used to load and release faces thread-safely. This is used internally by mutt, and should only be modified by mutt.
+				uint32_m lock;
+			};
+
+			// @DOCLINE ### Loading a collection
+
+				// @DOCLINE To load a collection, the function `mutt_collection_load` is used, defined below: @NLNT
+				MUDEF muttResult mutt_collection_load(muByte* data, uint64_m datalen, muttCollection* collection, muttLoadFlags load_flags);
+
+				// @DOCLINE `data` and `datalen` should be the raw binary data of the collection file, `collection` is the collection struct to be filled in, and `load_flags` are the [load flags](#font-load-flags) that each face is loaded with. This function only reads the TTC header; faces are loaded when they are first retrieved via [`mutt_collection_face`](#retrieving-a-face). The data of a regular (non-collection) font file is also accepted, and is treated as a collection with a single face.
+
+				// @DOCLINE Faces are always loaded with the [borrow load mode](#font-load-modes), so `data` must stay valid until the collection is deloaded. `MUTT_LOAD_LAZY` is ignored for collections, but faces can still load tables that weren't specified in `load_flags` via [`mutt_font_require`](#requiring-tables) (however, tables loaded this way aren't shared with other faces).
+
+				// @DOCLINE A collection can also be loaded directly from a file path using the function `mutt_collection_load_file`, defined below: @NLNT
+				MUDEF muttResult mutt_collection_load_file(const char* path, muttCollection* collection, muttLoadFlags load_flags);
+
+				// @DOCLINE This function maps the file into memory the same way that [`mutt_load_file`](#loading-a-font-file) does, and the mapping is owned by the collection.
+
+				// @DOCLINE If the result of either function isn't fatal, the collection must be deloaded at some point.
+
+			// @DOCLINE ### Retrieving a face
+
+				// @DOCLINE To retrieve a face of a collection, the function `mutt_collection_face` is used, defined below: @NLNT
+				MUDEF muttResult mutt_collection_face(muttCollection* collection, uint32_m index, muttFont** font);
+
+				// @DOCLINE `index` is the index of the face within the collection, and `font` is set to a pointer to the face's font if the result isn't fatal. The face is loaded the first time that it's retrieved, and the same font is given for every retrieval after that. Every successful retrieval must be matched by a call to `mutt_collection_release`, defined below: @NLNT
+				MUDEF void mutt_collection_release(muttCollection* collection, uint32_m index);
+
+				// @DOCLINE Once every retrieval of a face has been released, the face is deloaded, and the font pointer given for it is no longer valid. A face's font must not be deloaded with `mutt_deload`.
+
+				// @DOCLINE When a face loads a table whose table record is the same as a table already loaded by another face (and whose dependencies have the same values that it's loaded against, such as the amount of glyphs in maxp and the offset format in head, even if those tables are different), the table is shared by the faces rather than loaded again. Shared tables are reference-counted, and a shared table is deloaded once every face using it has been deloaded. This means that loading every face of a collection whose faces share their largest tables costs little more memory than loading one face.
+
+				// @DOCLINE Both functions are thread-safe.
+
+			// @DOCLINE ### Deloading a collection
+
+				// @DOCLINE To deload a collection, the function `mutt_collection_deload` is used, defined below: @NLNT
+				MUDEF void mutt_collection_deload(muttCollection* collection);
+
+				// @DOCLINE This function deloads every face of the collection that is still loaded (meaning that faces don't have to be released before the collection is deloaded), and unmaps the file if the collection was loaded with `mutt_collection_load_file`.
+
+		// @DOCLINE ## Font memory
+
+			// @DOCLINE The amount of memory held by a font's tables (and directory) can be retrieved using the function `mutt_font_memory`, defined below: @NLNT
+			MUDEF uint64_m mutt_font_memory(muttFont* font);
+
+			// @DOCLINE The amount is in bytes, and includes table memory that has been allocated but not yet used, but not font data that is borrowed from the user (or mapped from a file). This function is thread-safe, and the amount can grow as tables are [required](#requiring-tables).
+
+		// @DOCLINE ## Trusting a font
+
+			// @DOCLINE The glyphs of a font can be validated once so that they're decoded as if the font were [trusted](#font-load-modes) from then on, using the function `mutt_font_trust`, defined below: @NLNT
+			MUDEF muttResult mutt_font_trust(muttFont* font);
+
+			// @DOCLINE This function validates the header of every glyph in the font, loads every simple glyph, and loads and resolves every composite glyph (verifying its components, depth, and that it doesn't include itself), all with the usual checks (even if the font is already trusted). Every glyph found to be valid is marked as validated in `font->validated`, and is decoded without verifying it from then on by [`mutt_glyph_header`](#glyph-header), [`mutt_simple_glyph`](#load-simple-glyph), [`mutt_simple_header_rglyph`](#simple-glyph-header-to-rglyph), and everything that uses them; glyphs that aren't valid keep going through the usual checks. If every glyph is valid, `MUTT_SUCCESS` is returned; otherwise, the fatal result of the first invalid glyph is returned, and validation stops there, meaning that only the glyphs before it are sure to be marked as validated. The maxp, head, loca, and glyf tables must be loaded.
+
+			// @DOCLINE Validating every glyph takes about as long as decoding every glyph once, so for fonts that are used many times, it's recommended to rather load them with `MUTT_LOAD_TRUSTED` (if they're known to be valid) or to validate them once and cache the result. Since the flag is only a mode flag, the user can also add it to `font->mode_flags` at any time, as long as no other thread is using the font at the same time. `font->mode_flags` itself is never modified by this function, and glyphs are marked as validated atomically, so the font can be used by other threads while it's being validated (glyphs that haven't been validated yet just go through the usual checks).
+
+			// @DOCLINE This function is equivalent to calling [`mutt_font_validate`](#validating-a-font) with one thread and no report.
+
+			// @DOCLINE ### Validating a font
+
+				typedef struct muttGlyphBounds muttGlyphBounds;
+				typedef struct muttFontReport muttFontReport;
+
+				// @DOCLINE Every glyph of a font can be validated across multiple threads using the function `mutt_font_validate`, defined below: @NLNT
+				MUDEF muttResult mutt_font_validate(muttFont* font, uint32_m threads, muttFontReport* report);
+
+				// @DOCLINE Each glyph is validated the same way as in [`mutt_font_trust`](#trusting-a-font), and `threads` is the amount of threads to validate with, including the calling thread (0 meaning the amount of processors on the system), the same as in [`mutt_load_batch`](#loading-fonts-in-parallel). If every glyph is valid, `MUTT_SUCCESS` is returned; otherwise, the fatal result of the invalid glyph with the lowest ID is returned. `MUTT_FAILED_MALLOC` is returned if memory couldn't be allocated, in which case the font may not have been fully validated. Streamed fonts are always validated on the calling thread.
+
+				// @DOCLINE If `report` is 0, validation stops once an invalid glyph has been found. Otherwise, every glyph is validated (and every valid glyph is marked as validated, meaning that a font with a few broken glyphs still has every other glyph decoded without checks), and `report` is filled in with the result for each glyph, which the user can use to avoid ever giving an invalid glyph to other functions (rather than, for example, rasterizing every glyph to find the ones that are broken). A report is represented by the struct `muttFontReport`, which has the following members:
+
+				struct muttFontReport {
+					// @DOCLINE * `@NLFT num_glyphs` - the amount of glyphs in the font; equivalent to `maxp->num_glyphs`.
+					uint16_m num_glyphs;
+					// @DOCLINE * `@NLFT num_invalid` - the amount of glyphs that are invalid.
+					uint32_m num_invalid;
+					// @DOCLINE * `@NLFT* valid` - a bitset indicating which glyphs are valid, where glyph `g` is valid if bit `g%32` of `valid[g/32]` is set. Its length is equivalent to `(num_glyphs+31)/32`.
+					uint32_m* valid;
+					// @DOCLINE * `@NLFT* bounds` - the bounds of each glyph, calculated from its actual coordinates (for composite glyphs, the same as [`mutt_composite_glyph_min_max`](#composite-min-max)); the bounds of invalid glyphs and glyphs with no outline are all 0. Its length is equivalent to `num_glyphs`.
+					muttGlyphBounds* bounds;
+				};
+
+				// @DOCLINE The struct `muttGlyphBounds` has the following members:
+
+				struct muttGlyphBounds {
+					// @DOCLINE * `@NLFT x_min` - the minimum x-coordinate of the glyph.
+					int16_m x_min;
+					// @DOCLINE * `@NLFT y_min` - the minimum y-coordinate of the glyph.
+					int16_m y_min;
+					// @DOCLINE * `@NLFT x_max` - the maximum x-coordinate of the glyph.
+					int16_m x_max;
+					// @DOCLINE * `@NLFT y_max` - the maximum y-coordinate of the glyph.
+					int16_m y_max;
+				};
+
+				// @DOCLINE Whether or not a glyph is valid according to a report can be checked using the function `mutt_report_valid`, defined below: @NLNT
+				MUDEF muBool mutt_report_valid(muttFontReport* report, uint16_m glyph_id);
+
+				// @DOCLINE If the result of `mutt_font_validate` isn't `MUTT_FAILED_MALLOC`, the report must be deloaded at some point using the function `mutt_report_deload`, defined below: @NLNT
+				MUDEF void mutt_report_deload(muttFontReport* report);
+
+				// @DOCLINE The maxp, head, loca, and glyf tables must be loaded.
+
+		// @DOCLINE ## Font registries
+
+			typedef struct muttRegistryEntry muttRegistryEntry;
+			typedef struct muttFontRegistry muttFontRegistry;
+
+			// @DOCLINE A font registry shares loaded fonts between users of the same font data, and deloads fonts that haven't been used recently once the memory held by its fonts goes over a given budget. Fonts within a registry are identified by their data, meaning that the same font is only loaded once no matter where its data comes from. A font registry is represented by the struct `muttFontRegistry`, which has the following members:
+
+			struct muttFontRegistry {
+				// @DOCLINE * `@NLFT budget` - the amount of memory, in bytes, that the fonts of the registry can hold (as given by [`mutt_font_memory`](#font-memory)) before fonts that aren't in use are deloaded.
+				uint64_m budget;
+				// @DOCLINE * `@NLFT memory` - the amount of memory, in bytes, currently held by the fonts of the registry (including copies of their data, if the registry doesn't borrow it).
+				uint64_m memory;
+				// @DOCLINE * `@NLFT load_flags` - the load flags that each font is loaded with.
+				muttLoadFlags load_flags;
+				// @DOCLINE * `@NLFT num_fonts` - the amount of fonts currently loaded by the registry.
+				uint32_m num_fonts;
+
+				// @DOCLINE * `@NLFT* entries` - the fonts of the registry. This is used internally by mutt, and should only be modified by mutt.
+				muttRegistryEntry* entries;
+				// @DOCLINE * `@NLFT tick` - a counter used to track when each font was last used. This is used internally by mutt, and should only be modified by mutt.
+				uint32_m tick;
+				// @DOCLINE * `@NLFT lock` - a lock used to retrieve and release fonts thread-safely. This is used internally by mutt, and should only be modified by mutt.
+				uint32_m lock;
+			};
+
+			// @DOCLINE ### Creating a registry
+
+				// @DOCLINE To create a font registry, the function `mutt_registry_create` is used, defined below: @NLNT
+				MUDEF void mutt_registry_create(muttFontRegistry* registry, uint64_m budget, muttLoadFlags load_flags);
+
+				// @DOCLINE `budget` is the memory budget of the registry, in bytes, and `load_flags` are the [load flags](#font-load-flags) that each font is loaded with. No memory is allocated until fonts are retrieved.
+
+			// @DOCLINE ### Retrieving a font
+
+				// @DOCLINE To retrieve a font from a registry, the function `mutt_registry_acquire` is used, defined below: @NLNT
+				MUDEF muttResult mutt_registry_acquire(muttFontRegistry* registry, muByte* data, uint64_m datalen, muttFont** font);
+
+				// @DOCLINE `data` and `datalen` are the raw binary data of the font, and `font` is set to a pointer to the font if the result isn't fatal. If a font with the same data is already in the registry, it is given without loading anything; otherwise, the font is loaded from `data` and added to the registry. If the registry was created with the [borrow load mode](#font-load-modes), `data` must stay valid until the font is deloaded by the registry. Every successful retrieval must be matched by a call to `mutt_registry_release`, defined below: @NLNT
+				MUDEF void mutt_registry_release(muttFontRegistry* registry, muttFont* font);
+
+				// @DOCLINE A font is never deloaded while it is retrieved. Once every retrieval of a font has been released, the font stays loaded so that it can be given again, until the memory held by the registry's fonts goes over the budget, in which case the least recently used fonts that aren't retrieved are deloaded until the registry is within budget again. Because fonts in use are never deloaded, the registry can go over budget if the fonts in use hold more memory than the budget. A font given by a registry must not be deloaded with `mutt_deload`.
+
+				// @DOCLINE Both functions are thread-safe. If multiple threads retrieve the same font that isn't loaded yet at once, the font is only loaded once, and every thread waits for it to be loaded; fonts with different data are loaded at the same time.
+
+				// @DOCLINE > Fonts are looked up by a 64-bit hash of the first kilobyte of their data (which holds the table directory, including the checksum of each table) along with its length, and a font with the same hash is only given once its data is confirmed to be the same byte-for-byte, which is done without blocking other retrievals. To be able to compare against it, a registry that isn't created with the [borrow load mode](#font-load-modes) keeps one copy of the data of each of its fonts, which the font borrows its tables from rather than copying them again, and which is counted as memory held by the font towards the budget.
+
+			// @DOCLINE ### Deloading a registry
+
+				// @DOCLINE To deload a registry, the function `mutt_registry_deload` is used, defined below: @NLNT
+				MUDEF void mutt_registry_deload(muttFontRegistry* registry);
+
+				// @DOCLINE This function deloads every font of the registry, and must not be called while any font of the registry is retrieved.
 
 	// @DOCLINE # Low-level API
 
@@ -937,6 +1245,9 @@ mutt is developed primarily off of these sources of documentation:
 		// @DOCLINE ## Font struct
 
 			typedef struct muttDirectory muttDirectory;
+			typedef struct muttStream muttStream;
+			typedef struct muttOutlineCache muttOutlineCache;
+			typedef struct muttArena muttArena;
 			typedef struct muttMaxp muttMaxp;
 			typedef struct muttHead muttHead;
 			typedef struct muttHhea muttHhea;
@@ -954,6 +1265,31 @@ mutt is developed primarily off of these sources of documentation:
 				muttLoadFlags load_flags;
 				// @DOCLINE * `@NLFT fail_load_flags` - flags indicating which requested tables did not successfully load.
 				muttLoadFlags fail_load_flags;
+				// @DOCLINE * `@NLFT mode_flags` - the [load mode flags](#font-load-modes) that the font was loaded with.
+				muttLoadFlags mode_flags;
+
+				// @DOCLINE * `@NLFT* data` - the font file data that the font was loaded from if the font was loaded with `MUTT_LOAD_BORROW` or `MUTT_LOAD_LAZY`; 0 otherwise.
+				muByte* data;
+				// @DOCLINE * `@NLFT datalen` - the length of the font file data that the font was loaded from, in bytes (even if `data` is 0).
+				uint64_m datalen;
+				// @DOCLINE * `@NLFT lazy_flags` - flags indicating which tables haven't been attempted to be loaded yet, but still can be via [`mutt_font_require`](#requiring-tables). This is used internally by mutt, and should only be modified by mutt.
+				muttLoadFlags lazy_flags;
+				// @DOCLINE * `@NLFT lock` - a lock used to load tables thread-safely. This is used internally by mutt, and should only be modified by mutt.
+				uint32_m lock;
+
+				// @DOCLINE * `@NLFT* file_data` - the memory-mapped contents of the font file if the font was loaded with [`mutt_load_file`](#loading-a-font-file); 0 otherwise.
+				muByte* file_data;
+				// @DOCLINE * `@NLFT file_len` - the length of `file_data`, in bytes.
+				uint64_m file_len;
+				// @DOCLINE * `@NLFT* stream` - the state of the font's stream if the font was loaded with [`mutt_load_stream`](#loading-a-font-stream); 0 otherwise. This is used internally by mutt, and should only be modified by mutt.
+				muttStream* stream;
+				// @DOCLINE * `@NLFT* outlines` - the [outline cache](#outline-cache) of the font if one has been created; 0 otherwise. This is used internally by mutt, and should only be modified by mutt.
+				muttOutlineCache* outlines;
+				// @DOCLINE * `@NLFT* validated` - a bitset of the glyphs that have been [validated](#validating-a-font), which are decoded without being verified again, if any glyphs have been validated; 0 otherwise. This is used internally by mutt, and should only be modified by mutt.
+				uint32_m* validated;
+
+				// @DOCLINE * `@NLFT* memory` - the memory that every loaded table (and the directory) is allocated in. mutt sizes this from the table directory when the font is loaded so that all of the font's tables fit in one allocation, which is freed by `mutt_deload`. This is used internally by mutt, and should only be modified by mutt.
+				void* memory;
 
 				// @DOCLINE * `@NLFT* directory` - a pointer to the [font directory](#font-directory).
 				muttDirectory* directory;
@@ -1013,10 +1349,14 @@ mutt is developed primarily off of these sources of documentation:
 			// @DOCLINE The struct `muttDirectory` is used to list all of the tables provided by a TrueType font. It is stored in the struct `muttFont` as `muttFont.directory` and is similar to TrueType's table directory. It has the following members:
 
 			struct muttDirectory {
+				// @DOCLINE * `@NLFT offset` - the offset of the table directory within the font data; this is 0 unless the font is a face of a [collection](#font-collections).
+				uint64_m offset;
 				// @DOCLINE * `@NLFT num_tables` - the amount of tables within the font; equivalent to "numTables" in the table directory.
 				uint16_m num_tables;
-				// @DOCLINE * `@NLFT* records` - pointer to an array of each [table record](#table-record); similar to "tableRecords" in the table directory. This array is of length `num_tables`.
+				// @DOCLINE * `@NLFT* records` - pointer to an array of each [table record](#table-record); equivalent to "tableRecords" in the table directory. This array is of length `num_tables`, and is in the same order as in the font's table directory.
 				muttTableRecord* records;
+				// @DOCLINE * `@NLFT* sorted` - pointer to an array of length `num_tables` holding the tag of each table record (in the upper 32 bits) and its index in `records` (in the lower 32 bits), sorted by tag. This is used internally by mutt to find tables, and should only be modified by mutt.
+				uint64_m* sorted;
 			};
 
 			// @DOCLINE ### Table record
@@ -1038,6 +1378,13 @@ mutt is developed primarily off of these sources of documentation:
 
 				// @DOCLINE The checksum value is not validated for the head table, as the head table itself includes a checksum value.
 
+			// @DOCLINE ### Finding a table
+
+				// @DOCLINE The function `mutt_find_table` finds the table record of a table in the font's table directory by its tag, defined below: @NLNT
+				MUDEF muttTableRecord* mutt_find_table(muttFont* font, uint32_m tag);
+
+				// @DOCLINE `tag` is the table tag represented as an unsigned 32-bit value read as big-endian (the same way as `muttTableRecord.table_tag_u32`); for example, the tag for the "OS/2" table is `0x4F532F32`. This function returns a pointer to the table record for the given tag if it exists in the font, and 0 if it doesn't. The search is a binary search over the directory's tags sorted by `sorted`, which makes it possible to reach tables that mutt doesn't load itself, such as by using the record's offset and length to read the table from the font data.
+
 		// @DOCLINE ## Maxp table
 
 			// @DOCLINE The struct `muttMaxp` is used to represent the maxp table provided by a TrueType font, stored in the struct `muttFont` as the pointer member "`maxp`", and loaded with the flag `MUTT_LOAD_MAXP`. It has the following members:
@@ -1166,6 +1513,12 @@ mutt is developed primarily off of these sources of documentation:
 				muttLongHorMetric* hmetrics;
 				// @DOCLINE * `@NLFT* left_side_bearings` - equivalent to "leftSideBearings" in the hmtx table. Its length is equivalent to `maxp->num_glyphs - hhea->number_of_hmetrics`.
 				int16_m* left_side_bearings;
+				// @DOCLINE * `@NLFT* raw` - the raw data of the hmtx table if the font was loaded with [`MUTT_LOAD_COMPACT`](#font-load-modes), in which case `hmetrics` and `left_side_bearings` are 0; 0 otherwise.
+				muByte* raw;
+				// @DOCLINE * `@NLFT* advances` - the advance width of each glyph if the font was loaded with [`MUTT_LOAD_DENSE`](#font-load-modes), in which case `hmetrics` and `left_side_bearings` are 0; 0 otherwise. Its length is equivalent to `maxp->num_glyphs`.
+				uint16_m* advances;
+				// @DOCLINE * `@NLFT* lsbs` - the left-side bearing of each glyph if the font was loaded with `MUTT_LOAD_DENSE`; 0 otherwise. Its length is equivalent to `maxp->num_glyphs`.
+				int16_m* lsbs;
 			};
 
 			// @DOCLINE The struct `muttLongHorMetrics` has the following members:
@@ -1179,6 +1532,16 @@ mutt is developed primarily off of these sources of documentation:
 
 			// @DOCLINE All values provided in the `muttHmtx` struct (AKA the values in `muttLongHorMetrics`) are not checked, as virtually all of them have no technically "incorrect" values (from what I'm aware).
 
+			// @DOCLINE ### Glyph metrics
+
+				// @DOCLINE The advance width of a glyph can be retrieved (in FUnits) regardless of how the hmtx table is stored using the function `mutt_glyph_advance`, defined below: @NLNT
+				MUDEF uint16_m mutt_glyph_advance(muttFont* font, uint16_m glyph_id);
+
+				// @DOCLINE Likewise, the left-side bearing of a glyph can be retrieved (in FUnits) using the function `mutt_glyph_lsb`, defined below: @NLNT
+				MUDEF int16_m mutt_glyph_lsb(muttFont* font, uint16_m glyph_id);
+
+				// @DOCLINE `glyph_id` must be less than `maxp->num_glyphs`, and the hmtx table must be loaded. Glyphs past the end of `hmetrics` use the advance width of the last entry in `hmetrics` (or 0 if it's empty), as described by the specification.
+
 		// @DOCLINE ## Loca table
 
 			// @DOCLINE The union `muttLoca` is used to represent the loca table provided by a TrueType font, stored in the struct `muttFont` as the pointer member "`loca`", and loaded with the flag `MUTT_LOAD_LOCA` (`MUTT_LOAD_MAXP`, `MUTT_LOAD_HEAD`, and `MUTT_LOAD_GLYF` must also be defined). It has the following members:
@@ -1188,10 +1551,19 @@ mutt is developed primarily off of these sources of documentation:
 				uint16_m* offsets16;
 				// @DOCLINE * `@NLFT* offsets32` - equivalent to the long-format offsets array in the loca table. This member is to be read from if `head->index_to_loc_format` is equal to `MUTT_OFFSET_32`.
 				uint32_m* offsets32;
+				// @DOCLINE * `@NLFT* raw` - the raw data of the loca table. This member is to be read from (instead of `offsets16` and `offsets32`) if the font was loaded with [`MUTT_LOAD_COMPACT`](#font-load-modes).
+				muByte* raw;
 			};
 
 			// @DOCLINE The offsets are verified to be within range of the glyf table, along with all of the other rules within the specification.
 
+			// @DOCLINE ### Glyph offsets
+
+				// @DOCLINE The offset of a glyph's data within the glyf table can be retrieved regardless of how the loca table is stored using the function `mutt_loca_offset`, defined below: @NLNT
+				MUDEF uint32_m mutt_loca_offset(muttFont* font, uint32_m glyph_id);
+
+				// @DOCLINE `glyph_id` must be less than or equal to `maxp->num_glyphs`, and the loca table must be loaded. The returned offset is in bytes (already multiplied by 2 for short-format offsets), and the length of a glyph's data is the offset of the next glyph ID minus its own offset.
+
 		// @DOCLINE ## Name table
 
 			typedef struct muttNameRecord muttNameRecord;
@@ -1210,7 +1582,7 @@ mutt is developed primarily off of these sources of documentation:
 				uint16_m lang_tag_count;
 				// @DOCLINE * `@NLFT* lang_tag_records` - all [language tag records](#lang-tag-record) provided (length `lang_tag_count`); equivalent to "langTagRecord" in the naming table header.
 				muttLangTagRecord* lang_tag_records;
-				// @DOCLINE * `@NLFT* string_data` - the raw string data provided by the name table. All pointers to strings provided by the name table are pointers to parts of this data.
+				// @DOCLINE * `@NLFT* string_data` - the raw string data provided by the name table. All pointers to strings provided by the name table are pointers to parts of this data. If the font was loaded with `MUTT_LOAD_BORROW`, this points into the data given to `mutt_load`.
 				muByte* string_data;
 			};
 
@@ -1259,7 +1631,7 @@ mutt is developed primarily off of these sources of documentation:
 				struct muttGlyf {
 					// @DOCLINE * `@NLFT len` - the length of the glyf table, in bytes.
 					uint32_m len;
-					// @DOCLINE * `@NLFT* data` - the raw byte data of the glyf table (length `len`).
+					// @DOCLINE * `@NLFT* data` - the raw byte data of the glyf table (length `len`). If the font was loaded with `MUTT_LOAD_BORROW`, this points into the data given to `mutt_load`.
 					muByte* data;
 				};
 
@@ -1284,6 +1656,8 @@ mutt is developed primarily off of these sources of documentation:
 						muByte* data;
 						// @DOCLINE * `@NLFT length` - the length of the data after the header in bytes. If this member is equal to 0, the given glyph has no outline, and should not be called with any functions.
 						uint32_m length;
+						// @DOCLINE * `@NLFT glyph_id` - the ID of the glyph. This is primarily used internally by mutt.
+						uint16_m glyph_id;
 					};
 
 					// @DOCLINE The minimums and maximums for x- and y-coordinates within the glyph header are not checked initially (besides making sure the minimums are less than or equal to the maximums, and that they're within range of the values provided by the head table); if the actual glyph coordinates are not confined within the given minimums and maximums, a non-fatal result will be provided upon loading the simple glyph data. Either way, the header's listed x/y min/max values are overwritten with mutt's upon loading a simple glyph.
@@ -1293,7 +1667,7 @@ mutt is developed primarily off of these sources of documentation:
 						// @DOCLINE In order to load a glyph header for a given glyph ID, the function `mutt_glyph_header` is used, defined below: @NLNT
 						MUDEF muttResult mutt_glyph_header(muttFont* font, uint16_m glyph_id, muttGlyphHeader* header);
 
-						// @DOCLINE Upon a non-fatal result, `header` is filled with valid header information for the given glyph ID. Upon a fatal result, the contents of `header` are undefined. The given header information is only valid for as long as `font` is not deloaded.
+						// @DOCLINE Upon a non-fatal result, `header` is filled with valid header information for the given glyph ID. Upon a fatal result, the contents of `header` are undefined. The given header information is only valid for as long as `font` is not deloaded, or, if the font is [streamed](#loading-a-font-stream), until the next call to `mutt_glyph_header` with the same font.
 
 						// @DOCLINE `glyph_id` must be a valid glyph ID for the given font (AKA less than `font->head->num_glyphs`).
 
@@ -1360,6 +1734,13 @@ mutt is developed primarily off of these sources of documentation:
 
 						// @DOCLINE > It's also invalid (from what I'm aware) to have the first point be off-curve, but in the case that such happens, mutt permits this, pretending that the previous point was an on-curve point at (0,0). It's also invalid (from what I'm aware) to have a repeat flag count that exceeds the amount of points, but since it's easy to internally make sure to simply not go over the point count, mutt permits this.
 
+					// @DOCLINE #### Load simple glyph with an arena
+
+						// @DOCLINE A simple glyph can be loaded with memory from an [arena](#arenas) using the function `mutt_simple_glyph_arena`, defined below: @NLNT
+						MUDEF muttResult mutt_simple_glyph_arena(muttFont* font, muttGlyphHeader* header, muttSimpleGlyph* glyph, muttArena* arena);
+
+						// @DOCLINE This function is equivalent to `mutt_simple_glyph`, except that the memory for `glyph` is allocated from `arena`, with the given glyph information being valid for as long as that memory is.
+
 					// @DOCLINE #### Simple glyph memory maximum
 
 						// @DOCLINE The maximum amount of memory that will be needed for loading a simple glyph, in bytes, is provided by the function `mutt_simple_glyph_max_size`, defined below: @NLNT
@@ -1372,6 +1753,8 @@ mutt is developed primarily off of these sources of documentation:
 
 						// @DOCLINE The values `x_min`, `y_min`, `x_max`, and `y_max` are filled in for `header` upon a non-fatal result. The given glyph must have at least one contour.
 
+						// @DOCLINE This function only reads the flags and coordinates of the glyph (running through the x- and y-coordinates at once), and allocates no memory, making it considerably cheaper than loading the glyph. The glyph is checked the same way as by `mutt_simple_glyph` (including the order of the contour end points, the point count, and the instruction length), giving the same fatal results; the only difference is that the non-fatal results `MUTT_INVALID_GLYF_SIMPLE_X_COORD` and `MUTT_INVALID_GLYF_SIMPLE_Y_COORD` aren't given, as the x/y min/max values in `header` are the values being calculated.
+
 					// @DOCLINE #### Simple glyph point count
 
 						// @DOCLINE Getting just the amount of points within a simple glyph based on its header is a fairly cheap operation, requiring no manual allocation. The function `mutt_simple_glyph_points` calculates the amount of points that a simple glyph contains, defined below: @NLNT
@@ -1461,6 +1844,13 @@ mutt is developed primarily off of these sources of documentation:
 
 						// @DOCLINE This function performs no checks on the validity of the components' range within the minimum/maximum coordinate ranges specified for the glyph in the respective header. Therefore, this function does allow composite glyphs to successfully load that have points that are out of range. This is due to the fact that properly verifying the points' coordinates would entail fully decompressing the composite glyph's components, which is not performed in the lower-level API of mutt.
 
+					// @DOCLINE #### Load composite glyph with an arena
+
+						// @DOCLINE A composite glyph can be loaded with memory from an [arena](#arenas) using the function `mutt_composite_glyph_arena`, defined below: @NLNT
+						MUDEF muttResult mutt_composite_glyph_arena(muttFont* font, muttGlyphHeader* header, muttCompositeGlyph* glyph, muttArena* arena);
+
+						// @DOCLINE This function is equivalent to `mutt_composite_glyph`, except that the memory for `glyph` is allocated from `arena`, with the given glyph information being valid for as long as that memory is.
+
 					// @DOCLINE #### Composite glyph memory maximum
 
 						// @DOCLINE The maximum amount of memory that will be needed for loading a composite glyph, in bytes, is provided by the function `mutt_composite_glyph_max_size`, defined below: @NLNT
@@ -1475,6 +1865,13 @@ mutt is developed primarily off of these sources of documentation:
 
 						// @DOCLINE Since composite glyphs allow for non-integer coordinates, the coordinates filled in are the ceiling equivalents.
 
+						// @DOCLINE If every component of the glyph (including the components of composite glyphs within it) is placed by offset rather than by matching points, and isn't rotated or skewed, the x/y min/max is calculated from the x/y min/max of each component's simple glyph (calculated the same way as [`mutt_simple_glyph_min_max`](#simple-glyph-min-max)) without resolving any points, which needs no memory, and gives the same values as resolving the points would. Otherwise, every component's points are resolved the same way as [`mutt_composite_rglyph`](#composite-glyph-to-rglyph).
+
+						// @DOCLINE This function allocates the memory that it needs to process the glyph's components. To calculate the x/y min/max with memory provided by the user instead, the function `mutt_composite_glyph_min_max_scratch` is used, defined below: @NLNT
+						MUDEF muttResult mutt_composite_glyph_min_max_scratch(muttFont* font, muttGlyphHeader* header, muByte* data, muByte* scratch);
+
+						// @DOCLINE `data` must be of size [`mutt_composite_rglyph_max`](#composite-glyph-to-rglyph-memory-maximum) and `scratch` must be of size [`mutt_composite_scratch_max`](#composite-scratch-memory-maximum) (in bytes), and neither is allocated by this function.
+
 					// @DOCLINE #### Composite glyph component retrieval
 
 						// @DOCLINE A composite glyph can be processed component-by-component using the function `mutt_composite_component`, defined below: @NLNT
@@ -1603,11 +2000,17 @@ mutt is developed primarily off of these sources of documentation:
 					uint16_m seg_count;
 					// @DOCLINE * `@NLFT* seg` - an array of each segment within the cmap format 4 subtable.
 					muttCmap4Segment* seg;
+					// @DOCLINE * `@NLFT* end_codes` - the end code of each segment (the same as `seg[s].end_code`), stored on their own so that they can be searched through compactly.
+					uint16_m* end_codes;
+					// @DOCLINE * `@NLFT overlapping` - whether or not any segment starts at or before the end of the segment before it, in which case more than one segment can contain a codepoint.
+					muBool overlapping;
 					// @DOCLINE * `@NLFT* glyph_ids` - equivalent to "glyphIdArray" in the cmap format 4 subtable; the glyph index array that each segment should return indexes into.
 					uint16_m* glyph_ids;
+					// @DOCLINE * `@NLFT glyph_id_count` - the amount of glyph IDs in the `glyph_ids` array.
+					uint16_m glyph_id_count;
 				};
 
-				// @DOCLINE Internally, mutt does not verify or use the values for "searchRange", "entrySelector", or "rangeShift".
+				// @DOCLINE Internally, mutt does not verify or use the values for "searchRange", "entrySelector", or "rangeShift"; segments are instead searched through with a binary search over `end_codes`.
 
 				// @DOCLINE The struct `muttCmap4Segment` represents a segment in the cmap format 4 subtable, and has the following members:
 				struct muttCmap4Segment {
@@ -1637,6 +2040,8 @@ mutt is developed primarily off of these sources of documentation:
 
 				// @DOCLINE Both functions return 0 if no equivalent could be found in the conversion process.
 
+				// @DOCLINE `mutt_cmap4_get_glyph` finds the segment that contains the codepoint with a binary search (taking about log2(`seg_count`) steps without branching on the comparisons), rather than going through each segment. If the segments are `overlapping`, the segments after the one found are checked as well, since the segments are only sorted by their end codes. `mutt_cmap4_get_codepoint` goes through each segment, since segments aren't sorted by glyph ID.
+
 			// @DOCLINE ### Format 12
 
 				typedef struct muttCmap12Group muttCmap12Group;
@@ -1693,6 +2098,47 @@ mutt is developed primarily off of these sources of documentation:
 			User-allocated functions usually also have provided maximums for the maximum amount of memory that will be needed to perform the operation for any given variables, which can be used to pre-allocate and use the same memory for multiple passes of the operation. For example, `mutt_simple_glyph` has a memory maximum provided by the function `mutt_simple_glyph_max_size`, which means that a user can allocate memory of byte-length `mutt_simple_glyph_max_size(...)` and use that same memory for a call to `mutt_simple_glyph` for any glyphs that they need to load, avoiding the need to reallocate any memory when processing simple glyphs, although at the cost of only being able to process one simple glyph at a time.
 			@DOCEND */
 
+		// @DOCLINE ## Arenas
+
+			// @DOCLINE An arena is a block of memory provided by the user that functions allocate memory from by moving forward through it, which allows memory for many operations to be given at once and let go of all at once. An arena is represented by the struct `muttArena`, which has the following members:
+
+			struct muttArena {
+				// @DOCLINE * `@NLFT* data` - the memory of the arena.
+				muByte* data;
+				// @DOCLINE * `@NLFT size` - the size of `data`, in bytes.
+				uint64_m size;
+				// @DOCLINE * `@NLFT used` - the amount of bytes in `data` that have been allocated.
+				uint64_m used;
+			};
+
+			// @DOCLINE ### Initializing an arena
+
+				// @DOCLINE To initialize an arena over some memory, the function `mutt_arena_init` is used, defined below: @NLNT
+				MUDEF void mutt_arena_init(muttArena* arena, muByte* data, uint64_m size);
+
+				// @DOCLINE `data` must stay valid for as long as the arena (or anything allocated from it) is in use. Nothing is allocated by the arena itself.
+
+			// @DOCLINE ### Allocating from an arena
+
+				// @DOCLINE To allocate memory from an arena, the function `mutt_arena_alloc` is used, defined below: @NLNT
+				MUDEF void* mutt_arena_alloc(muttArena* arena, uint64_m size);
+
+				// @DOCLINE The memory returned is aligned to 8 bytes (no matter the alignment of the arena's memory); 0 is returned if the arena doesn't have enough memory left, in which case the arena is unmodified.
+
+			// @DOCLINE ### Resetting an arena
+
+				// @DOCLINE Memory allocated from an arena is let go of by resetting the arena to a previous point. The current point of an arena can be retrieved with the function `mutt_arena_mark`, defined below: @NLNT
+				MUDEF uint64_m mutt_arena_mark(muttArena* arena);
+
+				// @DOCLINE The arena can then be reset to that point with the function `mutt_arena_reset`, defined below: @NLNT
+				MUDEF void mutt_arena_reset(muttArena* arena, uint64_m mark);
+
+				// @DOCLINE Everything allocated from the arena after the mark was retrieved is invalid once the arena is reset to it. Resetting an arena to 0 lets go of everything allocated from it, which can be done, for example, once per frame.
+
+			// @DOCLINE ### Arena functions
+
+				// @DOCLINE Several user-allocated functions have an equivalent function that takes an arena in place of `data` and `written`, named the same with the suffix `_arena` (such as `mutt_simple_glyph_arena` for `mutt_simple_glyph`). These functions allocate exactly the memory needed from the arena in one call, rather than needing to be called once to retrieve the amount of memory needed or being given memory for the maximum amount. Memory used only temporarily within these functions is let go of before they return, and the arena is left unmodified upon a fatal result. If the arena doesn't have enough memory left, `MUTT_FAILED_ARENA` is returned.
+
 		// @DOCLINE ## String macros
 
 			// @DOCLINE This section covers macros defined for platform, encoding, language, and name IDs. Note that values may be given that don't fit into any of the given macros.
@@ -2336,6 +2782,13 @@ mutt is developed primarily off of these sources of documentation:
 			// @DOCLINE Rasterizing a glyph is performed with the function `mutt_raster_glyph`, defined below: @NLNT
 			MUDEF muttResult mutt_raster_glyph(muttRGlyph* glyph, muttRBitmap* bitmap, muttRMethod method);
 
+			// @DOCLINE ### Rasterize glyph with an arena
+
+				// @DOCLINE Rasterizing a glyph needs memory that `mutt_raster_glyph` allocates and frees upon each call. To allocate it from an [arena](#arenas) instead, the function `mutt_raster_glyph_arena` is used, defined below: @NLNT
+				MUDEF muttResult mutt_raster_glyph_arena(muttRGlyph* glyph, muttRBitmap* bitmap, muttRMethod method, muttArena* arena);
+
+				// @DOCLINE The memory allocated from `arena` is let go of before the function returns.
+
 			// @DOCLINE ### Raster method
 
 				// @DOCLINE The type `muttRMethod` (typedef for `uint16_m`) represents what rasterization method to use when rasterizing a glyph. It has the following defined values:
@@ -2397,6 +2850,13 @@ mutt is developed primarily off of these sources of documentation:
 
 				// @DOCLINE This function follows the format of a user-allocated function. For an explanation of how `data` and `written` are supposed to be used within this function, see [the user-allocated function section](#user-allocated-functions).
 
+				// @DOCLINE #### Simple glyph to rglyph with an arena
+
+					// @DOCLINE A simple glyph can be converted to an rglyph with memory from an [arena](#arenas) using the function `mutt_simple_rglyph_arena`, defined below: @NLNT
+					MUDEF muttResult mutt_simple_rglyph_arena(muttFont* font, muttGlyphHeader* header, muttSimpleGlyph* glyph, muttRGlyph* rglyph, float point_size, float ppi, muttArena* arena);
+
+					// @DOCLINE This function is equivalent to `mutt_simple_rglyph`, except that the memory for `rglyph` is allocated from `arena`.
+
 				// @DOCLINE #### Simple glyph to rglyph memory maximum
 
 					// @DOCLINE The maximum amount of memory that will be needed for converting a simple glyph to a raster glyph for a given font, in bytes, is provided by the function `mutt_simple_rglyph_max`, defined below: @NLNT
@@ -2420,6 +2880,27 @@ mutt is developed primarily off of these sources of documentation:
 					// @DOCLINE The maximum amount of memory that will be needed for converting a composite glyph to a raster glyph for a given font, in bytes, is provided by the function `mutt_composite_rglyph_max`, defined below: @NLNT
 					MUDEF uint32_m mutt_composite_rglyph_max(muttFont* font);
 
+				// @DOCLINE #### Composite glyph to rglyph with scratch memory
+
+					// @DOCLINE Processing the components of a composite glyph needs more memory than the rglyph itself, which `mutt_composite_rglyph` allocates and frees upon each call. To provide this memory instead, the function `mutt_composite_rglyph_scratch` is used, defined below: @NLNT
+					MUDEF muttResult mutt_composite_rglyph_scratch(muttFont* font, muttGlyphHeader* header, muttCompositeGlyph* glyph, muttRGlyph* rglyph, float point_size, float ppi, muByte* data, muByte* scratch);
+
+					// @DOCLINE This function is equivalent to `mutt_composite_rglyph`, except that `scratch` is used as memory for processing the components, and no memory is allocated. If `scratch` is 0, the memory is allocated as it would be by `mutt_composite_rglyph`. `scratch` can be reused once the function returns, and is not used by the rglyph given.
+
+					// @DOCLINE Components that are themselves composite glyphs are processed with a stack within `scratch` rather than by recursion; a composite glyph that has itself as a component (directly or not) gives the result `MUTT_INVALID_RGLYPH_COMPOSITE_CYCLE`, and one that's nested deeper than allowed by the maxp table gives the result `MUTT_INVALID_RGLYPH_COMPOSITE_DEPTH`.
+
+				// @DOCLINE #### Composite glyph to rglyph with an arena
+
+					// @DOCLINE A composite glyph can be converted to an rglyph with memory from an [arena](#arenas) using the function `mutt_composite_rglyph_arena`, defined below: @NLNT
+					MUDEF muttResult mutt_composite_rglyph_arena(muttFont* font, muttGlyphHeader* header, muttCompositeGlyph* glyph, muttRGlyph* rglyph, float point_size, float ppi, muttArena* arena);
+
+					// @DOCLINE This function is equivalent to `mutt_composite_rglyph_scratch`, except that the memory for `rglyph` and the scratch memory are allocated from `arena`. The arena needs enough memory left for `mutt_composite_rglyph_max` and `mutt_composite_scratch_max` during the call, but only the memory that the rglyph actually uses stays allocated once it returns.
+
+				// @DOCLINE #### Composite scratch memory maximum
+
+					// @DOCLINE The amount of memory needed as scratch memory for processing the components of any composite glyph of a given font, in bytes, is provided by the function `mutt_composite_scratch_max`, defined below: @NLNT
+					MUDEF uint32_m mutt_composite_scratch_max(muttFont* font);
+
 			// @DOCLINE ### Glyph header to rglyph
 
 				// @DOCLINE The function `mutt_header_rglyph` converts a glyph header to a glyph, defined below: @NLNT
@@ -2431,6 +2912,22 @@ mutt is developed primarily off of these sources of documentation:
 
 				// @DOCLINE This function follows the format of a user-allocated function. For an explanation of how `data` and `written` are supposed to be used within this function, see [the user-allocated function section](#user-allocated-functions). However, since the conversion of a composite glyph to an rglyph requires a fixed amount of memory per font, if `written` is ever dereferenced and set by this function relative to a composite glyph, it will be set to `mutt_composite_rglyph_max`.
 
+				// @DOCLINE #### Simple glyph header to rglyph
+
+					// @DOCLINE A simple glyph can be converted to an rglyph directly from its header, without loading it as a `muttSimpleGlyph` first, using the function `mutt_simple_header_rglyph`, defined below: @NLNT
+					MUDEF muttResult mutt_simple_header_rglyph(muttFont* font, muttGlyphHeader* header, muttRGlyph* rglyph, float point_size, float ppi, muByte* data, uint32_m* written);
+
+					// @DOCLINE This function decodes the glyph's data once, converting each coordinate to pixel units as it's decoded, and gives the same rglyph that converting the glyph with `mutt_simple_glyph` and `mutt_simple_rglyph` would. It performs the same checks as `mutt_simple_glyph`, and likewise overwrites the x/y min/max values within `header` with correct values; however, it doesn't give the non-fatal results `MUTT_INVALID_GLYF_SIMPLE_X_COORD` and `MUTT_INVALID_GLYF_SIMPLE_Y_COORD` if the values provided in `header` were invalid (the same as `mutt_header_rglyph` never has), so `mutt_simple_glyph` should be used to find out if they were. `mutt_header_rglyph` uses this function for simple glyphs.
+
+					// @DOCLINE This function follows the format of a user-allocated function. For an explanation of how `data` and `written` are supposed to be used within this function, see [the user-allocated function section](#user-allocated-functions). Calculating the memory needed only reads the glyph's last contour end, and the maximum amount of memory needed is provided by [`mutt_simple_rglyph_max`](#simple-glyph-to-rglyph-memory-maximum).
+
+				// @DOCLINE #### Glyph header to rglyph with an arena
+
+					// @DOCLINE A glyph header can be converted to an rglyph with memory from an [arena](#arenas) using the function `mutt_header_rglyph_arena`, defined below: @NLNT
+					MUDEF muttResult mutt_header_rglyph_arena(muttFont* font, muttGlyphHeader* header, muttRGlyph* rglyph, float point_size, float ppi, muttArena* arena);
+
+					// @DOCLINE This function is equivalent to `mutt_header_rglyph`, except that the memory for `rglyph` is allocated from `arena`. Any composite glyph loaded along the way is let go of before the function returns, so only the memory that the rglyph uses stays allocated, and no memory is allocated from the heap (other than for the font's [outline cache](#outline-cache), if it has one).
+
 				// @DOCLINE #### Glyph header to rglyph memory maximum
 
 					// @DOCLINE The maximum amount of memory that will be needed for converting a glyph header to a raster glyph for a given font, in bytes, is provided by the function `mutt_header_rglyph_max`, defined below: @NLNT
@@ -2438,6 +2935,67 @@ mutt is developed primarily off of these sources of documentation:
 
 					// @DOCLINE This function rather returns (the sum of `mutt_simple_glyph_max_size` and `mutt_simple_rglyph_max`) or (the sum of `mutt_composite_glyph_max_size` and `mutt_composite_rglyph_max`), whichever is greater. All the table loading requirements of these functions apply.
 
+			// @DOCLINE ### Glyph ID to rglyph
+
+				// @DOCLINE The function `mutt_glyph_rglyph` converts a glyph to an rglyph by its glyph ID, defined below: @NLNT
+				MUDEF muttResult mutt_glyph_rglyph(muttFont* font, uint16_m glyph_id, muttRGlyph* rglyph, float point_size, float ppi, muByte* data, uint32_m* written);
+
+				// @DOCLINE This function is equivalent to retrieving the glyph's header with [`mutt_glyph_header`](#get-glyph-header) and giving it to [`mutt_header_rglyph`](#glyph-header-to-rglyph), and follows the same rules, except that if the font has an [outline cache](#outline-cache), the decoded outline of a simple glyph, or the flattened outline of a composite glyph, is taken from the cache instead of being decoded (and, for a composite glyph, having each of its components resolved) again. The maximum amount of memory needed is also given by `mutt_header_rglyph_max`. If `data` is 0 and the font has an outline cache, the amount of memory written is enough to also decode a simple glyph that isn't cached yet, meaning that it can be greater than the amount given by `mutt_header_rglyph` for the same glyph.
+
+			// @DOCLINE ### Outline cache
+
+				// @DOCLINE Converting a glyph to an rglyph decodes the glyph's outline from the glyf table every time, even if the same glyph is converted at many different sizes. A font can be given an outline cache, which keeps the decoded outlines (points, flags, contour ends, and validated x/y min/max, in FUnits) of simple glyphs, as well as composite glyphs resolved into one flat outline (with every component's transformation and offset already applied), so that converting a glyph that has been converted before only involves converting its coordinates to pixel units. An outline cache is created for a font with the function `mutt_outline_cache_create`, defined below: @NLNT
+				MUDEF muttResult mutt_outline_cache_create(muttFont* font, uint64_m budget);
+
+				// @DOCLINE `budget` is the maximum amount of memory, in bytes, that the cached outlines can take up; once the budget is exceeded, the least recently used outlines are removed from the cache. An additional pointer per glyph is allocated upfront to find outlines by glyph ID, which doesn't count towards the budget. If the font already has an outline cache, its budget is changed to `budget`. The cache is deleted by [`mutt_deload`](#deloading-a-font) (and [`mutt_reload`](#reloading-a-font)). The maxp, loca, and glyf tables must be loaded.
+
+				// @DOCLINE The cache is used by [`mutt_glyph_rglyph`](#glyph-id-to-rglyph) for both simple and composite glyphs, and for the simple glyphs that make up composite glyphs given to [`mutt_header_rglyph`](#glyph-header-to-rglyph), [`mutt_composite_rglyph`](#composite-glyph-to-rglyph), and [`mutt_composite_glyph_min_max`](#composite-min-max). It is thread-safe, meaning that the same font can be used with these functions by multiple threads at once; an outline that is being converted by one thread is never removed by another.
+
+			// @DOCLINE ### Batch glyph decoding
+
+				typedef struct muttGlyphOutline muttGlyphOutline;
+
+				// @DOCLINE Many glyphs can be decoded at once into outlines in FUnits, which can each then be converted to an rglyph at any size. A decoded outline is represented by the struct `muttGlyphOutline`, which has the following members:
+
+				struct muttGlyphOutline {
+					// @DOCLINE * `@NLFT result` - the result of decoding the glyph. If this result is fatal, the other members are undefined.
+					muttResult result;
+					// @DOCLINE * `@NLFT num_points` - the amount of points in the outline.
+					uint16_m num_points;
+					// @DOCLINE * `@NLFT* points` - the points of the outline, in FUnits; the flags of each point are [rglyph point flags](#rglyph-point-flags). For a composite glyph, these are the points of every component with their transformations and offsets applied.
+					muttRPoint* points;
+					// @DOCLINE * `@NLFT num_contours` - the amount of contours in the outline.
+					uint16_m num_contours;
+					// @DOCLINE * `@NLFT* contour_ends` - the index of the last point of each contour.
+					uint16_m* contour_ends;
+					// @DOCLINE * `@NLFT x_min` - the minimum x-coordinate of the points, in FUnits.
+					float x_min;
+					// @DOCLINE * `@NLFT y_min` - the minimum y-coordinate of the points, in FUnits.
+					float y_min;
+					// @DOCLINE * `@NLFT x_max` - the maximum x-coordinate of the points, in FUnits.
+					float x_max;
+					// @DOCLINE * `@NLFT y_max` - the maximum y-coordinate of the points, in FUnits.
+					float y_max;
+				};
+
+				// @DOCLINE A glyph with no outline is given with no points and no contours, and all of its x/y min/max values set to 0.
+
+				// @DOCLINE #### Decoding many glyphs
+
+					// @DOCLINE To decode many glyphs at once, the function `mutt_glyphs_decode` is used, defined below: @NLNT
+					MUDEF muttResult mutt_glyphs_decode(muttFont* font, uint16_m* glyph_ids, uint32_m count, muttArena* arena, muttGlyphOutline* outlines);
+
+					// @DOCLINE `glyph_ids` is an array of `count` glyph IDs, each of which must be valid, and `outlines` is an array of `count` outlines that the outline of each glyph is written to, with the points and contour ends of each outline allocated from `arena`. The glyphs are decoded in the order that their data is laid out in the glyf table (rather than the order given) so that the data is read sequentially, and the memory needed to decode each glyph is allocated once for the whole batch rather than once per glyph.
+
+					// @DOCLINE The result of decoding each glyph is stored in its outline; a glyph that doesn't fit in the arena is given `MUTT_FAILED_ARENA`, but other glyphs that fit are still decoded. The function itself only returns a fatal result if the memory for decoding couldn't be allocated, in which case no glyphs are decoded. The maxp, head, loca, and glyf tables must be loaded.
+
+				// @DOCLINE #### Outline to rglyph
+
+					// @DOCLINE To convert a decoded outline to an rglyph, the function `mutt_glyph_outline_rglyph` is used, defined below: @NLNT
+					MUDEF void mutt_glyph_outline_rglyph(muttFont* font, muttGlyphOutline* outline, muttRGlyph* rglyph, float point_size, float ppi, muByte* data, uint32_m* written);
+
+					// @DOCLINE This function follows the format of a user-allocated function. For an explanation of how `data` and `written` are supposed to be used within this function, see [the user-allocated function section](#user-allocated-functions). The outline must have been decoded successfully and have at least one point. The rglyph given is the same as the one given by [`mutt_header_rglyph`](#glyph-header-to-rglyph) for the glyph.
+
 			// @DOCLINE ### TrueType metrics to rglyph metrics
 
 				// @DOCLINE The function `mutt_rglyph_metrics` fills in the metric information about a TrueType-to-rglyph conversion, converting the TrueType glyph's metrics to the pixel-unit equivalents for the rglyph, defined below: @NLNT
@@ -2445,6 +3003,13 @@ mutt is developed primarily off of these sources of documentation:
 
 				// @DOCLINE The values `rglyph->ascender`, `rglyph->descender`, `rglyph->lsb`, and `rglyph->advance_width` are filled in. `glyph_id` must be a valid glyph ID. The x/y min/max values within `header` must be accurate.
 
+			// @DOCLINE ### Batch glyph metrics
+
+				// @DOCLINE The function `mutt_glyph_metrics_batch` converts the advance width and left-side bearing of many glyphs to pixel units at once, defined below: @NLNT
+				MUDEF void mutt_glyph_metrics_batch(muttFont* font, uint16_m* glyph_ids, uint32_m count, float point_size, float ppi, float* advances, float* lsbs);
+
+				// @DOCLINE `glyph_ids` is an array of `count` glyph IDs, each of which must be valid, and `advances` and `lsbs` are arrays of `count` values that the advance width and left-side bearing of each glyph are written to, either of which can be 0 if it isn't needed. The values are the same as the ones given by [`mutt_rglyph_metrics`](#truetype-metrics-to-rglyph-metrics). The lookup is branch-free if the font was loaded with [`MUTT_LOAD_DENSE`](#font-load-modes), and the conversion to pixel units is done with [SIMD](#simd) instructions if available. The hmtx and head tables must be loaded.
+
 			// @DOCLINE ### TrueType x/y min/max to rglyph x/y max
 
 				// @DOCLINE The function `mutt_funits_punits_min_max` converts a set of x/y min/max values, in FUnits (usually retrieved from loading a simple/composite glyph, with said values being stored in the header), to what an rglyph's x/y maximum values will be when converting it to an rglyph, defined below: @NLNT
@@ -2475,6 +3040,14 @@ mutt is developed primarily off of these sources of documentation:
 			#define MUTT_FAILED_REALLOC 2
 			// @DOCLINE * `MUTT_FAILED_FIND_TABLE` - the table could not be located, and is likely not included in the font file.
 			#define MUTT_FAILED_FIND_TABLE 3
+			// @DOCLINE * `MUTT_FAILED_OPEN_FILE` - the font file could not be opened or its size could not be retrieved.
+			#define MUTT_FAILED_OPEN_FILE 4
+			// @DOCLINE * `MUTT_FAILED_MAP_FILE` - the font file could not be mapped into memory, or file mapping isn't supported on this system.
+			#define MUTT_FAILED_MAP_FILE 5
+			// @DOCLINE * `MUTT_FAILED_READ` - the read callback of a [streamed font](#loading-a-font-stream) failed.
+			#define MUTT_FAILED_READ 6
+			// @DOCLINE * `MUTT_FAILED_ARENA` - the [arena](#arenas) given didn't have enough memory left to perform the task.
+			#define MUTT_FAILED_ARENA 7
 
 		// @DOCLINE ### Directory result values
 		// 64 -> 127 //
@@ -2703,6 +3276,40 @@ mutt is developed primarily off of these sources of documentation:
 
 			// @DOCLINE * `MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_ARGUMENT2` - the process of converting a composite glyph to an rglyph failed because a simple glyph had an argument2 value giving a point number that was out of range for the child glyph.
 			#define MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_ARGUMENT2 646
+			// @DOCLINE * `MUTT_INVALID_RGLYPH_COMPOSITE_CYCLE` - the process of converting a composite glyph to an rglyph failed because a composite glyph had itself as a component, directly or through other composite components.
+			#define MUTT_INVALID_RGLYPH_COMPOSITE_CYCLE 647
+
+		// @DOCLINE ### Collection result values
+		// 704 -> 767 //
+
+			// @DOCLINE * `MUTT_INVALID_COLLECTION_LENGTH` - the length of the TTC header was invalid.
+			#define MUTT_INVALID_COLLECTION_LENGTH 704
+			// @DOCLINE * `MUTT_INVALID_COLLECTION_TAG` - the "ttcTag" value in the TTC header was not "ttcf" (and the data isn't a regular font file either).
+			#define MUTT_INVALID_COLLECTION_TAG 705
+			// @DOCLINE * `MUTT_INVALID_COLLECTION_VERSION` - the "majorVersion" value in the TTC header was not 1 or 2.
+			#define MUTT_INVALID_COLLECTION_VERSION 706
+			// @DOCLINE * `MUTT_INVALID_COLLECTION_NUM_FONTS` - the "numFonts" value in the TTC header was 0.
+			#define MUTT_INVALID_COLLECTION_NUM_FONTS 707
+			// @DOCLINE * `MUTT_INVALID_COLLECTION_TABLE_DIRECTORY_OFFSET` - a value in the "tableDirectoryOffsets" array of the TTC header was out of range.
+			#define MUTT_INVALID_COLLECTION_TABLE_DIRECTORY_OFFSET 708
+			// @DOCLINE * `MUTT_INVALID_COLLECTION_FACE_INDEX` - the face index given was not less than the amount of faces in the collection.
+			#define MUTT_INVALID_COLLECTION_FACE_INDEX 709
+
+		// @DOCLINE ### Cache result values
+		// 768 -> 831 //
+
+			// @DOCLINE * `MUTT_INVALID_CACHE_LENGTH` - the length of the cache was invalid.
+			#define MUTT_INVALID_CACHE_LENGTH 768
+			// @DOCLINE * `MUTT_INVALID_CACHE_MAGIC` - the data given wasn't a cache created by `mutt_font_serialize`.
+			#define MUTT_INVALID_CACHE_MAGIC 769
+			// @DOCLINE * `MUTT_INVALID_CACHE_VERSION` - the cache was created by a different version of mutt or for a different platform.
+			#define MUTT_INVALID_CACHE_VERSION 770
+			// @DOCLINE * `MUTT_INVALID_CACHE_FONT` - the font data given isn't the font data that the cache was created from.
+			#define MUTT_INVALID_CACHE_FONT 771
+			// @DOCLINE * `MUTT_CACHE_REQUIRES_DATA` - the cache references the font data, but no font data was given.
+			#define MUTT_CACHE_REQUIRES_DATA 772
+			// @DOCLINE * `MUTT_INVALID_CACHE_POINTER` - a pointer within the cache was out of range.
+			#define MUTT_INVALID_CACHE_POINTER 773
 
 		// @DOCLINE ## Check if result is fatal
 
@@ -2759,7 +3366,9 @@ mutt is developed primarily off of these sources of documentation:
 		#endif /* stdlib.h */
 
 		#if !defined(mu_memcpy) || \
-			!defined(mu_memset)
+			!defined(mu_memmove) || \
+			!defined(mu_memset) || \
+			!defined(mu_memcmp)
 
 			// @DOCLINE ## `string.h` dependencies
 			#include <string.h>
@@ -2769,11 +3378,21 @@ mutt is developed primarily off of these sources of documentation:
 				#define mu_memcpy memcpy
 			#endif
 
+			// @DOCLINE * `mu_memmove` - equivalent to `memmove`.
+			#ifndef mu_memmove
+				#define mu_memmove memmove
+			#endif
+
 			// @DOCLINE * `mu_memset`- equivalent to `memset`.
 			#ifndef mu_memset
 				#define mu_memset memset
 			#endif
 
+			// @DOCLINE * `mu_memcmp` - equivalent to `memcmp`.
+			#ifndef mu_memcmp
+				#define mu_memcmp memcmp
+			#endif
+
 		#endif /* string.h */
 
 		#if !defined(mu_fabsf) || \
@@ -2806,50 +3425,273 @@ mutt is developed primarily off of these sources of documentation:
 
 		#endif /* math.h */
 
+	// @DOCLINE # SIMD
+
+		// @DOCLINE Some parts of mutt (such as verifying table checksums) use SIMD instructions if the compiler is targeting an instruction set that supports them (AVX2, SSSE3, or SSE2), which is detected at compile time via the compiler's predefined macros (such as `__AVX2__`), meaning that the instruction sets used can be changed with the compiler's target flags (such as `-mavx2`). Every SIMD path has a scalar fallback that produces the same results, and `MUTT_NO_SIMD` can be defined before the implementation is included to always use the scalar fallbacks.
+
 	MU_CPP_EXTERN_END
 #endif /* MUTT_H */
 
 #ifdef MUTT_IMPLEMENTATION
+
+	/* File mapping dependencies */
+
+		#if defined(MU_WIN32)
+			#include <windows.h>
+		#elif defined(MU_LINUX) || defined(__unix__) || defined(__APPLE__)
+			#define MUTT_POSIX_FILES
+			#include <sys/mman.h>
+			#include <sys/stat.h>
+			#include <fcntl.h>
+			#include <unistd.h>
+			#include <sched.h>
+			#include <pthread.h>
+		#endif
+
+	/* SIMD dependencies */
+
+		// Picked at compile time based on what the compiler is targeting;
+		// define MUTT_NO_SIMD to always use the scalar versions.
+		#if !defined(MUTT_NO_SIMD)
+			#if defined(__AVX2__)
+				#define MUTT_AVX2
+				#include <immintrin.h>
+			#elif defined(__SSSE3__)
+				#define MUTT_SSSE3
+				#include <tmmintrin.h>
+			#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+				#define MUTT_SSE2
+				#include <emmintrin.h>
+			#endif
+		#endif
+
 	MU_CPP_EXTERN_START
 
-	/* Lower-level API */
+	/* Synchronization */
 
-		/* Checksum logic */
+		// Atomically loads a value (acquire)
+		uint32_m mutt_AtomicLoad(volatile uint32_m* p) {
+			#if defined(_MSC_VER) && !defined(__clang__)
+			return (uint32_m)_InterlockedOr((volatile long*)p, 0);
+			#else
+			return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+			#endif
+		}
 
-			// Verfifies the checksum of a given table
-			muBool mutt_VerifyTableChecksum(muByte* table, uint32_m length, uint32_m checksum) {
-				// Initial vars
-				uint32_m current_checksum = 0;
-				uint32_m off = length%4;
+		// Atomically stores a value (release)
+		void mutt_AtomicStore(volatile uint32_m* p, uint32_m v) {
+			#if defined(_MSC_VER) && !defined(__clang__)
+			_InterlockedExchange((volatile long*)p, (long)v);
+			#else
+			__atomic_store_n(p, v, __ATOMIC_RELEASE);
+			#endif
+		}
 
-				// Calculate end of table
-				muByte* end = &table[length];
+		// Atomically swaps a value if it's equal to an expected value
+		muBool mutt_AtomicCAS(volatile uint32_m* p, uint32_m expected, uint32_m desired) {
+			#if defined(_MSC_VER) && !defined(__clang__)
+			return _InterlockedCompareExchange((volatile long*)p, (long)desired, (long)expected) == (long)expected;
+			#else
+			return __atomic_compare_exchange_n(p, &expected, desired, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+			#endif
+		}
 
-				// Go through each u32 in the table data
-				while (table < end) {
-					// Handle if we're cutting into the end of the table unevenly:
-					if (off != 0 && (table+4) >= end) {
-						// 16-bit
-						if (off == 2) {
-							current_checksum += MU_RBEU16(table) << 16;
-						}
-						// 24-bit
-						else if (off == 3) {
-							current_checksum += MU_RBEU24(table) << 8;
-						}
-						// 8-bit
-						else {
-							current_checksum += table[0] << 24;
-						}
-					}
-					// Normal cut
-					else {
-						current_checksum += MU_RBEU32(table);
-					}
+		// Atomically adds to a value, returning the value before
+		uint32_m mutt_AtomicAdd(volatile uint32_m* p, uint32_m v) {
+			#if defined(_MSC_VER) && !defined(__clang__)
+			return (uint32_m)_InterlockedExchangeAdd((volatile long*)p, (long)v);
+			#else
+			return __atomic_fetch_add(p, v, __ATOMIC_ACQ_REL);
+			#endif
+		}
 
-					// Go to next u32
-					table += 4;
-				}
+		// Atomically sets bits of a value
+		void mutt_AtomicOr(volatile uint32_m* p, uint32_m v) {
+			#if defined(_MSC_VER) && !defined(__clang__)
+			_InterlockedOr((volatile long*)p, (long)v);
+			#else
+			__atomic_fetch_or(p, v, __ATOMIC_ACQ_REL);
+			#endif
+		}
+
+		// Atomically loads a pointer (acquire)
+		void* mutt_AtomicLoadPtr(void* volatile* p) {
+			#if defined(_MSC_VER) && !defined(__clang__)
+			return _InterlockedCompareExchangePointer(p, 0, 0);
+			#else
+			return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+			#endif
+		}
+
+		// Atomically stores a pointer (release)
+		void mutt_AtomicStorePtr(void* volatile* p, void* v) {
+			#if defined(_MSC_VER) && !defined(__clang__)
+			_InterlockedExchangePointer(p, v);
+			#else
+			__atomic_store_n(p, v, __ATOMIC_RELEASE);
+			#endif
+		}
+
+		// Gives up the rest of the thread's time slice
+		void mutt_Yield(void) {
+			#if defined(MU_WIN32)
+			SwitchToThread();
+			#elif defined(MUTT_POSIX_FILES)
+			sched_yield();
+			#endif
+		}
+
+		// Locks a spinlock
+		void mutt_SpinLock(volatile uint32_m* lock) {
+			while (!mutt_AtomicCAS(lock, 0, 1)) {
+				mutt_Yield();
+			}
+		}
+
+		// Unlocks a spinlock
+		void mutt_SpinUnlock(volatile uint32_m* lock) {
+			mutt_AtomicStore(lock, 0);
+		}
+
+	/* Lower-level API */
+
+		/* Arenas */
+
+			// Alignment of arena allocations
+			#define MUTT_ARENA_ALIGN 8
+			#define MUTT_ARENA_ALIGN_UP(n) ((((uint64_m)(n)) + (MUTT_ARENA_ALIGN-1)) & ~((uint64_m)(MUTT_ARENA_ALIGN-1)))
+
+			MUDEF void mutt_arena_init(muttArena* arena, muByte* data, uint64_m size) {
+				arena->data = data;
+				arena->size = size;
+				arena->used = 0;
+			}
+
+			MUDEF void* mutt_arena_alloc(muttArena* arena, uint64_m size) {
+				// Align start of allocation
+				// (The address is aligned, as the arena's memory itself may not be)
+				size_m misalign = ((size_m)(arena->data + arena->used)) & (MUTT_ARENA_ALIGN-1);
+				uint64_m start = arena->used + ((misalign) ?(MUTT_ARENA_ALIGN - misalign) :(0));
+				// Verify that it fits
+				if (start > arena->size || size > arena->size - start) {
+					return 0;
+				}
+				arena->used = start + size;
+				return arena->data + start;
+			}
+
+			MUDEF uint64_m mutt_arena_mark(muttArena* arena) {
+				return arena->used;
+			}
+
+			MUDEF void mutt_arena_reset(muttArena* arena, uint64_m mark) {
+				arena->used = mark;
+			}
+
+		/* Checksum logic */
+
+			// Sums big-endian u32s in bulk, returning how many bytes were summed
+			// (always a multiple of 4)
+			uint32_m mutt_ChecksumBulk(muByte* table, uint32_m length, uint32_m* sum) {
+				uint32_m i = 0;
+
+				#if defined(MUTT_AVX2)
+
+				// 32 bytes at a time; byte swap each u32, then add into lanes
+				const __m256i swap = _mm256_setr_epi8(
+					3,2,1,0, 7,6,5,4, 11,10,9,8, 15,14,13,12,
+					3,2,1,0, 7,6,5,4, 11,10,9,8, 15,14,13,12
+				);
+				__m256i acc = _mm256_setzero_si256();
+				for (; i+32 <= length; i += 32) {
+					__m256i v = _mm256_loadu_si256((const __m256i*)(table+i));
+					acc = _mm256_add_epi32(acc, _mm256_shuffle_epi8(v, swap));
+				}
+				// Add lanes together
+				__m128i acc4 = _mm_add_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+				acc4 = _mm_add_epi32(acc4, _mm_shuffle_epi32(acc4, _MM_SHUFFLE(1,0,3,2)));
+				acc4 = _mm_add_epi32(acc4, _mm_shuffle_epi32(acc4, _MM_SHUFFLE(2,3,0,1)));
+				*sum += (uint32_m)_mm_cvtsi128_si32(acc4);
+
+				#elif defined(MUTT_SSSE3) || defined(MUTT_SSE2)
+
+				// 16 bytes at a time; byte swap each u32, then add into lanes
+				#if defined(MUTT_SSSE3)
+				const __m128i swap = _mm_setr_epi8(3,2,1,0, 7,6,5,4, 11,10,9,8, 15,14,13,12);
+				#endif
+				__m128i acc = _mm_setzero_si128();
+				for (; i+16 <= length; i += 16) {
+					__m128i v = _mm_loadu_si128((const __m128i*)(table+i));
+					#if defined(MUTT_SSSE3)
+					v = _mm_shuffle_epi8(v, swap);
+					#else
+					// (No byte shuffle; swap bytes in each u16, then swap the u16s)
+					v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+					v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2,3,0,1));
+					v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2,3,0,1));
+					#endif
+					acc = _mm_add_epi32(acc, v);
+				}
+				// Add lanes together
+				acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1,0,3,2)));
+				acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2,3,0,1)));
+				*sum += (uint32_m)_mm_cvtsi128_si32(acc);
+
+				#else
+
+				// 16 bytes at a time in independent sums
+				uint32_m s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+				for (; i+16 <= length; i += 16) {
+					s0 += MU_RBEU32(table+i);
+					s1 += MU_RBEU32(table+i+4);
+					s2 += MU_RBEU32(table+i+8);
+					s3 += MU_RBEU32(table+i+12);
+				}
+				*sum += s0 + s1 + s2 + s3;
+
+				#endif
+
+				return i;
+			}
+
+			// Verfifies the checksum of a given table
+			muBool mutt_VerifyTableChecksum(muByte* table, uint32_m length, uint32_m checksum) {
+				// Initial vars
+				uint32_m current_checksum = 0;
+				uint32_m off = length%4;
+
+				// Sum most of the table in bulk
+				uint32_m bulk = mutt_ChecksumBulk(table, length, &current_checksum);
+
+				// Calculate end of table
+				muByte* end = &table[length];
+				table += bulk;
+
+				// Go through each remaining u32 in the table data
+				while (table < end) {
+					// Handle if we're cutting into the end of the table unevenly:
+					if (off != 0 && (table+4) >= end) {
+						// 16-bit
+						if (off == 2) {
+							current_checksum += MU_RBEU16(table) << 16;
+						}
+						// 24-bit
+						else if (off == 3) {
+							current_checksum += MU_RBEU24(table) << 8;
+						}
+						// 8-bit
+						else {
+							current_checksum += table[0] << 24;
+						}
+					}
+					// Normal cut
+					else {
+						current_checksum += MU_RBEU32(table);
+					}
+
+					// Go to next u32
+					table += 4;
+				}
 
 				// Verify that checksum matches
 				if (checksum != current_checksum) {
@@ -2858,17 +3700,324 @@ mutt is developed primarily off of these sources of documentation:
 				return MU_TRUE;
 			}
 
+		/* Table memory */
+
+			// A block of table memory; the data follows the header.
+			// Blocks are chained if a block runs out of room, which only
+			// happens if the estimate given at load time was too low, or
+			// when tables are required after an eager load.
+			typedef struct muttTableBlock muttTableBlock;
+			struct muttTableBlock {
+				muttTableBlock* next; // Previous block in chain
+				size_m cap;  // Capacity of the data, in bytes
+				size_m used; // Bytes of the data used
+			};
+
+			// Every allocation is prefixed by its (aligned) size so that the
+			// last allocation can be given back
+			#define MUTT_TABLE_ALIGN 16
+			#define MUTT_TABLE_ALIGN_UP(n) ((((size_m)(n))+(MUTT_TABLE_ALIGN-1)) & ~((size_m)(MUTT_TABLE_ALIGN-1)))
+			#define MUTT_TABLE_BLOCK_HEADER MUTT_TABLE_ALIGN_UP(sizeof(muttTableBlock))
+			#define MUTT_TABLE_ALLOC_HEADER MUTT_TABLE_ALIGN
+			#define MUTT_TABLE_ALLOC_SIZE(n) (MUTT_TABLE_ALLOC_HEADER + MUTT_TABLE_ALIGN_UP(n))
+			// Smallest block created once the first block runs out of room
+			#define MUTT_TABLE_MIN_BLOCK 4096
+
+			// Creates a new block and puts it at the front of the chain
+			muBool mutt_TableBlockCreate(muttFont* font, size_m cap) {
+				muttTableBlock* block = (muttTableBlock*)mu_malloc(MUTT_TABLE_BLOCK_HEADER + cap);
+				if (!block) {
+					return MU_FALSE;
+				}
+				block->next = (muttTableBlock*)font->memory;
+				block->cap = cap;
+				block->used = 0;
+				font->memory = block;
+				return MU_TRUE;
+			}
+
+			// Allocates table memory
+			void* mutt_TableAlloc(muttFont* font, size_m size) {
+				size_m total = MUTT_TABLE_ALLOC_SIZE(size);
+
+				// Make a new block if the current one can't fit this
+				muttTableBlock* block = (muttTableBlock*)font->memory;
+				if (!block || block->cap - block->used < total) {
+					if (!mutt_TableBlockCreate(font, (total > MUTT_TABLE_MIN_BLOCK) ?(total) :(MUTT_TABLE_MIN_BLOCK))) {
+						return 0;
+					}
+					block = (muttTableBlock*)font->memory;
+				}
+
+				// Bump
+				muByte* mem = ((muByte*)block) + MUTT_TABLE_BLOCK_HEADER + block->used;
+				*(size_m*)mem = total;
+				block->used += total;
+				return mem + MUTT_TABLE_ALLOC_HEADER;
+			}
+
+			// Frees table memory
+			// Memory is only actually given back if it was the last allocation
+			// made; any other memory is reclaimed once the font is deloaded.
+			void mutt_TableFree(muttFont* font, void* p) {
+				muttTableBlock* block = (muttTableBlock*)font->memory;
+				muByte* mem = ((muByte*)p) - MUTT_TABLE_ALLOC_HEADER;
+				if (block && mem + *(size_m*)mem == ((muByte*)block) + MUTT_TABLE_BLOCK_HEADER + block->used) {
+					block->used -= *(size_m*)mem;
+				}
+			}
+
+			// Keeps the largest block of a chain of old table memory for the font
+			// to use, making a new block instead if it can't fit the given capacity
+			muBool mutt_TableBlockReuse(muttFont* font, void* memory, size_m cap) {
+				// Find largest block, freeing the rest
+				muttTableBlock* largest = 0;
+				muttTableBlock* block = (muttTableBlock*)memory;
+				while (block) {
+					muttTableBlock* next = block->next;
+					if (!largest || block->cap > largest->cap) {
+						mu_free(largest);
+						largest = block;
+					} else {
+						mu_free(block);
+					}
+					block = next;
+				}
+
+				// Reuse it if it's big enough
+				if (largest && largest->cap >= cap) {
+					largest->next = (muttTableBlock*)font->memory;
+					largest->used = 0;
+					font->memory = largest;
+					return MU_TRUE;
+				}
+				mu_free(largest);
+				return mutt_TableBlockCreate(font, cap);
+			}
+
+			// Frees all table memory in a chain of blocks
+			void mutt_TableMemoryFree(void* memory) {
+				muttTableBlock* block = (muttTableBlock*)memory;
+				while (block) {
+					muttTableBlock* next = block->next;
+					mu_free(block);
+					block = next;
+				}
+			}
+
+			// Returns the table memory needed for a cmap table
+			size_m mutt_CmapMemory(muByte* data, uint32_m datalen) {
+				size_m size = MUTT_TABLE_ALLOC_SIZE(sizeof(muttCmap));
+				if (datalen < 4) {
+					return size;
+				}
+
+				// Encoding records
+				uint32_m num_tables = MU_RBEU16(data+2);
+				if (4+(num_tables*8) > datalen) {
+					return size;
+				}
+				size += MUTT_TABLE_ALLOC_SIZE(sizeof(muttEncodingRecord)*num_tables);
+
+				// Each encoding record's format
+				for (uint32_m t = 0; t < num_tables; ++t) {
+					uint32_m offset = MU_RBEU32(data+4+(t*8)+4);
+					if ((uint64_m)offset+2 > datalen) {
+						continue;
+					}
+					muByte* sub = data+offset;
+					uint32_m sublen = datalen-offset;
+
+					switch (MU_RBEU16(sub)) {
+						default: break;
+						// Format 0
+						case 0: size += MUTT_TABLE_ALLOC_SIZE(sizeof(muttCmap0)); break;
+						// Format 4; segments + glyph IDs, which can't be longer than the subtable
+						case 4: {
+							size += MUTT_TABLE_ALLOC_SIZE(sizeof(muttCmap4));
+							if (sublen >= 14) {
+								size += MUTT_TABLE_ALLOC_SIZE(sizeof(muttCmap4Segment)*(MU_RBEU16(sub+6)/2));
+								size += MUTT_TABLE_ALLOC_SIZE(MU_RBEU16(sub+2));
+								size += MUTT_TABLE_ALLOC_SIZE(2*(MU_RBEU16(sub+6)/2));
+							}
+						} break;
+						// Format 12; groups, which can't outnumber what fits in the subtable
+						case 12: {
+							size += MUTT_TABLE_ALLOC_SIZE(sizeof(muttCmap12));
+							if (sublen >= 16) {
+								uint32_m num_groups = MU_RBEU32(sub+12);
+								if (num_groups > sublen/12) {
+									num_groups = sublen/12;
+								}
+								size += MUTT_TABLE_ALLOC_SIZE(sizeof(muttCmap12Group)*num_groups);
+							}
+						} break;
+					}
+				}
+
+				return size;
+			}
+
+			// Returns the table memory needed for a name table
+			size_m mutt_NameMemory(muByte* data, uint32_m datalen, muttLoadFlags mode_flags) {
+				size_m size = MUTT_TABLE_ALLOC_SIZE(sizeof(muttName));
+				if (datalen < 6) {
+					return size;
+				}
+
+				// String storage
+				uint16_m storage_offset = MU_RBEU16(data+4);
+				if (storage_offset < datalen && !(mode_flags & MUTT_LOAD_BORROW)) {
+					size += MUTT_TABLE_ALLOC_SIZE(datalen-storage_offset);
+				}
+				// Name records
+				uint32_m count = MU_RBEU16(data+2);
+				size += MUTT_TABLE_ALLOC_SIZE(sizeof(muttNameRecord)*count);
+				// Lang tag records
+				uint32_m lang_tag_offset = 6+(count*12);
+				if (MU_RBEU16(data) == 1 && lang_tag_offset+2 <= datalen) {
+					size += MUTT_TABLE_ALLOC_SIZE(sizeof(muttLangTagRecord)*MU_RBEU16(data+lang_tag_offset));
+				}
+
+				return size;
+			}
+
+			// Returns the table memory needed for a font's directory (at the given
+			// offset) and the given tables, reading the directory straight out of
+			// the data. This is never too low for a valid font (expanded hmtx/loca
+			// are never bigger than their raw data), and anything invalid is
+			// rejected during load.
+			size_m mutt_TableMemory(muByte* data, uint64_m datalen, uint64_m dir_offset, muttLoadFlags tables, muttLoadFlags mode_flags) {
+				// Directory
+				if (datalen < dir_offset+12) {
+					return 0;
+				}
+				uint32_m num_tables = MU_RBEU16(data+dir_offset+4);
+				if (datalen < dir_offset+12+((uint64_m)num_tables*16)) {
+					return 0;
+				}
+				size_m size = MUTT_TABLE_ALLOC_SIZE(sizeof(muttDirectory)) + MUTT_TABLE_ALLOC_SIZE(sizeof(muttTableRecord)*num_tables) + MUTT_TABLE_ALLOC_SIZE(sizeof(uint64_m)*num_tables);
+
+				// Each table record
+				for (uint32_m i = 0; i < num_tables; ++i) {
+					muByte* rec = data+dir_offset+12+(i*16);
+					uint32_m offset = MU_RBEU32(rec+8);
+					uint32_m length = MU_RBEU32(rec+12);
+					if ((uint64_m)offset+length > datalen) {
+						continue;
+					}
+
+					switch (MU_RBEU32(rec)) {
+						default: break;
+						// maxp
+						case 0x6D617870: if (tables & MUTT_LOAD_MAXP) {
+							size += MUTT_TABLE_ALLOC_SIZE(sizeof(muttMaxp));
+						} break;
+						// head
+						case 0x68656164: if (tables & MUTT_LOAD_HEAD) {
+							size += MUTT_TABLE_ALLOC_SIZE(sizeof(muttHead));
+						} break;
+						// hhea
+						case 0x68686561: if (tables & MUTT_LOAD_HHEA) {
+							size += MUTT_TABLE_ALLOC_SIZE(sizeof(muttHhea));
+						} break;
+						// hmtx; hMetrics + leftSideBearings
+						case 0x686D7478: if (tables & MUTT_LOAD_HMTX) {
+							size += MUTT_TABLE_ALLOC_SIZE(sizeof(muttHmtx));
+							// (Dense; two arrays of 2 bytes per glyph, which the length is at least)
+							if (mode_flags & MUTT_LOAD_DENSE) {
+								size += MUTT_TABLE_ALLOC_SIZE(length) * 2;
+							}
+							// (Compact; raw copy if not borrowed)
+							else if (mode_flags & MUTT_LOAD_COMPACT) {
+								if (!(mode_flags & MUTT_LOAD_BORROW)) {
+									size += MUTT_TABLE_ALLOC_SIZE(length);
+								}
+							}
+							// (Two allocations sharing the length, each of which can be rounded up)
+							else {
+								size += MUTT_TABLE_ALLOC_SIZE(length) + MUTT_TABLE_ALLOC_SIZE(MUTT_TABLE_ALIGN);
+							}
+						} break;
+						// loca; offsets (unless compact and borrowed)
+						case 0x6C6F6361: if (tables & MUTT_LOAD_LOCA) {
+							size += MUTT_TABLE_ALLOC_SIZE(sizeof(muttLoca));
+							if ((mode_flags & (MUTT_LOAD_COMPACT|MUTT_LOAD_BORROW)) != (MUTT_LOAD_COMPACT|MUTT_LOAD_BORROW)) {
+								size += MUTT_TABLE_ALLOC_SIZE(length);
+							}
+						} break;
+						// name
+						case 0x6E616D65: if (tables & MUTT_LOAD_NAME) {
+							size += mutt_NameMemory(&data[offset], length, mode_flags);
+						} break;
+						// glyf; copy of data if not borrowed
+						case 0x676C7966: if (tables & MUTT_LOAD_GLYF) {
+							size += MUTT_TABLE_ALLOC_SIZE(sizeof(muttGlyf));
+							if (!(mode_flags & MUTT_LOAD_BORROW)) {
+								size += MUTT_TABLE_ALLOC_SIZE(length);
+							}
+						} break;
+						// cmap
+						case 0x636D6170: if (tables & MUTT_LOAD_CMAP) {
+							size += mutt_CmapMemory(&data[offset], length);
+						} break;
+					}
+				}
+
+				return size;
+			}
+
 		/* Table directory */
 
-			// Loads the table directory
-			// Note: if fails, still call mutt_DeloadTableDirectory
-			muttResult mutt_LoadTableDirectory(muttDirectory* dir, muByte* data, uint64_m datalen) {
+			// Sifts a key down a max-heap of the first n keys
+			void mutt_SiftKey(uint64_m* keys, uint32_m root, uint32_m n) {
+				for (;;) {
+					// Get larger child
+					uint32_m child = (root*2) + 1;
+					if (child >= n) {
+						return;
+					}
+					if (child+1 < n && keys[child+1] > keys[child]) {
+						++child;
+					}
+					// Swap with it if it's larger
+					if (keys[root] >= keys[child]) {
+						return;
+					}
+					uint64_m t = keys[root];
+					keys[root] = keys[child];
+					keys[child] = t;
+					root = child;
+				}
+			}
+
+			// Sorts keys in increasing order (heapsort, since it needs no memory
+			// and no amount of keys can make it slow)
+			void mutt_SortKeys(uint64_m* keys, uint32_m count) {
+				// Build heap
+				for (uint32_m i = count/2; i > 0; --i) {
+					mutt_SiftKey(keys, i-1, count);
+				}
+				// Move largest key off of heap one at a time
+				for (uint32_m n = count; n > 1; --n) {
+					uint64_m t = keys[0];
+					keys[0] = keys[n-1];
+					keys[n-1] = t;
+					mutt_SiftKey(keys, 0, n-1);
+				}
+			}
+
+			// Loads the table directory at the given offset
+			// (Table offsets are always relative to the start of the data)
+			muttResult mutt_LoadTableDirectory(muttFont* font, muttDirectory* dir, muByte* data, uint64_m datalen, uint64_m dir_offset) {
 				muByte* orig_data = data;
 
 				// Verify min. length
-				if (datalen < 12) {
+				if (datalen < dir_offset+12) {
 					return MUTT_INVALID_DIRECTORY_LENGTH;
 				}
+				data += dir_offset;
+				dir->offset = dir_offset;
 
 				// Read & verify sfntVersion
 				if (MU_RBEU32(data) != 0x00010000) {
@@ -2883,13 +4032,14 @@ mutt is developed primarily off of these sources of documentation:
 				}
 
 				// Verify length based on numTables
-				if (datalen < (uint64_m)(12+(dir->num_tables*16))) {
+				if (datalen < dir_offset+12+((uint64_m)dir->num_tables*16)) {
 					return MUTT_INVALID_DIRECTORY_LENGTH;
 				}
 
-				// Allocate table records
-				dir->records = (muttTableRecord*)mu_malloc(sizeof(muttTableRecord)*dir->num_tables);
-				if (!dir->records) {
+				// Allocate table records and their sorted tags
+				dir->records = (muttTableRecord*)mutt_TableAlloc(font, sizeof(muttTableRecord)*dir->num_tables);
+				dir->sorted = (uint64_m*)mutt_TableAlloc(font, sizeof(uint64_m)*dir->num_tables);
+				if (!dir->records || !dir->sorted) {
 					return MUTT_FAILED_MALLOC;
 				}
 
@@ -2921,13 +4071,6 @@ mutt is developed primarily off of these sources of documentation:
 						case 0x636D6170: load_flags |= MUTT_LOAD_CMAP; break;
 					}
 
-					// Make sure this table tag is not a duplicate
-					for (muttTableRecord* c = dir->records; c < rec; ++c) {
-						if (rec->table_tag_u32 == c->table_tag_u32) {
-							return MUTT_INVALID_DIRECTORY_RECORD_TABLE_TAG;
-						}
-					}
-
 					// Read checksum
 					rec->checksum = MU_RBEU32(data+4);
 
@@ -2945,9 +4088,10 @@ mutt is developed primarily off of these sources of documentation:
 						return MUTT_INVALID_DIRECTORY_RECORD_LENGTH;
 					}
 
-					// Verify checksum
+					// Verify checksum (unless skipped)
 					// Note: we're not performing this for head, its checksum HAS a checksum in it so it's weird
-					if (rec->table_tag_u32 != 0x68656164 &&
+					if (!(font->mode_flags & MUTT_LOAD_SKIP_CHECKSUMS) &&
+						rec->table_tag_u32 != 0x68656164 &&
 						!mutt_VerifyTableChecksum(&orig_data[rec->offset], rec->length, rec->checksum)
 					) {
 						return MUTT_INVALID_DIRECTORY_RECORD_CHECKSUM;
@@ -2957,6 +4101,20 @@ mutt is developed primarily off of these sources of documentation:
 					data += 16;
 				}
 
+				// Sort tags (with the index of their record) so that they can be binary searched
+				// (Records are left in file order)
+				for (uint16_m r = 0; r < dir->num_tables; ++r) {
+					dir->sorted[r] = (((uint64_m)dir->records[r].table_tag_u32) << 32) | r;
+				}
+				mutt_SortKeys(dir->sorted, dir->num_tables);
+
+				// Make sure no table tag is a duplicate (which would be adjacent once sorted)
+				for (uint16_m r = 1; r < dir->num_tables; ++r) {
+					if ((dir->sorted[r] >> 32) == (dir->sorted[r-1] >> 32)) {
+						return MUTT_INVALID_DIRECTORY_RECORD_TABLE_TAG;
+					}
+				}
+
 				// Check that all required tables were loaded
 				if ((load_flags & MUTT_LOAD_REQUIRED) != MUTT_LOAD_REQUIRED) {
 					return MUTT_MISSING_DIRECTORY_RECORD_TABLE_TAGS;
@@ -2965,12 +4123,26 @@ mutt is developed primarily off of these sources of documentation:
 				return MUTT_SUCCESS;
 			}
 
-			// Deloads the table directory
-			void mutt_DeloadTableDirectory(muttDirectory* dir) {
-				// Free table records if they exist
-				if (dir->records) {
-					mu_free(dir->records);
+			MUDEF muttTableRecord* mutt_find_table(muttFont* font, uint32_m tag) {
+				if (!font->directory) {
+					return 0;
+				}
+
+				// Binary search sorted tags
+				uint64_m* sorted = font->directory->sorted;
+				uint32_m low = 0, high = font->directory->num_tables;
+				while (low < high) {
+					uint32_m mid = low + ((high-low)/2);
+					uint32_m mid_tag = (uint32_m)(sorted[mid] >> 32);
+					if (mid_tag < tag) {
+						low = mid+1;
+					} else if (mid_tag > tag) {
+						high = mid;
+					} else {
+						return &font->directory->records[sorted[mid] & 0xFFFF];
+					}
 				}
+				return 0;
 			}
 
 		/* Basic tables */
@@ -2978,40 +4150,40 @@ mutt is developed primarily off of these sources of documentation:
 			// Loads the maxp table
 			muttResult mutt_LoadMaxp(muttFont* font, muByte* data, uint32_m datalen) {
 				// Allocate maxp
-				muttMaxp* maxp = (muttMaxp*)mu_malloc(sizeof(muttMaxp));
+				muttMaxp* maxp = (muttMaxp*)mutt_TableAlloc(font, sizeof(muttMaxp));
 				if (!maxp) {
 					return MUTT_FAILED_MALLOC;
 				}
 
 				// Verify min. length for version
 				if (datalen < 4) {
-					mu_free(maxp);
+					mutt_TableFree(font, maxp);
 					return MUTT_INVALID_MAXP_LENGTH;
 				}
 
 				// Version high
 				maxp->version_high = MU_RBEU16(data);
 				if (maxp->version_high != 0x0001) {
-					mu_free(maxp);
+					mutt_TableFree(font, maxp);
 					return MUTT_INVALID_MAXP_VERSION;
 				}
 				// Version low
 				maxp->version_low = MU_RBEU16(data+2);
 				if (maxp->version_low != 0x0000) {
-					mu_free(maxp);
+					mutt_TableFree(font, maxp);
 					return MUTT_INVALID_MAXP_VERSION;
 				}
 
 				// Verify min. length
 				if (datalen < 32) {
-					mu_free(maxp);
+					mutt_TableFree(font, maxp);
 					return MUTT_INVALID_MAXP_LENGTH;
 				}
 
 				// numGlyphs
 				maxp->num_glyphs = MU_RBEU16(data+4);
 				if (maxp->num_glyphs < 2) {
-					mu_free(maxp);
+					mutt_TableFree(font, maxp);
 					return MUTT_INVALID_MAXP_NUM_GLYPHS;
 				}
 
@@ -3026,7 +4198,7 @@ mutt is developed primarily off of these sources of documentation:
 				// maxZones
 				maxp->max_zones = MU_RBEU16(data+14);
 				if (maxp->max_zones != 1 && maxp->max_zones != 2) {
-					mu_free(maxp);
+					mutt_TableFree(font, maxp);
 					return MUTT_INVALID_MAXP_MAX_ZONES;
 				}
 				// maxTwilightPoints
@@ -3053,26 +4225,26 @@ mutt is developed primarily off of these sources of documentation:
 			// Loads the head table
 			muttResult mutt_LoadHead(muttFont* font, muByte* data, uint32_m datalen) {
 				// Allocate head
-				muttHead* head = (muttHead*)mu_malloc(sizeof(muttHead));
+				muttHead* head = (muttHead*)mutt_TableAlloc(font, sizeof(muttHead));
 				if (!head) {
 					return MUTT_FAILED_MALLOC;
 				}
 
 				// Verify min. length for version
 				if (datalen < 4) {
-					mu_free(head);
+					mutt_TableFree(font, head);
 					return MUTT_INVALID_HEAD_LENGTH;
 				}
 
 				// Verify version
 				if (MU_RBEU16(data) != 1 || MU_RBEU16(data+2) != 0) {
-					mu_free(head);
+					mutt_TableFree(font, head);
 					return MUTT_INVALID_HEAD_VERSION;
 				}
 
 				// Verify min. length for rest of table
 				if (datalen < 54) {
-					mu_free(head);
+					mutt_TableFree(font, head);
 					return MUTT_INVALID_HEAD_LENGTH;
 				}
 
@@ -3084,7 +4256,7 @@ mutt is developed primarily off of these sources of documentation:
 
 				// magicNumber
 				if (MU_RBEU32(data+12) != 0x5F0F3CF5) {
-					mu_free(head);
+					mutt_TableFree(font, head);
 					return MUTT_INVALID_HEAD_MAGIC_NUMBER;
 				}
 
@@ -3094,7 +4266,7 @@ mutt is developed primarily off of these sources of documentation:
 				// unitsPerEm
 				head->units_per_em = MU_RBEU16(data+18);
 				if (head->units_per_em < 16 || head->units_per_em > 16384) {
-					mu_free(head);
+					mutt_TableFree(font, head);
 					return MUTT_INVALID_HEAD_UNITS_PER_EM;
 				}
 
@@ -3105,32 +4277,32 @@ mutt is developed primarily off of these sources of documentation:
 				// xMin + yMin
 				head->x_min = MU_RBES16(data+36);
 				if (head->x_min < -16384 || head->x_min > 16383) {
-					mu_free(head);
+					mutt_TableFree(font, head);
 					return MUTT_INVALID_HEAD_X_MIN_COORDINATES;
 				}
 				head->y_min = MU_RBES16(data+38);
 				if (head->y_min < -16384 || head->y_min > 16383) {
-					mu_free(head);
+					mutt_TableFree(font, head);
 					return MUTT_INVALID_HEAD_Y_MIN_COORDINATES;
 				}
 				// xMax + yMax
 				head->x_max = MU_RBES16(data+40);
 				if (head->x_max < -16384 || head->x_max > 16383) {
-					mu_free(head);
+					mutt_TableFree(font, head);
 					return MUTT_INVALID_HEAD_X_MAX_COORDINATES;
 				}
 				head->y_max = MU_RBES16(data+42);
 				if (head->y_max < -16384 || head->y_max > 16383) {
-					mu_free(head);
+					mutt_TableFree(font, head);
 					return MUTT_INVALID_HEAD_Y_MAX_COORDINATES;
 				}
 				// + Verify min/max
 				if (head->x_min > head->x_max) {
-					mu_free(head);
+					mutt_TableFree(font, head);
 					return MUTT_INVALID_HEAD_X_MIN_MAX;
 				}
 				if (head->y_min > head->y_max) {
-					mu_free(head);
+					mutt_TableFree(font, head);
 					return MUTT_INVALID_HEAD_Y_MIN_MAX;
 				}
 
@@ -3143,13 +4315,13 @@ mutt is developed primarily off of these sources of documentation:
 				// indexToLocFormat
 				head->index_to_loc_format = MU_RBES16(data+50);
 				if (head->index_to_loc_format != 0 && head->index_to_loc_format != 1) {
-					mu_free(head);
+					mutt_TableFree(font, head);
 					return MUTT_INVALID_HEAD_INDEX_TO_LOC_FORMAT;
 				}
 
 				// glyphDataFormat
 				if (MU_RBES16(data+52) != 0) {
-					mu_free(head);
+					mutt_TableFree(font, head);
 					return MUTT_INVALID_HEAD_GLYPH_DATA_FORMAT;
 				}
 
@@ -3161,26 +4333,26 @@ mutt is developed primarily off of these sources of documentation:
 			// Req: maxp
 			muttResult mutt_LoadHhea(muttFont* font, muByte* data, uint32_m datalen) {
 				// Allocate hhea
-				muttHhea* hhea = (muttHhea*)mu_malloc(sizeof(muttHhea));
+				muttHhea* hhea = (muttHhea*)mutt_TableAlloc(font, sizeof(muttHhea));
 				if (!hhea) {
 					return MUTT_FAILED_MALLOC;
 				}
 
 				// Verify min. length for version
 				if (datalen < 4) {
-					mu_free(hhea);
+					mutt_TableFree(font, hhea);
 					return MUTT_INVALID_HHEA_LENGTH;
 				}
 
 				// Verify version
 				if (MU_RBEU16(data) != 1 || MU_RBEU16(data+2) != 0) {
-					mu_free(hhea);
+					mutt_TableFree(font, hhea);
 					return MUTT_INVALID_HHEA_VERSION;
 				}
 
 				// Verify min. length
 				if (datalen < 36) {
-					mu_free(hhea);
+					mutt_TableFree(font, hhea);
 					return MUTT_INVALID_HHEA_LENGTH;
 				}
 
@@ -3204,7 +4376,7 @@ mutt is developed primarily off of these sources of documentation:
 
 				// metricDataFormat
 				if (MU_RBES16(data+32) != 0) {
-					mu_free(hhea);
+					mutt_TableFree(font, hhea);
 					return MUTT_INVALID_HHEA_METRIC_DATA_FORMAT;
 				}
 
@@ -3212,7 +4384,7 @@ mutt is developed primarily off of these sources of documentation:
 				hhea->number_of_hmetrics = MU_RBEU16(data+34);
 				// - numGlyphs-numberOfHMetrics must be valid for leftSideBearings in hmtx
 				if (hhea->number_of_hmetrics > font->maxp->num_glyphs) {
-					mu_free(hhea);
+					mutt_TableFree(font, hhea);
 					return MUTT_INVALID_HHEA_NUMBER_OF_HMETRICS;
 				}
 
@@ -3222,9 +4394,30 @@ mutt is developed primarily off of these sources of documentation:
 
 		/* Allocated tables */
 
+			// Returns raw table data to be kept by a compact table; the data
+			// itself if borrowed, and a copy of it otherwise
+			muByte* mutt_RawTable(muttFont* font, muByte* data, uint32_m length) {
+				if (font->mode_flags & MUTT_LOAD_BORROW) {
+					return data;
+				}
+				muByte* raw = (muByte*)mutt_TableAlloc(font, (length) ?(length) :(1));
+				if (raw) {
+					mu_memcpy(raw, data, length);
+				}
+				return raw;
+			}
+
+			// Frees raw table data given by mutt_RawTable
+			void mutt_RawTableFree(muttFont* font, muByte* raw) {
+				// (Borrowed table memory isn't ours to free)
+				if (!(font->mode_flags & MUTT_LOAD_BORROW)) {
+					mutt_TableFree(font, raw);
+				}
+			}
+
 			// Loads the hmtx table
 			// Req: maxp, hhea
-			void mutt_DeloadHmtx(muttHmtx* hmtx);
+			void mutt_DeloadHmtx(muttFont* font, muttHmtx* hmtx);
 			muttResult mutt_LoadHmtx(muttFont* font, muByte* data, uint32_m datalen) {
 				// Verify length
 				if (datalen <
@@ -3237,21 +4430,74 @@ mutt is developed primarily off of these sources of documentation:
 				}
 
 				// Allocate
-				muttHmtx* hmtx = (muttHmtx*)mu_malloc(sizeof(muttHmtx));
+				muttHmtx* hmtx = (muttHmtx*)mutt_TableAlloc(font, sizeof(muttHmtx));
 				if (!hmtx) {
-					// mutt_DeloadHmtx(hmtx);
 					return MUTT_FAILED_MALLOC;
 				}
 				hmtx->hmetrics = 0;
 				hmtx->left_side_bearings = 0;
+				hmtx->raw = 0;
+				hmtx->advances = 0;
+				hmtx->lsbs = 0;
+
+				// Dense; expand to per-glyph arrays
+				if (font->mode_flags & MUTT_LOAD_DENSE) {
+					uint16_m num_glyphs = font->maxp->num_glyphs;
+					uint16_m num_hmetrics = font->hhea->number_of_hmetrics;
+					if (num_glyphs == 0) {
+						font->hmtx = hmtx;
+						return MUTT_SUCCESS;
+					}
+
+					// Allocate
+					hmtx->advances = (uint16_m*)mutt_TableAlloc(font, ((uint32_m)num_glyphs)*2);
+					if (!hmtx->advances) {
+						mutt_DeloadHmtx(font, hmtx);
+						return MUTT_FAILED_MALLOC;
+					}
+					hmtx->lsbs = (int16_m*)mutt_TableAlloc(font, ((uint32_m)num_glyphs)*2);
+					if (!hmtx->lsbs) {
+						mutt_DeloadHmtx(font, hmtx);
+						return MUTT_FAILED_MALLOC;
+					}
+
+					// hMetrics
+					uint16_m advance = 0;
+					for (uint16_m h = 0; h < num_hmetrics; ++h) {
+						advance = MU_RBEU16(data);
+						hmtx->advances[h] = advance;
+						hmtx->lsbs[h] = MU_RBES16(data+2);
+						data += 4;
+					}
+					// leftSideBearings; last advance width carries over
+					for (uint32_m g = num_hmetrics; g < num_glyphs; ++g) {
+						hmtx->advances[g] = advance;
+						hmtx->lsbs[g] = MU_RBES16(data);
+						data += 2;
+					}
+
+					font->hmtx = hmtx;
+					return MUTT_SUCCESS;
+				}
+
+				// Compact; keep raw data
+				if (font->mode_flags & MUTT_LOAD_COMPACT) {
+					hmtx->raw = mutt_RawTable(font, data, (4*(uint32_m)font->hhea->number_of_hmetrics) + (2*(uint32_m)(font->maxp->num_glyphs-font->hhea->number_of_hmetrics)));
+					if (!hmtx->raw) {
+						mutt_DeloadHmtx(font, hmtx);
+						return MUTT_FAILED_MALLOC;
+					}
+					font->hmtx = hmtx;
+					return MUTT_SUCCESS;
+				}
 
 				// Allocate hMetrics
 				if (font->hhea->number_of_hmetrics == 0) {
 					hmtx->hmetrics = 0;
 				} else {
-					hmtx->hmetrics = (muttLongHorMetric*)mu_malloc(sizeof(muttLongHorMetric)*font->hhea->number_of_hmetrics);
+					hmtx->hmetrics = (muttLongHorMetric*)mutt_TableAlloc(font, sizeof(muttLongHorMetric)*font->hhea->number_of_hmetrics);
 					if (!hmtx->hmetrics) {
-						mutt_DeloadHmtx(hmtx);
+						mutt_DeloadHmtx(font, hmtx);
 						return MUTT_FAILED_MALLOC;
 					}
 				}
@@ -3261,9 +4507,9 @@ mutt is developed primarily off of these sources of documentation:
 				if (lsb_len == 0) {
 					hmtx->left_side_bearings = 0;
 				} else {
-					hmtx->left_side_bearings = (int16_m*)mu_malloc(lsb_len*2);
+					hmtx->left_side_bearings = (int16_m*)mutt_TableAlloc(font, lsb_len*2);
 					if (!hmtx->left_side_bearings) {
-						mutt_DeloadHmtx(hmtx);
+						mutt_DeloadHmtx(font, hmtx);
 						return MUTT_FAILED_MALLOC;
 					}
 				}
@@ -3291,26 +4537,76 @@ mutt is developed primarily off of these sources of documentation:
 			}
 
 			// Deloads the hmtx table
-			void mutt_DeloadHmtx(muttHmtx* hmtx) {
+			// (Freed in reverse order of allocation so that the memory is reclaimed)
+			void mutt_DeloadHmtx(muttFont* font, muttHmtx* hmtx) {
 				if (hmtx) {
-					if (hmtx->hmetrics) {
-						mu_free(hmtx->hmetrics);
+					if (hmtx->lsbs) {
+						mutt_TableFree(font, hmtx->lsbs);
+					}
+					if (hmtx->advances) {
+						mutt_TableFree(font, hmtx->advances);
+					}
+					if (hmtx->raw) {
+						mutt_RawTableFree(font, hmtx->raw);
 					}
 					if (hmtx->left_side_bearings) {
-						mu_free(hmtx->left_side_bearings);
+						mutt_TableFree(font, hmtx->left_side_bearings);
+					}
+					if (hmtx->hmetrics) {
+						mutt_TableFree(font, hmtx->hmetrics);
+					}
+					mutt_TableFree(font, hmtx);
+				}
+			}
+
+			MUDEF uint16_m mutt_glyph_advance(muttFont* font, uint16_m glyph_id) {
+				if (font->mode_flags & MUTT_LOAD_DENSE) {
+					return font->hmtx->advances[glyph_id];
+				}
+
+				// Glyphs past hMetrics use the last advance width
+				uint16_m num_hmetrics = font->hhea->number_of_hmetrics;
+				if (num_hmetrics == 0) {
+					return 0;
+				}
+				if (glyph_id >= num_hmetrics) {
+					glyph_id = num_hmetrics-1;
+				}
+
+				if (font->mode_flags & MUTT_LOAD_COMPACT) {
+					return MU_RBEU16(font->hmtx->raw + ((uint32_m)glyph_id)*4);
+				}
+				return font->hmtx->hmetrics[glyph_id].advance_width;
+			}
+
+			MUDEF int16_m mutt_glyph_lsb(muttFont* font, uint16_m glyph_id) {
+				if (font->mode_flags & MUTT_LOAD_DENSE) {
+					return font->hmtx->lsbs[glyph_id];
+				}
+
+				uint16_m num_hmetrics = font->hhea->number_of_hmetrics;
+
+				// In hMetrics
+				if (glyph_id < num_hmetrics) {
+					if (font->mode_flags & MUTT_LOAD_COMPACT) {
+						return MU_RBES16(font->hmtx->raw + ((uint32_m)glyph_id)*4 + 2);
 					}
-					mu_free(hmtx);
+					return font->hmtx->hmetrics[glyph_id].lsb;
+				}
+				// In leftSideBearings
+				if (font->mode_flags & MUTT_LOAD_COMPACT) {
+					return MU_RBES16(font->hmtx->raw + ((uint32_m)num_hmetrics)*4 + ((uint32_m)(glyph_id-num_hmetrics))*2);
 				}
+				return font->hmtx->left_side_bearings[glyph_id-num_hmetrics];
 			}
 
 			// Loads the loca table
 			// Req: maxp, head, glyf
-			void mutt_DeloadLoca(muttLoca* loca);
+			void mutt_DeloadLoca(muttFont* font, muttLoca* loca);
 			muttResult mutt_LoadLoca(muttFont* font, muByte* data, uint32_m datalen) {
 				// Allocate
-				muttLoca* loca = (muttLoca*)mu_malloc(sizeof(muttLoca));
+				muttLoca* loca = (muttLoca*)mutt_TableAlloc(font, sizeof(muttLoca));
 				if (!loca) {
-					// mutt_DeloadLoca(loca);
 					return MUTT_FAILED_MALLOC;
 				}
 				mu_memset(loca, 0, sizeof(muttLoca));
@@ -3318,32 +4614,61 @@ mutt is developed primarily off of these sources of documentation:
 				// Get offsets count
 				uint32_m offsets = ((uint32_m)font->maxp->num_glyphs) + 1;
 
-				// Allocate offsets
-				// - 16-bit
-				if (font->head->index_to_loc_format == MUTT_OFFSET_16) {
-					// - Verify 16-bit length
-					if (datalen < offsets*2) {
-						mutt_DeloadLoca(loca);
+				// Compact; verify offsets, then keep raw data
+				if (font->mode_flags & MUTT_LOAD_COMPACT) {
+					muBool short_offsets = font->head->index_to_loc_format == MUTT_OFFSET_16;
+					uint32_m size = offsets * ((short_offsets) ?(2) :(4));
+					if (datalen < size) {
+						mutt_DeloadLoca(font, loca);
 						return MUTT_INVALID_LOCA_LENGTH;
 					}
-					// - Allocate
-					loca->offsets16 = (uint16_m*)mu_malloc(offsets*2);
-					if (!loca->offsets16) {
-						mutt_DeloadLoca(loca);
-						return MUTT_FAILED_MALLOC;
+
+					uint32_m prev = 0;
+					for (uint32_m o = 0; o < offsets; ++o) {
+						uint32_m offset = (short_offsets) ?(((uint32_m)MU_RBEU16(data+(o*2)))*2) :(MU_RBEU32(data+(o*4)));
+						// Verify incremental order, and that offset is within range of glyf
+						if (offset < prev || offset > font->glyf->len) {
+							mutt_DeloadLoca(font, loca);
+							return MUTT_INVALID_LOCA_OFFSET;
+						}
+						prev = offset;
+					}
+
+					loca->raw = mutt_RawTable(font, data, size);
+					if (!loca->raw) {
+						mutt_DeloadLoca(font, loca);
+						return MUTT_FAILED_MALLOC;
+					}
+					font->loca = loca;
+					return MUTT_SUCCESS;
+				}
+
+				// Allocate offsets
+				// - 16-bit
+				if (font->head->index_to_loc_format == MUTT_OFFSET_16) {
+					// - Verify 16-bit length
+					if (datalen < offsets*2) {
+						mutt_DeloadLoca(font, loca);
+						return MUTT_INVALID_LOCA_LENGTH;
+					}
+					// - Allocate
+					loca->offsets16 = (uint16_m*)mutt_TableAlloc(font, offsets*2);
+					if (!loca->offsets16) {
+						mutt_DeloadLoca(font, loca);
+						return MUTT_FAILED_MALLOC;
 					}
 				}
 				// 32-bit
 				else {
 					// - Verify 32-bit length
 					if (datalen < offsets*4) {
-						mutt_DeloadLoca(loca);
+						mutt_DeloadLoca(font, loca);
 						return MUTT_INVALID_LOCA_LENGTH;
 					}
 					// - Allocate
-					loca->offsets32 = (uint32_m*)mu_malloc(offsets*4);
+					loca->offsets32 = (uint32_m*)mutt_TableAlloc(font, offsets*4);
 					if (!loca->offsets32) {
-						mutt_DeloadLoca(loca);
+						mutt_DeloadLoca(font, loca);
 						return MUTT_FAILED_MALLOC;
 					}
 				}
@@ -3357,13 +4682,13 @@ mutt is developed primarily off of these sources of documentation:
 						data += 2;
 						// Verify incremental order
 						if (o > 0 && loca->offsets16[o-1] > loca->offsets16[o]) {
-							mutt_DeloadLoca(loca);
+							mutt_DeloadLoca(font, loca);
 							return MUTT_INVALID_LOCA_OFFSET;
 						}
 						// Verify offset is within range of glyf
 						uint32_m offset = ((uint32_m)loca->offsets16[o]) * 2;
 						if (offset > font->glyf->len) {
-							mutt_DeloadLoca(loca);
+							mutt_DeloadLoca(font, loca);
 							return MUTT_INVALID_LOCA_OFFSET;
 						}
 					}
@@ -3376,12 +4701,12 @@ mutt is developed primarily off of these sources of documentation:
 						data += 4;
 						// Verify incremental order
 						if (o > 0 && loca->offsets32[o-1] > loca->offsets32[o]) {
-							mutt_DeloadLoca(loca);
+							mutt_DeloadLoca(font, loca);
 							return MUTT_INVALID_LOCA_OFFSET;
 						}
 						// Verify offset is within range of glyf
 						if (loca->offsets32[o] > font->glyf->len) {
-							mutt_DeloadLoca(loca);
+							mutt_DeloadLoca(font, loca);
 							return MUTT_INVALID_LOCA_OFFSET;
 						}
 					}
@@ -3392,21 +4717,39 @@ mutt is developed primarily off of these sources of documentation:
 			}
 
 			// Deloads the loca table
-			void mutt_DeloadLoca(muttLoca* loca) {
+			void mutt_DeloadLoca(muttFont* font, muttLoca* loca) {
 				if (loca) {
 					// I THINK this works with 32 as well...
-					if (loca->offsets16) {
-						mu_free(loca->offsets16);
+					if (loca->raw && (font->mode_flags & MUTT_LOAD_COMPACT)) {
+						mutt_RawTableFree(font, loca->raw);
+					}
+					else if (loca->offsets16) {
+						mutt_TableFree(font, loca->offsets16);
+					}
+					mutt_TableFree(font, loca);
+				}
+			}
+
+			MUDEF uint32_m mutt_loca_offset(muttFont* font, uint32_m glyph_id) {
+				// Compact
+				if (font->mode_flags & MUTT_LOAD_COMPACT) {
+					if (font->head->index_to_loc_format == MUTT_OFFSET_16) {
+						return ((uint32_m)MU_RBEU16(font->loca->raw + glyph_id*2)) * 2;
 					}
-					mu_free(loca);
+					return MU_RBEU32(font->loca->raw + glyph_id*4);
+				}
+				// Expanded
+				if (font->head->index_to_loc_format == MUTT_OFFSET_16) {
+					return ((uint32_m)font->loca->offsets16[glyph_id]) * 2;
 				}
+				return font->loca->offsets32[glyph_id];
 			}
 
 			// Loads the name table
-			void mutt_DeloadName(muttName* name);
+			void mutt_DeloadName(muttFont* font, muttName* name);
 			muttResult mutt_LoadName(muttFont* font, muByte* data, uint32_m datalen) {
 				// Allocate
-				muttName* name = (muttName*)mu_malloc(sizeof(muttName));
+				muttName* name = (muttName*)mutt_TableAlloc(font, sizeof(muttName));
 				if (!name) {
 					return MUTT_FAILED_MALLOC;
 				}
@@ -3414,20 +4757,20 @@ mutt is developed primarily off of these sources of documentation:
 
 				// Verify min. length for version
 				if (datalen < 2) {
-					mutt_DeloadName(name);
+					mutt_DeloadName(font, name);
 					return MUTT_INVALID_NAME_LENGTH;
 				}
 
 				// Verify version
 				name->version = MU_RBEU16(data);
 				if (name->version != 0 && name->version != 1) {
-					mutt_DeloadName(name);
+					mutt_DeloadName(font, name);
 					return MUTT_INVALID_NAME_VERSION;
 				}
 
 				// Verify min. length for version, count, and storage offset
 				if (datalen < 6) {
-					mutt_DeloadName(name);
+					mutt_DeloadName(font, name);
 					return MUTT_INVALID_NAME_LENGTH;
 				}
 
@@ -3436,25 +4779,32 @@ mutt is developed primarily off of these sources of documentation:
 				uint16_m storage_offset = MU_RBEU16(data+4);
 				// Verify length for storage offset
 				if (storage_offset > datalen) {
-					mutt_DeloadName(name);
+					mutt_DeloadName(font, name);
 					return MUTT_INVALID_NAME_STORAGE_OFFSET;
 				}
 				// Verify length for nameRecord and storage
 				uint32_m req = 6+(name->count*12)+(datalen-storage_offset);
 				if (datalen < req) {
-					mutt_DeloadName(name);
+					mutt_DeloadName(font, name);
 					return MUTT_INVALID_NAME_LENGTH;
 				}
 
 				// Allocate and fill storage (if necessary)
 				uint32_m storage_len = datalen-storage_offset;
 				if (storage_len) {
-					name->string_data = (muByte*)mu_malloc(storage_len);
-					if (!name->string_data) {
-						mutt_DeloadName(name);
-						return MUTT_FAILED_MALLOC;
+					// - Borrowed; point to storage directly
+					if (font->mode_flags & MUTT_LOAD_BORROW) {
+						name->string_data = &data[storage_offset];
+					}
+					// - Copied
+					else {
+						name->string_data = (muByte*)mutt_TableAlloc(font, storage_len);
+						if (!name->string_data) {
+							mutt_DeloadName(font, name);
+							return MUTT_FAILED_MALLOC;
+						}
+						mu_memcpy(name->string_data, &data[storage_offset], storage_len);
 					}
-					mu_memcpy(name->string_data, &data[storage_offset], storage_len);
 				}
 
 				// Move up data
@@ -3463,9 +4813,9 @@ mutt is developed primarily off of these sources of documentation:
 				// If we have name records:
 				if (name->count) {
 					// Allocate name records
-					name->name_records = (muttNameRecord*)mu_malloc(sizeof(muttNameRecord)*((size_m)name->count));
+					name->name_records = (muttNameRecord*)mutt_TableAlloc(font, sizeof(muttNameRecord)*((size_m)name->count));
 					if (!name->name_records) {
-						mutt_DeloadName(name);
+						mutt_DeloadName(font, name);
 						return MUTT_FAILED_MALLOC;
 					}
 
@@ -3483,7 +4833,7 @@ mutt is developed primarily off of these sources of documentation:
 						// Get & verify offset + length
 						uint16_m offset = MU_RBEU16(data+10);
 						if (offset+rp->length > storage_len) {
-							mutt_DeloadName(name);
+							mutt_DeloadName(font, name);
 							return MUTT_INVALID_NAME_LENGTH_OFFSET;
 						}
 
@@ -3499,7 +4849,7 @@ mutt is developed primarily off of these sources of documentation:
 					// Verify length for langTagCount
 					req += 2;
 					if (datalen < req) {
-						mutt_DeloadName(name);
+						mutt_DeloadName(font, name);
 						return MUTT_INVALID_NAME_LENGTH;
 					}
 					// Get langTagCount
@@ -3508,7 +4858,7 @@ mutt is developed primarily off of these sources of documentation:
 					// Verify length for langTagRecord
 					req += name->lang_tag_count*4;
 					if (datalen < req) {
-						mutt_DeloadName(name);
+						mutt_DeloadName(font, name);
 						return MUTT_INVALID_NAME_LENGTH;
 					}
 				}
@@ -3516,9 +4866,9 @@ mutt is developed primarily off of these sources of documentation:
 				// If we have lang tags:
 				if (name->lang_tag_count) {
 					// Allocate lang tags
-					name->lang_tag_records = (muttLangTagRecord*)mu_malloc(sizeof(muttLangTagRecord)*((size_m)name->lang_tag_count));
+					name->lang_tag_records = (muttLangTagRecord*)mutt_TableAlloc(font, sizeof(muttLangTagRecord)*((size_m)name->lang_tag_count));
 					if (!name->lang_tag_records) {
-						mutt_DeloadName(name);
+						mutt_DeloadName(font, name);
 						return MUTT_FAILED_MALLOC;
 					}
 
@@ -3532,7 +4882,7 @@ mutt is developed primarily off of these sources of documentation:
 						// Get & verify offset + length
 						uint16_m offset = MU_RBEU16(data+2);
 						if (offset+lr->length > storage_len) {
-							mutt_DeloadName(name);
+							mutt_DeloadName(font, name);
 							return MUTT_INVALID_NAME_LENGTH_OFFSET;
 						}
 
@@ -3548,26 +4898,28 @@ mutt is developed primarily off of these sources of documentation:
 			}
 
 			// Frees all allocated data for name
-			void mutt_DeloadName(muttName* name) {
+			// (Freed in reverse order of allocation so that the memory is reclaimed)
+			void mutt_DeloadName(muttFont* font, muttName* name) {
 				if (name) {
-					if (name->name_records) {
-						mu_free(name->name_records);
-					}
 					if (name->lang_tag_records) {
-						mu_free(name->lang_tag_records);
+						mutt_TableFree(font, name->lang_tag_records);
+					}
+					if (name->name_records) {
+						mutt_TableFree(font, name->name_records);
 					}
-					if (name->string_data) {
-						mu_free(name->string_data);
+					// (Borrowed string data isn't ours to free)
+					if (name->string_data && !(font->mode_flags & MUTT_LOAD_BORROW)) {
+						mutt_TableFree(font, name->string_data);
 					}
-					mu_free(name);
+					mutt_TableFree(font, name);
 				}
 			}
 
 			// Loads the glyf table
-			void mutt_DeloadGlyf(muttGlyf* glyf);
+			void mutt_DeloadGlyf(muttFont* font, muttGlyf* glyf);
 			muttResult mutt_LoadGlyf(muttFont* font, muByte* data, uint32_m datalen) {
 				// Allocate glyf
-				muttGlyf* glyf = (muttGlyf*)mu_malloc(sizeof(muttGlyf));
+				muttGlyf* glyf = (muttGlyf*)mutt_TableAlloc(font, sizeof(muttGlyf));
 				if (!glyf) {
 					return MUTT_FAILED_MALLOC;
 				}
@@ -3576,11 +4928,16 @@ mutt is developed primarily off of these sources of documentation:
 				// Get glyf length
 				glyf->len = datalen;
 
-				if (glyf->len) {
+				// Borrowed; point to table memory directly
+				if (font->mode_flags & MUTT_LOAD_BORROW) {
+					glyf->data = (glyf->len) ?(data) :(0);
+				}
+				// Copied
+				else if (glyf->len) {
 					// Allocate glyf data
-					glyf->data = (muByte*)mu_malloc(glyf->len);
+					glyf->data = (muByte*)mutt_TableAlloc(font, glyf->len);
 					if (!glyf->data) {
-						mutt_DeloadGlyf(glyf);
+						mutt_DeloadGlyf(font, glyf);
 						return MUTT_FAILED_MALLOC;
 					}
 
@@ -3593,12 +4950,13 @@ mutt is developed primarily off of these sources of documentation:
 			}
 
 			// Frees all allocated data for glyf
-			void mutt_DeloadGlyf(muttGlyf* glyf) {
+			void mutt_DeloadGlyf(muttFont* font, muttGlyf* glyf) {
 				if (glyf) {
-					if (glyf->data) {
-						mu_free(glyf->data);
+					// (Borrowed table memory isn't ours to free)
+					if (glyf->data && !(font->mode_flags & MUTT_LOAD_BORROW)) {
+						mutt_TableFree(font, glyf->data);
 					}
-					mu_free(glyf);
+					mutt_TableFree(font, glyf);
 				}
 			}
 
@@ -3653,7 +5011,7 @@ mutt is developed primarily off of these sources of documentation:
 			/* Format 4 */
 
 				// Loads format 4
-				void mutt_f4Deload(muttCmap4* f4);
+				void mutt_f4Deload(muttFont* font, muttCmap4* f4);
 				muttResult mutt_f4Load(muttFont* font, muttCmap4* f4, muByte* data, uint32_m datalen) {
 					// Verify length for format...rangeShift
 					// 32 is ok because length is u16 in subtable
@@ -3679,7 +5037,10 @@ mutt is developed primarily off of these sources of documentation:
 					// - Edge case for seg_count being 0
 					if (f4->seg_count == 0) {
 						f4->seg = 0;
+						f4->end_codes = 0;
+						f4->overlapping = MU_FALSE;
 						f4->glyph_ids = 0;
+						f4->glyph_id_count = 0;
 						return MUTT_SUCCESS;
 					}
 
@@ -3697,18 +5058,27 @@ mutt is developed primarily off of these sources of documentation:
 						glyph_id_array_len -= 1;
 					}
 					glyph_id_array_len /= 2;
+					f4->glyph_id_count = glyph_id_array_len;
 
 					// Allocate segments
-					f4->seg = (muttCmap4Segment*)mu_malloc(f4->seg_count*sizeof(muttCmap4Segment));
+					f4->seg = (muttCmap4Segment*)mutt_TableAlloc(font, f4->seg_count*sizeof(muttCmap4Segment));
 					if (!f4->seg) {
 						return MUTT_FAILED_MALLOC;
 					}
 					// Allocate glyph IDs
-					f4->glyph_ids = (uint16_m*)mu_malloc(glyph_id_array_len*2);
+					f4->glyph_ids = (uint16_m*)mutt_TableAlloc(font, glyph_id_array_len*2);
 					if (!f4->glyph_ids) {
-						mu_free(f4->seg);
+						mutt_TableFree(font, f4->seg);
+						return MUTT_FAILED_MALLOC;
+					}
+					// Allocate end codes
+					f4->end_codes = (uint16_m*)mutt_TableAlloc(font, f4->seg_count*2);
+					if (!f4->end_codes) {
+						mutt_TableFree(font, f4->glyph_ids);
+						mutt_TableFree(font, f4->seg);
 						return MUTT_FAILED_MALLOC;
 					}
+					f4->overlapping = MU_FALSE;
 
 					// Placeholder values for progress in data:
 					muByte* end_code = data+14;
@@ -3731,17 +5101,17 @@ mutt is developed primarily off of these sources of documentation:
 						muttCmap4Segment* ps = &f4->seg[s];
 
 						// endCode
-						ps->end_code = MU_RBEU16(end_code);
+						ps->end_code = f4->end_codes[s] = MU_RBEU16(end_code);
 						// - Verify incremental
 						if (s > 0) {
 							if (ps->end_code <= (ps-1)->end_code) {
-								mutt_f4Deload(f4);
+								mutt_f4Deload(font, f4);
 								return MUTT_INVALID_CMAP4_END_CODE;
 							}
 						}
 						// - Verify last = 0xFFFF
 						if (s+1 == f4->seg_count && ps->end_code != 0xFFFF) {
-							mutt_f4Deload(f4);
+							mutt_f4Deload(font, f4);
 							return MUTT_INVALID_CMAP4_LAST_END_CODE;
 						}
 
@@ -3749,9 +5119,13 @@ mutt is developed primarily off of these sources of documentation:
 						ps->start_code = MU_RBEU16(start_code);
 						// - Verify startCode <= endCode
 						if (ps->start_code > ps->end_code) {
-							mutt_f4Deload(f4);
+							mutt_f4Deload(font, f4);
 							return MUTT_INVALID_CMAP4_START_CODE;
 						}
+						// - Note if it starts within the previous segment
+						if (s > 0 && ps->start_code <= (ps-1)->end_code) {
+							f4->overlapping = MU_TRUE;
+						}
 
 						// idDelta
 						ps->id_delta = MU_RBES16(id_delta);
@@ -3764,7 +5138,7 @@ mutt is developed primarily off of these sources of documentation:
 							// - Divide by 2 to account for 2-byte-per offset
 							if ((ps->id_range_offset%2) != 0) {
 								// Not divisible by 2 :L
-								mutt_f4Deload(f4);
+								mutt_f4Deload(font, f4);
 								return MUTT_INVALID_CMAP4_ID_RANGE_OFFSET;
 							}
 							ps->id_range_offset /= 2;
@@ -3772,13 +5146,13 @@ mutt is developed primarily off of these sources of documentation:
 							//   (only applies if idRangeOffset is not 0)
 							if (ps->id_range_offset < f4->seg_count-s) {
 								// Offset is out of range (before glyphIdArray)
-								mutt_f4Deload(f4);
+								mutt_f4Deload(font, f4);
 								return MUTT_INVALID_CMAP4_ID_RANGE_OFFSET;
 							}
 							ps->id_range_offset -= f4->seg_count-s;
 							// - Ensure within range of glyphIdArray at max distance from it
 							if (ps->id_range_offset + (ps->start_code - ps->end_code) >= glyph_id_array_len) {
-								mutt_f4Deload(f4);
+								mutt_f4Deload(font, f4);
 								return MUTT_INVALID_CMAP4_ID_RANGE_OFFSET;
 							}
 
@@ -3815,48 +5189,86 @@ mutt is developed primarily off of these sources of documentation:
 				}
 
 				// Deloads format 4
-				void mutt_f4Deload(muttCmap4* f4) {
+				// (Freed in reverse order of allocation so that the memory is reclaimed)
+				void mutt_f4Deload(muttFont* font, muttCmap4* f4) {
 					if (f4) {
-						if (f4->seg) {
-							mu_free(f4->seg);
+						if (f4->end_codes) {
+							mutt_TableFree(font, f4->end_codes);
 						}
 						if (f4->glyph_ids) {
-							mu_free(f4->glyph_ids);
+							mutt_TableFree(font, f4->glyph_ids);
+						}
+						if (f4->seg) {
+							mutt_TableFree(font, f4->seg);
 						}
 						// (Purposely not freeing f4)
 					}
 				}
 
+				// Gives the glyph ID of a codepoint within the given segment
+				uint16_m mutt_f4SegmentGlyph(muttFont* font, muttCmap4* f4, muttCmap4Segment* seg, uint16_m codepoint) {
+					uint16_m glyph;
+
+					// If idRangeOffset is 0, we're only performing delta logic
+					if (seg->id_range_offset_orig == 0) {
+						glyph = mutt_id_delta(codepoint, seg->id_delta);
+					}
+					// If idRangeOffset isn't 0, we must index into glyphIdArray
+					else {
+						// (This is verified to be valid in mutt_f4Load)
+						glyph = f4->glyph_ids[seg->id_range_offset+(codepoint-seg->start_code)];
+						// + idDelta if not 0
+						if (glyph != 0) {
+							glyph = mutt_id_delta(glyph, seg->id_delta);
+						}
+					}
+
+					// Give glyph if it's valid
+					if (glyph < font->maxp->num_glyphs) {
+						return glyph;
+					}
+					return 0;
+				}
+
 				// Codepoint -> glyph ID
 				MUDEF uint16_m mutt_cmap4_get_glyph(muttFont* font, muttCmap4* f4, uint16_m codepoint) {
-					// Loop through each segment
-					for (uint16_m s = 0; s < f4->seg_count; ++s) {
-						// Continue on if the codepoint is not within this segment
-						if (codepoint < f4->seg[s].start_code || codepoint > f4->seg[s].end_code) {
-							continue;
-						}
-						// If we're here, the segment contains our codepoint
-						uint16_m glyph;
-						muttCmap4Segment* seg = &f4->seg[s];
+					if (f4->seg_count == 0) {
+						return 0;
+					}
+
+					// Find the first segment whose end code is at or after the codepoint
+					// (One always exists, as the last end code is 0xFFFF; the comparison only
+					// picks the next base, so it compiles to a conditional move)
+					uint16_m* base = f4->end_codes;
+					uint32_m n = f4->seg_count;
+					while (n > 1) {
+						uint32_m half = n / 2;
+						base = (base[half-1] < codepoint) ?(base + half) :(base);
+						n -= half;
+					}
+					uint32_m s = (uint32_m)(base - f4->end_codes);
 
-						// If idRangeOffset is 0, we're only performing delta logic
-						if (seg->id_range_offset_orig == 0) {
-							glyph = mutt_id_delta(codepoint, seg->id_delta);
+					// Return glyph if the segment contains the codepoint
+					muttCmap4Segment* seg = &f4->seg[s];
+					if (codepoint >= seg->start_code) {
+						uint16_m glyph = mutt_f4SegmentGlyph(font, f4, seg, codepoint);
+						if (glyph != 0) {
+							return glyph;
 						}
-						// If idRangeOffset isn't 0, we must index into glyphIdArray
-						else {
-							// (This is verified to be valid in mutt_f4Load)
-							glyph = f4->glyph_ids[seg->id_range_offset+(codepoint-seg->start_code)];
-							// + idDelta if not 0
+					}
+
+					// Later segments can only contain it if segments overlap
+					if (f4->overlapping) {
+						for (++s; s < f4->seg_count; ++s) {
+							seg = &f4->seg[s];
+							if (codepoint < seg->start_code) {
+								continue;
+							}
+							uint16_m glyph = mutt_f4SegmentGlyph(font, f4, seg, codepoint);
 							if (glyph != 0) {
-								glyph = mutt_id_delta(glyph, seg->id_delta);
+								return glyph;
 							}
 						}
-
-						// Return glyph if it's valid and not 0
-						if (glyph < font->maxp->num_glyphs && glyph != 0) {
-							return glyph;
-						}
 					}
 
 					// Codepoint does not lie within a defined segment
@@ -3888,7 +5300,7 @@ mutt is developed primarily off of these sources of documentation:
 			/* Format 12 */
 
 				// Loads format 12
-				void mutt_f12Deload(muttCmap12* f12);
+				void mutt_f12Deload(muttFont* font, muttCmap12* f12);
 				muttResult mutt_f12Load(muttFont* font, muttCmap12* f12, muByte* data, uint32_m datalen) {
 					// Verify length for format...numGroups
 					uint64_m req = 16;
@@ -3918,7 +5330,7 @@ mutt is developed primarily off of these sources of documentation:
 						return MUTT_INVALID_CMAP12_LENGTH;
 					}
 					// Allocate groups
-					f12->groups = (muttCmap12Group*)mu_malloc(sizeof(muttCmap12Group)*f12->num_groups);
+					f12->groups = (muttCmap12Group*)mutt_TableAlloc(font, sizeof(muttCmap12Group)*f12->num_groups);
 					if (!f12->groups) {
 						return MUTT_FAILED_MALLOC;
 					}
@@ -3935,12 +5347,12 @@ mutt is developed primarily off of these sources of documentation:
 						if (g > 0) {
 							// Verify incremental startCharCode ordering
 							if (f12->groups[g].start_char_code <= f12->groups[g-1].start_char_code) {
-								mutt_f12Deload(f12);
+								mutt_f12Deload(font, f12);
 								return MUTT_INVALID_CMAP12_START_CHAR_CODE;
 							}
 							// Verify [-1].end < [0].start
 							if (f12->groups[g-1].end_char_code >= f12->groups[g].start_char_code) {
-								mutt_f12Deload(f12);
+								mutt_f12Deload(font, f12);
 								return MUTT_INVALID_CMAP12_END_CHAR_CODE;
 							}
 						}
@@ -3955,9 +5367,9 @@ mutt is developed primarily off of these sources of documentation:
 				}
 
 				// Deloads format 12
-				void mutt_f12Deload(muttCmap12* f12) {
+				void mutt_f12Deload(muttFont* font, muttCmap12* f12) {
 					if (f12->groups) {
-						mu_free(f12->groups);
+						mutt_TableFree(font, f12->groups);
 						// (Purposely not freeing f12)
 					}
 				}
@@ -4016,14 +5428,14 @@ mutt is developed primarily off of these sources of documentation:
 						// Format 0
 						case 0: {
 							// Allocate
-							pformat->f0 = (muttCmap0*)mu_malloc(sizeof(muttCmap0));
+							pformat->f0 = (muttCmap0*)mutt_TableAlloc(font, sizeof(muttCmap0));
 							if (!pformat->f0) {
 								return MUTT_FAILED_MALLOC;
 							}
 							// Load
 							muttResult res = mutt_f0Load(font, pformat->f0, data, datalen);
 							if (mutt_result_is_fatal(res)) {
-								mu_free(pformat->f0);
+								mutt_TableFree(font, pformat->f0);
 								pformat->f0 = 0;
 							}
 							return res;
@@ -4032,14 +5444,14 @@ mutt is developed primarily off of these sources of documentation:
 						// Format 4
 						case 4: {
 							// Allocate
-							pformat->f4 = (muttCmap4*)mu_malloc(sizeof(muttCmap4));
+							pformat->f4 = (muttCmap4*)mutt_TableAlloc(font, sizeof(muttCmap4));
 							if (!pformat->f4) {
 								return MUTT_FAILED_MALLOC;
 							}
 							// Load
 							muttResult res = mutt_f4Load(font, pformat->f4, data, datalen);
 							if (mutt_result_is_fatal(res)) {
-								mu_free(pformat->f4);
+								mutt_TableFree(font, pformat->f4);
 								pformat->f4 = 0;
 							}
 							return res;
@@ -4048,14 +5460,14 @@ mutt is developed primarily off of these sources of documentation:
 						// Format 12
 						case 12: {
 							// Allocate
-							pformat->f12 = (muttCmap12*)mu_malloc(sizeof(muttCmap12));
+							pformat->f12 = (muttCmap12*)mutt_TableAlloc(font, sizeof(muttCmap12));
 							if (!pformat->f12) {
 								return MUTT_FAILED_MALLOC;
 							}
 							// Load
 							muttResult res = mutt_f12Load(font, pformat->f12, data, datalen);
 							if (mutt_result_is_fatal(res)) {
-								mu_free(pformat->f12);
+								mutt_TableFree(font, pformat->f12);
 								pformat->f12 = 0;
 							}
 							return res;
@@ -4064,30 +5476,30 @@ mutt is developed primarily off of these sources of documentation:
 				}
 
 				// Deloads a given format
-				void mutt_DeloadCmapFormat(uint16_m format, muttCmapFormat* pformat) {
+				void mutt_DeloadCmapFormat(muttFont* font, uint16_m format, muttCmapFormat* pformat) {
 					switch (format) {
 						default: break;
 
 						// Format 0
 						case 0: {
 							// Deallocate
-							mu_free(pformat->f0);
+							mutt_TableFree(font, pformat->f0);
 						} break;
 
 						// Format 4
 						case 4: {
 							// Deload
-							mutt_f4Deload(pformat->f4);
+							mutt_f4Deload(font, pformat->f4);
 							// Deallocate
-							mu_free(pformat->f4);
+							mutt_TableFree(font, pformat->f4);
 						} break;
 
 						// Format 12
 						case 12: {
 							// Deload
-							mutt_f12Deload(pformat->f12);
+							mutt_f12Deload(font, pformat->f12);
 							// Deallocate
-							mu_free(pformat->f12);
+							mutt_TableFree(font, pformat->f12);
 						} break;
 					}
 				}
@@ -4125,7 +5537,7 @@ mutt is developed primarily off of these sources of documentation:
 			/* Cmap */
 
 				// Loads the cmap table
-				void mutt_DeloadCmap(muttCmap* cmap);
+				void mutt_DeloadCmap(muttFont* font, muttCmap* cmap);
 				muttResult mutt_LoadCmap(muttFont* font, muByte* data, uint32_m datalen) {
 					// Placeholder values
 					muByte* orig_data = data;
@@ -4144,7 +5556,7 @@ mutt is developed primarily off of these sources of documentation:
 						return MUTT_INVALID_CMAP_LENGTH;
 					}
 					// Allocate cmap
-					muttCmap* cmap = (muttCmap*)mu_malloc(sizeof(muttCmap));
+					muttCmap* cmap = (muttCmap*)mutt_TableAlloc(font, sizeof(muttCmap));
 					if (!cmap) {
 						return MUTT_FAILED_MALLOC;
 					}
@@ -4159,14 +5571,14 @@ mutt is developed primarily off of these sources of documentation:
 					}
 					// Verify length for tables
 					if (datalen < (4 + (uint32_m)(cmap->num_tables*8))) {
-						mutt_DeloadCmap(cmap);
+						mutt_DeloadCmap(font, cmap);
 						return MUTT_INVALID_CMAP_LENGTH;
 					}
 
 					// Allocate tables
-					cmap->encoding_records = (muttEncodingRecord*)mu_malloc(sizeof(muttEncodingRecord)*cmap->num_tables);
+					cmap->encoding_records = (muttEncodingRecord*)mutt_TableAlloc(font, sizeof(muttEncodingRecord)*cmap->num_tables);
 					if (!cmap->encoding_records) {
-						mutt_DeloadCmap(cmap);
+						mutt_DeloadCmap(font, cmap);
 						return MUTT_FAILED_MALLOC;
 					}
 					mu_memset(cmap->encoding_records, 0, sizeof(muttEncodingRecord)*cmap->num_tables);
@@ -4185,7 +5597,7 @@ mutt is developed primarily off of these sources of documentation:
 						// subtableOffset
 						uint32_m offset = MU_RBEU32(data+4);
 						if (offset >= datalen) {
-							mutt_DeloadCmap(cmap);
+							mutt_DeloadCmap(font, cmap);
 							return MUTT_INVALID_CMAP_ENCODING_RECORD_OFFSET;
 						}
 						
@@ -4193,7 +5605,7 @@ mutt is developed primarily off of these sources of documentation:
 						uint32_m subtable_len = datalen-offset;
 						// Verify length for format
 						if (subtable_len < 2) {
-							mutt_DeloadCmap(cmap);
+							mutt_DeloadCmap(font, cmap);
 							return MUTT_INVALID_CMAP_ENCODING_RECORD_LENGTH;
 						}
 						// format
@@ -4210,21 +5622,22 @@ mutt is developed primarily off of these sources of documentation:
 				}
 
 				// Deloads the cmap table
-				void mutt_DeloadCmap(muttCmap* cmap) {
+				// (Freed in reverse order of allocation so that the memory is reclaimed)
+				void mutt_DeloadCmap(muttFont* font, muttCmap* cmap) {
 					// cmap:
 					if (cmap) {
 						// Encoding records:
 						if (cmap->encoding_records) {
 							// Per encoding record:
-							for (uint16_m t = 0; t < cmap->num_tables; ++t) {
+							for (uint16_m t = cmap->num_tables; t > 0; --t) {
 								// Deload format if necessary
-								if (!mutt_result_is_fatal(cmap->encoding_records[t].result)) {
-									mutt_DeloadCmapFormat(cmap->encoding_records[t].format, &cmap->encoding_records[t].encoding);
+								if (!mutt_result_is_fatal(cmap->encoding_records[t-1].result)) {
+									mutt_DeloadCmapFormat(font, cmap->encoding_records[t-1].format, &cmap->encoding_records[t-1].encoding);
 								}
 							}
-							mu_free(cmap->encoding_records);
+							mutt_TableFree(font, cmap->encoding_records);
 						}
-						mu_free(cmap);
+						mutt_TableFree(font, cmap);
 					}
 				}
 
@@ -4290,2937 +5703,6342 @@ mutt is developed primarily off of these sources of documentation:
 				font->fail_load_flags |= (load_flags & MUTT_LOAD_CMAP);
 			}
 
-			// Does one pass through each table load
-			void mutt_LoadTables(muttFont* font, muByte* data, muttLoadFlags* first, muBool dep_pass, muttLoadFlags* waiting) {
-				// Loop through each table
-				for (uint16_m i = 0; i < font->directory->num_tables; ++i) {
-					// Get record information
-					muttTableRecord rec = font->directory->records[i];
-
-					// Do things based on table tag
-					switch (rec.table_tag_u32) {
-						default: break;
+			// Loads a single table from its data (0 if the table isn't in the font),
+			// giving it a "requires" result if a table it depends on isn't loaded
+			void mutt_LoadTableData(muttFont* font, muttLoadFlags table, muByte* data, uint32_m datalen) {
+				muttResult res = MUTT_FAILED_FIND_TABLE;
+				muBool loaded = MU_FALSE;
 
-						// maxp
-						case 0x6D617870: {
-							// Account for first
-							if (dep_pass) {
-								*first |= MUTT_LOAD_MAXP;
-							}
-							// Skip if already processed
-							// This works because all tables to be processed are initialized
-							// to "MUTT_FAILED_FIND_TABLE" and set to something else once
-							// processed.
-							if (font->maxp_res != MUTT_FAILED_FIND_TABLE) {
-								break;
-							}
+				switch (table) {
+					default: return; break;
 
-							// Load
-							font->maxp_res = mutt_LoadMaxp(font, &data[rec.offset], rec.length);
-							if (font->maxp) {
-								font->load_flags |= MUTT_LOAD_MAXP;
-								font->fail_load_flags &= ~MUTT_LOAD_MAXP;
-							} else {
-								font->fail_load_flags |= MUTT_LOAD_MAXP;
-								font->load_flags &= ~MUTT_LOAD_MAXP;
-							}
-						} break;
+					// maxp
+					case MUTT_LOAD_MAXP: {
+						if (data) {
+							res = mutt_LoadMaxp(font, data, datalen);
+						}
+						font->maxp_res = res;
+						loaded = font->maxp != 0;
+					} break;
 
-						// head
-						case 0x68656164: {
-							// Account for first
-							if (dep_pass) {
-								*first |= MUTT_LOAD_HEAD;
-							}
-							// Skip if already processed
-							if (font->head_res != MUTT_FAILED_FIND_TABLE) {
-								break;
-							}
+					// head
+					case MUTT_LOAD_HEAD: {
+						if (data) {
+							res = mutt_LoadHead(font, data, datalen);
+						}
+						font->head_res = res;
+						loaded = font->head != 0;
+					} break;
 
-							// Load
-							font->head_res = mutt_LoadHead(font, &data[rec.offset], rec.length);
-							if (font->head) {
-								font->load_flags |= MUTT_LOAD_HEAD;
-								font->fail_load_flags &= ~MUTT_LOAD_HEAD;
+					// hhea; req maxp
+					case MUTT_LOAD_HHEA: {
+						if (data) {
+							if (!font->maxp) {
+								res = MUTT_HHEA_REQUIRES_MAXP;
 							} else {
-								font->fail_load_flags |= MUTT_LOAD_HEAD;
-								font->load_flags &= ~MUTT_LOAD_HEAD;
-							}
-						} break;
-
-						// hhea; req maxp
-						case 0x68686561: {
-							// Account for first
-							if (dep_pass) {
-								*first |= MUTT_LOAD_HHEA;
-							}
-							// Skip if already processed
-							if (font->hhea_res != MUTT_FAILED_FIND_TABLE) {
-								break;
+								res = mutt_LoadHhea(font, data, datalen);
 							}
+						}
+						font->hhea_res = res;
+						loaded = font->hhea != 0;
+					} break;
 
-							// Give bad result if missing dependency
-							if (!dep_pass && !(*first & MUTT_LOAD_MAXP)) {
-								font->hhea_res = MUTT_HHEA_REQUIRES_MAXP;
-								break;
-							}
-							// Continue if dependencies aren't processed
+					// hmtx; req maxp, hhea
+					case MUTT_LOAD_HMTX: {
+						if (data) {
 							if (!font->maxp) {
-								*waiting |= MUTT_LOAD_HHEA;
-								break;
+								res = MUTT_HMTX_REQUIRES_MAXP;
+							} else if (!font->hhea) {
+								res = MUTT_HMTX_REQUIRES_HHEA;
+							} else {
+								res = mutt_LoadHmtx(font, data, datalen);
 							}
-							// Mark as no longer waiting
-							*waiting &= ~MUTT_LOAD_HHEA;
+						}
+						font->hmtx_res = res;
+						loaded = font->hmtx != 0;
+					} break;
 
-							// Load
-							font->hhea_res = mutt_LoadHhea(font, &data[rec.offset], rec.length);
-							if (font->hhea) {
-								font->load_flags |= MUTT_LOAD_HHEA;
-								font->fail_load_flags &= ~MUTT_LOAD_HHEA;
+					// loca; req maxp, head, glyf
+					case MUTT_LOAD_LOCA: {
+						if (data) {
+							if (!font->maxp) {
+								res = MUTT_LOCA_REQUIRES_MAXP;
+							} else if (!font->head) {
+								res = MUTT_LOCA_REQUIRES_HEAD;
+							} else if (!font->glyf) {
+								res = MUTT_LOCA_REQUIRES_GLYF;
 							} else {
-								font->fail_load_flags |= MUTT_LOAD_HHEA;
-								font->load_flags &= ~MUTT_LOAD_HHEA;
+								res = mutt_LoadLoca(font, data, datalen);
 							}
-						} break;
+						}
+						font->loca_res = res;
+						loaded = font->loca != 0;
+					} break;
 
-						// hmtx; req maxp, hhea
-						case 0x686D7478: {
-							// Account for first
-							if (dep_pass) {
-								*first |= MUTT_LOAD_HMTX;
-							}
-							// Skip if already processed
-							if (font->hmtx_res != MUTT_FAILED_FIND_TABLE) {
-								break;
-							}
+					// name
+					case MUTT_LOAD_NAME: {
+						if (data) {
+							res = mutt_LoadName(font, data, datalen);
+						}
+						font->name_res = res;
+						loaded = font->name != 0;
+					} break;
 
-							// Give bad result if missing dependency
-							if (!dep_pass) {
-								// maxp
-								if (!(*first & MUTT_LOAD_MAXP)) {
-									font->hmtx_res = MUTT_HMTX_REQUIRES_MAXP;
-									break;
-								}
-								// hhea
-								if (!(*first & MUTT_LOAD_HHEA)) {
-									font->hmtx_res = MUTT_HMTX_REQUIRES_HHEA;
-									break;
-								}
-							}
-							// Continue if dependencies aren't processed
-							if (!(font->maxp) || !(font->hhea)) {
-								*waiting |= MUTT_LOAD_HMTX;
-								break;
-							}
-							// Mark as no longer waiting
-							*waiting &= ~MUTT_LOAD_HMTX;
+					// glyf
+					case MUTT_LOAD_GLYF: {
+						if (data) {
+							res = mutt_LoadGlyf(font, data, datalen);
+						}
+						font->glyf_res = res;
+						loaded = font->glyf != 0;
+					} break;
 
-							// Load
-							font->hmtx_res = mutt_LoadHmtx(font, &data[rec.offset], rec.length);
-							if (font->hmtx) {
-								font->load_flags |= MUTT_LOAD_HMTX;
-								font->fail_load_flags &= ~MUTT_LOAD_HMTX;
+					// cmap; req maxp
+					case MUTT_LOAD_CMAP: {
+						if (data) {
+							if (!font->maxp) {
+								res = MUTT_CMAP_REQUIRES_MAXP;
 							} else {
-								font->fail_load_flags |= MUTT_LOAD_HMTX;
-								font->load_flags &= ~MUTT_LOAD_HMTX;
+								res = mutt_LoadCmap(font, data, datalen);
 							}
-						} break;
+						}
+						font->cmap_res = res;
+						loaded = font->cmap != 0;
+					} break;
+				}
 
-						// loca; req maxp, head, glyf
-						case 0x6C6F6361: {
-							// Account for first
-							if (dep_pass) {
-								*first |= MUTT_LOAD_LOCA;
-							}
-							// Skip if already processed
-							if (font->loca_res != MUTT_FAILED_FIND_TABLE) {
-								break;
-							}
+				// Update flags
+				// (load_flags is stored atomically after the table, as mutt_font_require
+				// reads it without the lock)
+				if (loaded) {
+					mutt_AtomicStore(&font->load_flags, font->load_flags | table);
+					font->fail_load_flags &= ~table;
+				} else {
+					font->fail_load_flags |= table;
+					mutt_AtomicStore(&font->load_flags, font->load_flags & ~table);
+				}
+			}
 
-							// Give bad result if missing dependency
-							if (!dep_pass) {
-								// maxp
-								if (!(*first & MUTT_LOAD_MAXP)) {
-									font->loca_res = MUTT_LOCA_REQUIRES_MAXP;
-									break;
-								}
-								// head
-								if (!(*first & MUTT_LOAD_HEAD)) {
-									font->loca_res = MUTT_LOCA_REQUIRES_HEAD;
-									break;
-								}
-								// glyf
-								if (!(*first & MUTT_LOAD_GLYF)) {
-									font->loca_res = MUTT_LOCA_REQUIRES_GLYF;
-									break;
-								}
-							}
-							// Continue if dependencies aren't processed
-							if (!(font->maxp) || !(font->head) || !(font->glyf)) {
-								*waiting |= MUTT_LOAD_LOCA;
-								break;
-							}
-							// Mark as no longer waiting
-							*waiting &= ~MUTT_LOAD_LOCA;
+			uint32_m mutt_TableTag(muttLoadFlags table);
 
-							// Load
-							font->loca_res = mutt_LoadLoca(font, &data[rec.offset], rec.length);
-							if (font->loca) {
-								font->load_flags |= MUTT_LOAD_LOCA;
-								font->fail_load_flags &= ~MUTT_LOAD_LOCA;
-							} else {
-								font->fail_load_flags |= MUTT_LOAD_LOCA;
-								font->load_flags &= ~MUTT_LOAD_LOCA;
-							}
-						} break;
+			// Loads a single table out of the font data
+			void mutt_LoadTable(muttFont* font, muByte* data, muttLoadFlags table) {
+				muttTableRecord* rec = mutt_find_table(font, mutt_TableTag(table));
+				if (rec) {
+					mutt_LoadTableData(font, table, &data[rec->offset], rec->length);
+				} else {
+					mutt_LoadTableData(font, table, 0, 0);
+				}
+			}
 
-						// name
-						case 0x6E616D65: {
-							// Account for first
-							if (dep_pass) {
-								*first |= MUTT_LOAD_NAME;
-							}
-							// Skip if already processed
-							if (font->name_res != MUTT_FAILED_FIND_TABLE) {
-								break;
-							}
+			// Every loadable table, ordered so that each table comes after the
+			// tables that it depends on
+			#define MUTT_TABLE_LOAD_ORDER_LEN 8
+			static const muttLoadFlags mutt_TableLoadOrder[MUTT_TABLE_LOAD_ORDER_LEN] = {
+				MUTT_LOAD_MAXP, MUTT_LOAD_HEAD, MUTT_LOAD_GLYF, MUTT_LOAD_HHEA,
+				MUTT_LOAD_HMTX, MUTT_LOAD_LOCA, MUTT_LOAD_NAME, MUTT_LOAD_CMAP,
+			};
 
-							// Load
-							font->name_res = mutt_LoadName(font, &data[rec.offset], rec.length);
-							if (font->name) {
-								font->load_flags |= MUTT_LOAD_NAME;
-								font->fail_load_flags &= ~MUTT_LOAD_NAME;
-							} else {
-								font->fail_load_flags |= MUTT_LOAD_NAME;
-								font->load_flags &= ~MUTT_LOAD_NAME;
-							}
-						} break;
+			// Loads the given tables (initialized with mutt_InitTables) in
+			// dependency order, meaning each table is only visited once
+			void mutt_LoadTablesInOrder(muttFont* font, muByte* data, muttLoadFlags tables) {
+				for (uint32_m i = 0; i < MUTT_TABLE_LOAD_ORDER_LEN; ++i) {
+					if (tables & mutt_TableLoadOrder[i]) {
+						mutt_LoadTable(font, data, mutt_TableLoadOrder[i]);
+					}
+				}
+			}
 
-						// glyf
-						case 0x676C7966: {
-							// Account for first
-							if (dep_pass) {
-								*first |= MUTT_LOAD_GLYF;
-							}
-							// Skip if already processed
-							if (font->glyf_res != MUTT_FAILED_FIND_TABLE) {
-								break;
-							}
+			// Returns the tables that the given tables depend on to load
+			muttLoadFlags mutt_TableDependencies(muttLoadFlags tables) {
+				muttLoadFlags deps = 0;
+				// hhea; req maxp
+				if (tables & MUTT_LOAD_HHEA) {
+					deps |= MUTT_LOAD_MAXP;
+				}
+				// hmtx; req maxp, hhea
+				if (tables & MUTT_LOAD_HMTX) {
+					deps |= MUTT_LOAD_MAXP | MUTT_LOAD_HHEA;
+				}
+				// loca; req maxp, head, glyf
+				if (tables & MUTT_LOAD_LOCA) {
+					deps |= MUTT_LOAD_MAXP | MUTT_LOAD_HEAD | MUTT_LOAD_GLYF;
+				}
+				// cmap; req maxp
+				if (tables & MUTT_LOAD_CMAP) {
+					deps |= MUTT_LOAD_MAXP;
+				}
+				return deps;
+			}
 
-							// Load
-							font->glyf_res = mutt_LoadGlyf(font, &data[rec.offset], rec.length);
-							if (font->glyf) {
-								font->load_flags |= MUTT_LOAD_GLYF;
-								font->fail_load_flags &= ~MUTT_LOAD_GLYF;
-							} else {
-								font->fail_load_flags |= MUTT_LOAD_GLYF;
-								font->load_flags &= ~MUTT_LOAD_GLYF;
-							}
-						} break;
+			// Returns the tables that can still be loaded after the given tables
+			// were loaded: the tables that weren't requested, and the tables that
+			// only failed because they depend on one of those
+			muttLoadFlags mutt_LeftoverTables(muttFont* font, muttLoadFlags load_flags) {
+				muttLoadFlags leftover = MUTT_LOAD_ALL & ~load_flags;
+				for (uint32_m i = 0; i < MUTT_TABLE_LOAD_ORDER_LEN; ++i) {
+					muttLoadFlags t = mutt_TableLoadOrder[i];
+					if ((load_flags & t) && !(font->load_flags & t) && (mutt_TableDependencies(t) & leftover)) {
+						leftover |= t;
+					}
+				}
+				return leftover;
+			}
 
-						// cmap
-						case 0x636D6170: {
-							// Account for first
-							if (dep_pass) {
-								*first |= MUTT_LOAD_CMAP;
-							}
-							// Skip if already processed
-							if (font->cmap_res != MUTT_FAILED_FIND_TABLE) {
-								break;
-							}
+			// Returns the tag of a single table
+			uint32_m mutt_TableTag(muttLoadFlags table) {
+				switch (table) {
+					default: return 0; break;
+					case MUTT_LOAD_MAXP: return 0x6D617870; break;
+					case MUTT_LOAD_HEAD: return 0x68656164; break;
+					case MUTT_LOAD_HHEA: return 0x68686561; break;
+					case MUTT_LOAD_HMTX: return 0x686D7478; break;
+					case MUTT_LOAD_LOCA: return 0x6C6F6361; break;
+					case MUTT_LOAD_POST: return 0x706F7374; break;
+					case MUTT_LOAD_NAME: return 0x6E616D65; break;
+					case MUTT_LOAD_GLYF: return 0x676C7966; break;
+					case MUTT_LOAD_CMAP: return 0x636D6170; break;
+				}
+			}
 
-							// Give bad result if missing dependency
-							if (!dep_pass && !(*first & MUTT_LOAD_MAXP)) {
-								font->cmap_res = MUTT_CMAP_REQUIRES_MAXP;
-								break;
-							}
-							// Continue if dependencies aren't processed
-							if (!font->maxp) {
-								*waiting |= MUTT_LOAD_CMAP;
-								break;
-							}
-							// Mark as no longer waiting
-							*waiting &= ~MUTT_LOAD_CMAP;
+			// Returns the pointer of a single table
+			void* mutt_TablePointer(muttFont* font, muttLoadFlags table) {
+				switch (table) {
+					default: return 0; break;
+					case MUTT_LOAD_MAXP: return font->maxp; break;
+					case MUTT_LOAD_HEAD: return font->head; break;
+					case MUTT_LOAD_HHEA: return font->hhea; break;
+					case MUTT_LOAD_HMTX: return font->hmtx; break;
+					case MUTT_LOAD_LOCA: return font->loca; break;
+					case MUTT_LOAD_POST: return font->post; break;
+					case MUTT_LOAD_NAME: return font->name; break;
+					case MUTT_LOAD_GLYF: return font->glyf; break;
+					case MUTT_LOAD_CMAP: return font->cmap; break;
+				}
+			}
 
-							// Load
-							font->cmap_res = mutt_LoadCmap(font, &data[rec.offset], rec.length);
-							if (font->cmap) {
-								font->load_flags |= MUTT_LOAD_CMAP;
-								font->fail_load_flags &= ~MUTT_LOAD_CMAP;
-							} else {
-								font->fail_load_flags |= MUTT_LOAD_CMAP;
-								font->load_flags &= ~MUTT_LOAD_CMAP;
-							}
-						} break;
-					}
+			// Sets the load result of a single table
+			void mutt_SetTableResult(muttFont* font, muttLoadFlags table, muttResult res) {
+				switch (table) {
+					default: break;
+					case MUTT_LOAD_MAXP: font->maxp_res = res; break;
+					case MUTT_LOAD_HEAD: font->head_res = res; break;
+					case MUTT_LOAD_HHEA: font->hhea_res = res; break;
+					case MUTT_LOAD_HMTX: font->hmtx_res = res; break;
+					case MUTT_LOAD_LOCA: font->loca_res = res; break;
+					case MUTT_LOAD_POST: font->post_res = res; break;
+					case MUTT_LOAD_NAME: font->name_res = res; break;
+					case MUTT_LOAD_GLYF: font->glyf_res = res; break;
+					case MUTT_LOAD_CMAP: font->cmap_res = res; break;
+				}
+			}
+
+			// Sets the pointer and load result of a single, successfully loaded table
+			void mutt_SetTable(muttFont* font, muttLoadFlags table, void* pointer, muttResult res) {
+				switch (table) {
+					default: return; break;
+					case MUTT_LOAD_MAXP: font->maxp = (muttMaxp*)pointer; break;
+					case MUTT_LOAD_HEAD: font->head = (muttHead*)pointer; break;
+					case MUTT_LOAD_HHEA: font->hhea = (muttHhea*)pointer; break;
+					case MUTT_LOAD_HMTX: font->hmtx = (muttHmtx*)pointer; break;
+					case MUTT_LOAD_LOCA: font->loca = (muttLoca*)pointer; break;
+					case MUTT_LOAD_POST: font->post = (muttPost*)pointer; break;
+					case MUTT_LOAD_NAME: font->name = (muttName*)pointer; break;
+					case MUTT_LOAD_GLYF: font->glyf = (muttGlyf*)pointer; break;
+					case MUTT_LOAD_CMAP: font->cmap = (muttCmap*)pointer; break;
+				}
+				mutt_SetTableResult(font, table, res);
+				// (Stored atomically after the table, as mutt_font_require reads it without the lock)
+				mutt_AtomicStore(&font->load_flags, font->load_flags | table);
+				font->fail_load_flags &= ~table;
+			}
+
+			// Returns the load result of a single table
+			muttResult mutt_TableResult(muttFont* font, muttLoadFlags table) {
+				switch (table) {
+					default: return MUTT_FAILED_FIND_TABLE; break;
+					case MUTT_LOAD_MAXP: return font->maxp_res; break;
+					case MUTT_LOAD_HEAD: return font->head_res; break;
+					case MUTT_LOAD_HHEA: return font->hhea_res; break;
+					case MUTT_LOAD_HMTX: return font->hmtx_res; break;
+					case MUTT_LOAD_LOCA: return font->loca_res; break;
+					case MUTT_LOAD_POST: return font->post_res; break;
+					case MUTT_LOAD_NAME: return font->name_res; break;
+					case MUTT_LOAD_GLYF: return font->glyf_res; break;
+					case MUTT_LOAD_CMAP: return font->cmap_res; break;
 				}
 			}
 
-			// Deallocates all loaded tables
-			void mutt_DeloadTables(muttFont* font) {
-				// Basic tables
-				if (font->maxp) {
-					mu_free(font->maxp);
+			void mutt_LoadStreamTables(muttFont* font, muttLoadFlags tables);
+			MUDEF muttResult mutt_font_require(muttFont* font, muttLoadFlags tables) {
+				tables &= MUTT_LOAD_ALL;
+
+				// Every table already loaded; nothing to do
+				// (Each table is published before its bit in load_flags, so the tables
+				// can be used once their bits are seen)
+				if ((mutt_AtomicLoad(&font->load_flags) & tables) == tables) {
+					return MUTT_SUCCESS;
 				}
-				if (font->head) {
-					mu_free(font->head);
+
+				// (The rest of the load state is written by whichever thread loads a
+				// table, so it's only read under the lock)
+				mutt_SpinLock(&font->lock);
+
+				// Load tables that haven't been attempted yet
+				muttLoadFlags load = font->lazy_flags & tables;
+				if (load) {
+					// Pull in dependencies not yet attempted
+					load |= mutt_TableDependencies(load) & font->lazy_flags;
+					// Load
+					mutt_InitTables(font, load);
+					if (font->stream) {
+						mutt_LoadStreamTables(font, load);
+					} else {
+						mutt_LoadTablesInOrder(font, font->data, load);
+					}
+					// Mark as attempted (publishing the loaded tables to other threads)
+					mutt_AtomicStore(&font->lazy_flags, font->lazy_flags & ~load);
 				}
-				if (font->hhea) {
-					mu_free(font->hhea);
+
+				// Report on the first table that isn't loaded
+				muttResult res = MUTT_SUCCESS;
+				muttLoadFlags missing = tables & ~font->load_flags;
+				for (muttLoadFlags t = 1; t <= MUTT_LOAD_CMAP; t <<= 1) {
+					if (missing & t) {
+						res = mutt_TableResult(font, t);
+						if (res == MUTT_SUCCESS) {
+							res = MUTT_FAILED_FIND_TABLE;
+						}
+						break;
+					}
 				}
 
-				// Allocated tables
-				mutt_DeloadHmtx(font->hmtx);
-				mutt_DeloadLoca(font->loca);
-				mutt_DeloadName(font->name);
-				mutt_DeloadGlyf(font->glyf);
-				mutt_DeloadCmap(font->cmap);
+				mutt_SpinUnlock(&font->lock);
+				return res;
 			}
 
-			MUDEF muttResult mutt_load(muByte* data, uint64_m datalen, muttFont* font, muttLoadFlags load_flags) {
+			muttResult mutt_LoadSharedTables(muttCollection* collection, muttCollectionFace* face, muttLoadFlags tables);
+
+			// Loads a font whose table directory is at "dir_offset"; if the font
+			// is a collection face ("collection" and "face" non-zero), its
+			// tables are loaded through the collection so that they can be
+			// shared with other faces; "memory" is old table memory to reuse
+			// (or 0)
+			muttResult mutt_LoadFont(muByte* data, uint64_m datalen, uint64_m dir_offset, muttFont* font, muttLoadFlags load_flags, muttCollection* collection, muttCollectionFace* face, void* memory) {
 				muttResult res;
 
 				// Zero-out font
 				mu_memset(font, 0, sizeof(muttFont));
+				// Store load modes
+				font->mode_flags = load_flags & ~MUTT_LOAD_ALL;
+				// - Lazy loading needs the data to stick around
+				if (font->mode_flags & MUTT_LOAD_LAZY) {
+					font->mode_flags |= MUTT_LOAD_BORROW;
+				}
+
+				// Allocate memory for everything we're about to load up front
+				// (Lazy fonts may need any table later, so they make room for all of them)
+				// (Shared tables live in their own memory, so faces only need room for the directory)
+				muttLoadFlags mem_tables = (font->mode_flags & MUTT_LOAD_LAZY) ?(MUTT_LOAD_ALL) :(load_flags & MUTT_LOAD_ALL);
+				mem_tables |= mutt_TableDependencies(mem_tables);
+				if (collection) {
+					mem_tables = 0;
+				}
+				if (!mutt_TableBlockReuse(font, memory, mutt_TableMemory(data, datalen, dir_offset, mem_tables, font->mode_flags))) {
+					return MUTT_FAILED_MALLOC;
+				}
 
 				// Load table directory
 				// - Allocate
-				font->directory = (muttDirectory*)mu_malloc(sizeof(muttDirectory));
+				font->directory = (muttDirectory*)mutt_TableAlloc(font, sizeof(muttDirectory));
 				if (!font->directory) {
-					// mutt_deload(font);
+					mutt_deload(font);
 					return MUTT_FAILED_MALLOC;
 				}
 				// - Load
-				res = mutt_LoadTableDirectory(font->directory, data, datalen);
+				res = mutt_LoadTableDirectory(font, font->directory, data, datalen, dir_offset);
 				if (mutt_result_is_fatal(res)) {
 					mutt_deload(font);
 					return res;
 				}
 
+				// Keep data around if borrowed so that tables can be loaded later
+				// (Its length is kept either way, so that caches of the font can check
+				// that they're given the same data)
+				font->datalen = datalen;
+				if (font->mode_flags & MUTT_LOAD_BORROW) {
+					font->data = data;
+				}
+
+				// Leave every table for later if lazy
+				if (font->mode_flags & MUTT_LOAD_LAZY) {
+					font->lazy_flags = MUTT_LOAD_ALL;
+					return MUTT_SUCCESS;
+				}
+
 				// Init and load tables
+				load_flags &= MUTT_LOAD_ALL;
 				mutt_InitTables(font, load_flags);
+				if (collection) {
+					res = mutt_LoadSharedTables(collection, face, load_flags);
+					if (mutt_result_is_fatal(res)) {
+						mutt_deload(font);
+						return res;
+					}
+				} else {
+					mutt_LoadTablesInOrder(font, data, load_flags);
+				}
 
-				muttLoadFlags temp_flags = 0;
-				muttLoadFlags wait_flags = 0;
-				mutt_LoadTables(font, data, &temp_flags, MU_TRUE, &wait_flags);
-				while (wait_flags) {
-					mutt_LoadTables(font, data, &temp_flags, MU_FALSE, &wait_flags);
+				// Tables that weren't requested can still be loaded later if borrowed
+				if (font->mode_flags & MUTT_LOAD_BORROW) {
+					font->lazy_flags = mutt_LeftoverTables(font, load_flags);
 				}
 
 				return MUTT_SUCCESS;
 			}
 
+			MUDEF muttResult mutt_load(muByte* data, uint64_m datalen, muttFont* font, muttLoadFlags load_flags) {
+				return mutt_LoadFont(data, datalen, 0, font, load_flags, 0, 0, 0);
+			}
+
+			void mutt_UnmapFile(muByte* data, uint64_m datalen);
+			void mutt_StreamFree(muttStream* stream);
+			void mutt_OutlineCacheFree(muttOutlineCache* cache);
 			MUDEF void mutt_deload(muttFont* font) {
-				// Deload tables
-				mutt_DeloadTables(font);
-				// Deload table directory
-				if (font->directory) {
-					mutt_DeloadTableDirectory(font->directory);
-					mu_free(font->directory);
+				// Free tables and directory (all in table memory)
+				mutt_TableMemoryFree(font->memory);
+				font->memory = 0;
+				// Unmap file if we own it
+				if (font->file_data) {
+					mutt_UnmapFile(font->file_data, font->file_len);
+				}
+				// Free stream
+				if (font->stream) {
+					mutt_StreamFree(font->stream);
+				}
+				// Free outline cache
+				if (font->outlines) {
+					mutt_OutlineCacheFree(font->outlines);
+					font->outlines = 0;
+				}
+				// Free validated glyphs
+				if (font->validated) {
+					mu_free(font->validated);
+					font->validated = 0;
 				}
 			}
 
-		/* Glyf stuff */
+			MUDEF muttResult mutt_reload(muttFont* font, muByte* data, uint64_m datalen, muttLoadFlags load_flags) {
+				// Take table memory from the font, then deload everything else
+				void* memory = font->memory;
+				font->memory = 0;
+				mutt_deload(font);
+				// Load new font into it
+				return mutt_LoadFont(data, datalen, 0, font, load_flags, 0, 0, memory);
+			}
 
-			// Fills in the "muttGlyphHeader" struct
-			MUDEF muttResult mutt_glyph_header(muttFont* font, uint16_m glyph_id, muttGlyphHeader* header) {
-				// Get length and data of glyph
-				// - 16-bit
-				if (font->head->index_to_loc_format == 0) {
-					header->data = &font->glyf->data[((uint32_m)font->loca->offsets16[glyph_id])*2];
-					header->length = (((uint32_m)font->loca->offsets16[glyph_id+1])*2) - (((uint32_m)font->loca->offsets16[glyph_id])*2);
+		/* File loading */
+
+			// Access pattern hints for a mapped file
+			#define MUTT_ADVISE_SEQUENTIAL 0
+			#define MUTT_ADVISE_RANDOM 1
+
+			// Maps a file into memory, read-only
+			muttResult mutt_MapFile(const char* path, muByte** data, uint64_m* datalen) {
+				#if defined(MU_WIN32)
+
+				// Open file
+				HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
+				if (file == INVALID_HANDLE_VALUE) {
+					return MUTT_FAILED_OPEN_FILE;
 				}
-				// - 32-bit
-				else {
-					header->data = &font->glyf->data[font->loca->offsets32[glyph_id]];
-					header->length = font->loca->offsets32[glyph_id+1] - font->loca->offsets32[glyph_id];
+				// Get size
+				LARGE_INTEGER size;
+				if (!GetFileSizeEx(file, &size)) {
+					CloseHandle(file);
+					return MUTT_FAILED_OPEN_FILE;
+				}
+				// - Too small to hold a table directory (and zero-length files can't be mapped)
+				if (size.QuadPart < 12) {
+					CloseHandle(file);
+					return MUTT_INVALID_DIRECTORY_LENGTH;
 				}
 
-				// If header length is 0, we set everything to 0 and return
-				// (because no outline)
-				if (header->length == 0) {
-					mu_memset(header, 0, sizeof(muttGlyphHeader));
-					return MUTT_SUCCESS;
+				// Map file
+				// (The view keeps the mapping and file alive, so the handles can be closed)
+				HANDLE mapping = CreateFileMappingA(file, 0, PAGE_READONLY, 0, 0, 0);
+				CloseHandle(file);
+				if (!mapping) {
+					return MUTT_FAILED_MAP_FILE;
+				}
+				void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+				CloseHandle(mapping);
+				if (!view) {
+					return MUTT_FAILED_MAP_FILE;
 				}
 
-				// Verify minimum length for header
-				if (header->length < 10) {
-					return MUTT_INVALID_GLYF_HEADER_LENGTH;
+				*data = (muByte*)view;
+				*datalen = (uint64_m)size.QuadPart;
+				return MUTT_SUCCESS;
+
+				#elif defined(MUTT_POSIX_FILES)
+
+				// Open file
+				int fd = open(path, O_RDONLY);
+				if (fd < 0) {
+					return MUTT_FAILED_OPEN_FILE;
+				}
+				// Get size
+				struct stat st;
+				if (fstat(fd, &st) != 0) {
+					close(fd);
+					return MUTT_FAILED_OPEN_FILE;
+				}
+				// - Too small to hold a table directory (and zero-length files can't be mapped)
+				if (st.st_size < 12) {
+					close(fd);
+					return MUTT_INVALID_DIRECTORY_LENGTH;
 				}
 
-				// numberOfContours
-				header->number_of_contours = MU_RBES16(header->data);
-				if (header->number_of_contours > font->maxp->max_contours) {
-					return MUTT_INVALID_GLYF_HEADER_NUMBER_OF_CONTOURS;
+				// Map file
+				// (The mapping keeps the file alive, so the descriptor can be closed)
+				void* map = mmap(0, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+				close(fd);
+				if (map == MAP_FAILED) {
+					return MUTT_FAILED_MAP_FILE;
 				}
 
-				// xMin
-				header->x_min = MU_RBES16(header->data+2);
-				if (header->x_min < font->head->x_min) {
-					return MUTT_INVALID_GLYF_HEADER_X_MIN;
-				}
-				// yMin
-				header->y_min = MU_RBES16(header->data+4);
-				if (header->y_min < font->head->y_min) {
-					return MUTT_INVALID_GLYF_HEADER_Y_MIN;
-				}
-				// xMax
-				header->x_max = MU_RBES16(header->data+6);
-				if (header->x_max > font->head->x_max) {
-					return MUTT_INVALID_GLYF_HEADER_X_MAX;
-				}
-				if (header->x_max < header->x_min) {
-					return MUTT_INVALID_GLYF_HEADER_X_MIN_MAX;
-				}
-				// yMax
-				header->y_max = MU_RBES16(header->data+8);
-				if (header->y_max > font->head->y_max) {
-					return MUTT_INVALID_GLYF_HEADER_Y_MAX;
+				*data = (muByte*)map;
+				*datalen = (uint64_m)st.st_size;
+				return MUTT_SUCCESS;
+
+				#else
+
+				return MUTT_FAILED_MAP_FILE; if (path) {} if (data) {} if (datalen) {}
+
+				#endif
+			}
+
+			// Unmaps a file mapped with mutt_MapFile
+			void mutt_UnmapFile(muByte* data, uint64_m datalen) {
+				#if defined(MU_WIN32)
+				UnmapViewOfFile(data);
+				if (datalen) {}
+				#elif defined(MUTT_POSIX_FILES)
+				munmap(data, (size_t)datalen);
+				#else
+				if (data) {} if (datalen) {}
+				#endif
+			}
+
+			// Hints the access pattern of a range of a mapped file
+			void mutt_AdviseFile(muByte* data, uint64_m offset, uint64_m length, int advice) {
+				#if defined(MUTT_POSIX_FILES) && defined(POSIX_MADV_RANDOM) && defined(POSIX_MADV_SEQUENTIAL)
+				// Align start down to page boundary
+				uint64_m page = (uint64_m)sysconf(_SC_PAGESIZE);
+				uint64_m misalign = ((uint64_m)(size_t)(data+offset)) % page;
+				// Hint
+				posix_madvise(data+offset-misalign, (size_t)(length+misalign),
+					(advice == MUTT_ADVISE_RANDOM) ?(POSIX_MADV_RANDOM) :(POSIX_MADV_SEQUENTIAL)
+				);
+				#else
+				// (No equivalent hints worth giving on other systems, or
+				// posix_madvise isn't available)
+				if (data) {} if (offset) {} if (length) {} if (advice) {}
+				#endif
+			}
+
+			// Hints the access pattern of the tables of a mapped font file:
+			// the directory and cmap are read front to back, and glyf and
+			// loca are accessed a glyph at a time (only hinted if "random" is
+			// set, as verifying their checksums reads them as a whole)
+			void mutt_AdviseTables(muByte* data, uint64_m datalen, muBool random) {
+				// (Invalid directories are left for mutt_load to report)
+				if (datalen < 12) {
+					return;
 				}
-				if (header->y_max < header->y_min) {
-					return MUTT_INVALID_GLYF_HEADER_Y_MIN_MAX;
+				uint64_m dirlen = 12 + ((uint64_m)MU_RBEU16(data+4) * 16);
+				if (dirlen > datalen) {
+					dirlen = datalen;
 				}
+				mutt_AdviseFile(data, 0, dirlen, MUTT_ADVISE_SEQUENTIAL);
 
-				// Subtract header data from length
-				header->length -= 10;
-				// ...and move data up past header
-				header->data += 10;
+				for (uint64_m r = 12; r+16 <= dirlen; r += 16) {
+					uint32_m tag = MU_RBEU32(data+r);
+					uint64_m offset = MU_RBEU32(data+r+8);
+					uint64_m length = MU_RBEU32(data+r+12);
+					if (offset >= datalen) {
+						continue;
+					}
+					if (length > datalen-offset) {
+						length = datalen-offset;
+					}
 
-				return MUTT_SUCCESS;
+					// cmap
+					if (tag == 0x636D6170) {
+						mutt_AdviseFile(data, offset, length, MUTT_ADVISE_SEQUENTIAL);
+					}
+					// glyf & loca
+					else if (random && (tag == 0x676C7966 || tag == 0x6C6F6361)) {
+						mutt_AdviseFile(data, offset, length, MUTT_ADVISE_RANDOM);
+					}
+				}
 			}
 
-			// Fills in (or calculates memory needed for) "muttSimpleGlyph" struct
-			MUDEF muttResult mutt_simple_glyph(muttFont* font, muttGlyphHeader* header, muttSimpleGlyph* glyph, muByte* data, uint32_m* written) {
-				muttResult res = MUTT_SUCCESS;
+			MUDEF muttResult mutt_load_file(const char* path, muttFont* font, muttLoadFlags load_flags) {
+				// Map file
+				muByte* data;
+				uint64_m datalen;
+				muttResult res = mutt_MapFile(path, &data, &datalen);
+				if (mutt_result_is_fatal(res)) {
+					return res;
+				}
 
-				// Verify length for endPtsOfContours and instructionLength
-				// (req is u64 to avoid possible overflow)
-				uint64_m req = (((uint32_m)header->number_of_contours)*2) + 2;
-				if (header->length < req) {
-					return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+				// Hint tables; glyf and loca can only be hinted as random
+				// access up front if their checksums won't be verified
+				muBool skip_checksums = (load_flags & MUTT_LOAD_SKIP_CHECKSUMS) != 0;
+				mutt_AdviseTables(data, datalen, skip_checksums);
+
+				// Load font straight out of the mapping
+				res = mutt_load(data, datalen, font, load_flags | MUTT_LOAD_BORROW);
+				if (mutt_result_is_fatal(res)) {
+					mutt_UnmapFile(data, datalen);
+					return res;
 				}
+				font->file_data = data;
+				font->file_len = datalen;
 
-				// Glyph data:
-				muByte* gdata = header->data;
+				// Glyph data is only touched a glyph at a time from here on
+				if (!skip_checksums) {
+					mutt_AdviseTables(data, datalen, MU_TRUE);
+				}
 
-				// Memory size calculation:
-				if (!data) {
-					// Add endPtsOfContours to memory
-					uint32_m min_size = header->number_of_contours*2;
+				return res;
+			}
 
-					// To calculate amount of points:
-					uint16_m points = 0;
-					if (header->number_of_contours != 0) {
-						// Skip to last element of endPtsOfContours and read
-						gdata += (uint32_m)(header->number_of_contours-1)*2;
-						points = MU_RBEU16(gdata);
+		/* Batch loading */
 
-						// Verify last element of endPtsOfContours
-						if (points == 0xFFFF) {
-							return MUTT_INVALID_GLYF_SIMPLE_END_PTS_OF_CONTOURS;
-						}
+			#ifndef MUTT_BATCH_MAX_THREADS
+				#define MUTT_BATCH_MAX_THREADS 64
+			#endif
 
-						// Skip past last element
-						++points;
-						gdata += 2;
-					}
+			// Fonts to load across threads; either data or paths is given
+			typedef struct muttBatch muttBatch;
+			struct muttBatch {
+				uint32_m count;
+				muByte** data;
+				uint64_m* datalen;
+				const char** paths;
+				muttFont* fonts;
+				muttLoadFlags load_flags;
+				muttResult* results;
+				// Index of the next font to be loaded
+				uint32_m next;
+			};
 
-					// Verify point count
-					if (points > font->maxp->max_points) {
-						return MUTT_INVALID_GLYF_SIMPLE_POINT_COUNT;
-					}
-					// Add points to memory
-					min_size += ((uint32_m)points)*sizeof(muttGlyphPoint);
+			// Work run by every thread of mutt_RunThreads
+			typedef struct muttThreadWork muttThreadWork;
+			struct muttThreadWork {
+				void (*work)(void*);
+				void* arg;
+			};
 
-					// Add instructions to memory
-					uint16_m instruction_length = MU_RBEU16(gdata);
-					if (instruction_length > font->maxp->max_size_of_instructions) {
-						return MUTT_INVALID_GLYF_SIMPLE_INSTRUCTION_LENGTH;
+			// Loads fonts of a batch until there are none left
+			void mutt_BatchWork(void* arg) {
+				muttBatch* batch = (muttBatch*)arg;
+				while (MU_TRUE) {
+					uint32_m i = mutt_AtomicAdd(&batch->next, 1);
+					if (i >= batch->count) {
+						return;
 					}
-					min_size += instruction_length;
+					if (batch->paths) {
+						batch->results[i] = mutt_load_file(batch->paths[i], &batch->fonts[i], batch->load_flags);
+					} else {
+						batch->results[i] = mutt_load(batch->data[i], batch->datalen[i], &batch->fonts[i], batch->load_flags);
+					}
+				}
+			}
 
-					// Check for size fitting
-					// This should not need to be checked, as it is calculated via maxp,
-					// to which all of these values are also checked to not exceed.
-					/*if (min_size > mutt_simple_glyph_max_size(font)) {
-						return MUTT_INVALID_GLYF_SIMPLE_;
-					}*/
+			#if defined(MU_WIN32)
+			DWORD WINAPI mutt_WorkThread(LPVOID work) {
+				((muttThreadWork*)work)->work(((muttThreadWork*)work)->arg);
+				return 0;
+			}
+			#elif defined(MUTT_POSIX_FILES)
+			void* mutt_WorkThread(void* work) {
+				((muttThreadWork*)work)->work(((muttThreadWork*)work)->arg);
+				return 0;
+			}
+			#endif
 
-					// Set memory req
-					*written = min_size;
-					return MUTT_SUCCESS;
-				}
+			// Returns the amount of processors on the system (1 if unknown)
+			uint32_m mutt_ProcessorCount(void) {
+				#if defined(MU_WIN32)
 
-				// Store pointer to original data
-				muByte* orig_data = data;
+				SYSTEM_INFO info;
+				GetSystemInfo(&info);
+				return (info.dwNumberOfProcessors) ?((uint32_m)info.dwNumberOfProcessors) :(1);
 
-				// Allocate endPtsOfContours
-				glyph->end_pts_of_contours = (uint16_m*)data;
-				data += ((uint32_m)header->number_of_contours)*2;
+				#elif defined(MUTT_POSIX_FILES)
 
-				// Loop through each contour
-				uint16_m points = 0;
-				for (uint16_m c = 0; c < header->number_of_contours; ++c) {
-					// Copy value for endPtsOfContour
-					glyph->end_pts_of_contours[c] = MU_RBEU16(gdata);
+				long count = sysconf(_SC_NPROCESSORS_ONLN);
+				return (count > 0) ?((uint32_m)count) :(1);
 
-					// Verify increasing order
-					if (c != 0) {
-						if (glyph->end_pts_of_contours[c] <= glyph->end_pts_of_contours[c-1]) {
-							return MUTT_INVALID_GLYF_SIMPLE_END_PTS_OF_CONTOURS;
-						}
-					}
+				#else
 
-					// Get point count if we're on the last index
-					if (c == header->number_of_contours-1) {
-						points = glyph->end_pts_of_contours[c];
-						// Verify last element
-						if (points == 0xFFFF) {
-							return MUTT_INVALID_GLYF_SIMPLE_END_PTS_OF_CONTOURS;
-						}
-						// Increment points by one to get count (since last value is an index)
-						++points;
-					}
+				return 1;
 
-					// Move to next entry in endPtsOfContours
-					gdata += 2;
-				}
+				#endif
+			}
 
-				// Verify point count
-				if (points > font->maxp->max_points) {
-					return MUTT_INVALID_GLYF_SIMPLE_POINT_COUNT;
+			// Figures out the amount of threads to use for the given amount of work items
+			// (No more threads than items; the calling thread counts as one)
+			uint32_m mutt_ThreadCount(uint32_m threads, uint32_m items) {
+				if (threads == 0) {
+					threads = mutt_ProcessorCount();
 				}
-
-				// instructionLength
-				glyph->instruction_length = MU_RBEU16(gdata);
-				gdata += 2;
-				// + Verify instructionLength
-				if (glyph->instruction_length > font->maxp->max_size_of_instructions) {
-					return MUTT_INVALID_GLYF_SIMPLE_INSTRUCTION_LENGTH;
+				if (threads > MUTT_BATCH_MAX_THREADS) {
+					threads = MUTT_BATCH_MAX_THREADS;
+				}
+				if (threads > items) {
+					threads = items;
 				}
+				return threads;
+			}
 
-				// For instructions:
-				if (glyph->instruction_length != 0) {
-					// Verify length for instructions
-					req += glyph->instruction_length;
-					if (header->length < req) {
-						return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+			// Runs work on the given amount of threads (including the calling thread),
+			// returning once every thread is done
+			void mutt_RunThreads(void (*work)(void*), void* arg, uint32_m threads) {
+				muttThreadWork thread_work;
+				thread_work.work = work;
+				thread_work.arg = arg;
+
+				#if defined(MU_WIN32)
+
+				// Start threads
+				HANDLE handles[MUTT_BATCH_MAX_THREADS];
+				uint32_m started = 0;
+				for (; started+1 < threads; ++started) {
+					handles[started] = CreateThread(0, 0, mutt_WorkThread, &thread_work, 0, 0);
+					if (!handles[started]) {
+						break;
 					}
-					// Allocate
-					glyph->instructions = (uint8_m*)data;
-					// Copy over
-					mu_memcpy(glyph->instructions, gdata, glyph->instruction_length);
-					// Move past instructions
-					data += glyph->instruction_length;
-					gdata += glyph->instruction_length;
+				}
+				// Work on this thread as well
+				work(arg);
+				// Wait for threads
+				for (uint32_m t = 0; t < started; ++t) {
+					WaitForSingleObject(handles[t], INFINITE);
+					CloseHandle(handles[t]);
 				}
 
-				// Allocate points
-				glyph->points = (muttGlyphPoint*)data;
-				data += points*sizeof(muttGlyphPoint);
+				#elif defined(MUTT_POSIX_FILES)
 
-				// Loop through each flag
-				uint16_m pi = 0; // (point index)
-				uint16_m contour_id = 0;
-				while (pi < points) {
-					// Increment contour ID if we've gone over the end point of the current contour
-					if (pi > glyph->end_pts_of_contours[contour_id]) {
-						++contour_id;
-					}
-					// Verify length for this flag
-					if (header->length < ++req) {
-						return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+				// Start threads
+				pthread_t handles[MUTT_BATCH_MAX_THREADS];
+				uint32_m started = 0;
+				for (; started+1 < threads; ++started) {
+					if (pthread_create(&handles[started], 0, mutt_WorkThread, &thread_work) != 0) {
+						break;
 					}
+				}
+				// Work on this thread as well
+				work(arg);
+				// Wait for threads
+				for (uint32_m t = 0; t < started; ++t) {
+					pthread_join(handles[t], 0);
+				}
 
-					// Get flag
-					uint8_m flags = *gdata;
-					glyph->points[pi].flags = flags;
+				#else
 
-					// Verify that flag doesn't rely on prior values if this is the first flag
-					// (Some common fonts get this messed up; we're assuming 0 in these cases)
-					// This is brought up in the documentation.
-					// ...
+				// No threads; do everything here
+				(void)thread_work; (void)threads;
+				work(arg);
 
-					// Verify that first point is on curve
-					// (Not checking for similar reasons above, also brought up in doc)
-					// ...
+				#endif
+			}
 
-					// Get implied length of x- and y-coordinates based on flag
-					uint8_m coord_length = 0;
-					// - x
-					if (flags & MUTT_X_SHORT_VECTOR) {
-						// 1-byte x-coordinate
-						coord_length += 1;
-					} else if (!(flags & MUTT_X_IS_SAME_OR_POSITIVE_X_SHORT_VECTOR)) {
-						// 2-byte x-coordinate
-						coord_length += 2;
-					}
-					// -y
-					if (flags & MUTT_Y_SHORT_VECTOR) {
-						// 1-byte y-coordinate
-						coord_length += 1;
-					} else if (!(flags & MUTT_Y_IS_SAME_OR_POSITIVE_Y_SHORT_VECTOR)) {
-						// 2-byte y-coordinate
-						coord_length += 2;
-					}
+			// Loads every font of a batch across the given amount of threads
+			void mutt_LoadBatch(muttBatch* batch, uint32_m threads) {
+				batch->next = 0;
+				mutt_RunThreads(mutt_BatchWork, batch, mutt_ThreadCount(threads, batch->count));
+			}
 
-					// Verify length based on coord length
-					req += coord_length;
-					if (header->length < req) {
-						return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
-					}
+			MUDEF void mutt_load_batch(uint32_m count, muByte** data, uint64_m* datalen, muttFont* fonts, muttLoadFlags load_flags, muttResult* results, uint32_m threads) {
+				muttBatch batch;
+				mu_memset(&batch, 0, sizeof(muttBatch));
+				batch.count = count;
+				batch.data = data;
+				batch.datalen = datalen;
+				batch.fonts = fonts;
+				batch.load_flags = load_flags;
+				batch.results = results;
+				mutt_LoadBatch(&batch, threads);
+			}
 
-					// Increment past this point/flag
-					++pi;
-					++gdata;
+			MUDEF void mutt_load_file_batch(uint32_m count, const char** paths, muttFont* fonts, muttLoadFlags load_flags, muttResult* results, uint32_m threads) {
+				muttBatch batch;
+				mu_memset(&batch, 0, sizeof(muttBatch));
+				batch.count = count;
+				batch.paths = paths;
+				batch.fonts = fonts;
+				batch.load_flags = load_flags;
+				batch.results = results;
+				mutt_LoadBatch(&batch, threads);
+			}
 
-					// Handle repeating flags:
-					if (flags & MUTT_REPEAT_FLAG) {
-						// Verify length for next flag
-						if (header->length < ++req) {
-							return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
-						}
+		/* Collections */
 
-						// Get next flag as length
-						uint8_m next = *gdata++;
-						// (required length is checked next loop)
-						// - If next is 0, we don't repeat at all, and pretend
-						// like this never happened
-						if (next == 0) {
-							continue;
-						}
+			// The state of a single face of a collection
+			struct muttCollectionFace {
+				uint64_m offset; // Offset of the face's table directory
+				uint32_m refs; // Amount of retrievals not yet released
+				muttFont font;
+				// Index of the shared table that each table uses (in load order)
+				uint32_m shared[MUTT_TABLE_LOAD_ORDER_LEN];
+			};
 
-						// Verify length for repeated coordinate flags
-						req += ((uint32_m)coord_length) * ((uint32_m)next-1);
-						if (header->length < req) {
-							return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
-						}
+			// Marks a table that isn't a shared table
+			#define MUTT_NO_SHARED_TABLE 0xFFFFFFFF
+			// Max amount of tables that a table depends on
+			#define MUTT_SHARED_TABLE_MAX_DEPS 3
+			// Marks a dependency that isn't loaded
+			#define MUTT_NO_SHARED_DEP 0xFFFFFFFFFFFFFFFFULL
+
+			// A table loaded by a face, which can be used by any other face that
+			// has the same table record and dependencies
+			struct muttSharedTable {
+				muttLoadFlags table; // Which table it is
+				uint32_m offset; // Offset of the table record
+				uint32_m length; // Length of the table record
+				uint64_m deps[MUTT_SHARED_TABLE_MAX_DEPS]; // Values of the tables it was loaded against
+				void* pointer; // The table itself
+				muttResult res; // Result of loading it
+				void* memory; // Table memory that it lives in
+				uint32_m refs; // Amount of faces using it; the slot is free if 0
+			};
+
+			// Gets the value of a table that tables depending on it are loaded against
+			uint64_m mutt_SharedTableDep(muttFont* font, muttLoadFlags table) {
+				if (!mutt_TablePointer(font, table)) {
+					return MUTT_NO_SHARED_DEP;
+				}
+				switch (table) {
+					default: return 0;
+					case MUTT_LOAD_MAXP: return font->maxp->num_glyphs;
+					case MUTT_LOAD_HEAD: return (uint16_m)font->head->index_to_loc_format;
+					case MUTT_LOAD_HHEA: return font->hhea->number_of_hmetrics;
+					case MUTT_LOAD_GLYF: return font->glyf->len;
+				}
+			}
 
-						// Verify repeat count
-						// Not doing this since we can easily pretend like it didn't
-						// happen to no consequence.
-						// This is mentioned in documentation
-						/*if (pi+next > points) {
-							return MUTT_INVALID_GLYF_SIMPLE_FLAG_REPEAT_COUNT;
-						}*/
+			// Gets the values of the tables that a table depends on, in flag order
+			// (Faces can have different dependency tables that parse to the same
+			// values, such as head tables that only differ in their dates)
+			void mutt_SharedTableDeps(muttFont* font, muttLoadFlags table, uint64_m* deps) {
+				muttLoadFlags dep_flags = mutt_TableDependencies(table);
+				uint32_m d = 0;
+				for (muttLoadFlags t = 1; t <= MUTT_LOAD_CMAP; t <<= 1) {
+					if (dep_flags & t) {
+						deps[d++] = mutt_SharedTableDep(font, t);
+					}
+				}
+				for (; d < MUTT_SHARED_TABLE_MAX_DEPS; ++d) {
+					deps[d] = 0;
+				}
+			}
 
-						// Go through each repeat flag and copy it down
-						for (uint8_m r = 0; r < next && pi < points; ++r) {
-							glyph->points[pi++].flags = flags;
-						}
+			// Stops a face from using its shared tables, deloading the ones that
+			// no face uses anymore
+			void mutt_ReleaseSharedTables(muttCollection* collection, muttCollectionFace* face) {
+				for (uint32_m i = 0; i < MUTT_TABLE_LOAD_ORDER_LEN; ++i) {
+					if (face->shared[i] == MUTT_NO_SHARED_TABLE) {
+						continue;
 					}
+					muttSharedTable* shared = &collection->shared[face->shared[i]];
+					shared->refs -= 1;
+					if (!shared->refs) {
+						mutt_TableMemoryFree(shared->memory);
+						mu_memset(shared, 0, sizeof(muttSharedTable));
+					}
+					face->shared[i] = MUTT_NO_SHARED_TABLE;
 				}
+			}
 
-				// Loop through each x-coordinate
-				int16_m x_min = 0;
-				int16_m x_max = 0;
-				pi = 0;
-				while (pi < points) {
-					// Get flags
-					uint8_m flags = glyph->points[pi].flags;
-
-					// Get x-coordinate
-					if (flags & MUTT_X_SHORT_VECTOR) {
-						// 1-byte
-						if (flags & MUTT_X_IS_SAME_OR_POSITIVE_X_SHORT_VECTOR) {
-							// Positive
-							glyph->points[pi].x = (int16_m)*gdata++;
-						} else {
-							// Negative
-							glyph->points[pi].x = -((int16_m)*gdata++);
-						}
-					} else {
-						if (flags & MUTT_X_IS_SAME_OR_POSITIVE_X_SHORT_VECTOR) {
-							// Repeated x-coordinate
-							glyph->points[pi].x = (pi!=0) ?(glyph->points[pi-1].x) :(0);
-							++pi;
-							// (Continue because no vector stuff is applied)
+			// Loads the tables of a face, using tables already loaded by other
+			// faces if possible
+			muttResult mutt_LoadSharedTables(muttCollection* collection, muttCollectionFace* face, muttLoadFlags tables) {
+				muttFont* font = &face->font;
+				uint32_m shared_len = collection->num_faces * MUTT_TABLE_LOAD_ORDER_LEN;
+				// (Table memory estimates include the directory, which shared tables don't need)
+				size_m dir_size = mutt_TableMemory(collection->data, collection->datalen, face->offset, 0, font->mode_flags);
+				for (uint32_m i = 0; i < MUTT_TABLE_LOAD_ORDER_LEN; ++i) {
+					face->shared[i] = MUTT_NO_SHARED_TABLE;
+				}
+
+				for (uint32_m i = 0; i < MUTT_TABLE_LOAD_ORDER_LEN; ++i) {
+					muttLoadFlags table = mutt_TableLoadOrder[i];
+					if (!(tables & table)) {
+						continue;
+					}
+
+					// Load normally if the table doesn't exist (to give it the right result)
+					muttTableRecord* rec = mutt_find_table(font, mutt_TableTag(table));
+					if (!rec) {
+						mutt_LoadTable(font, collection->data, table);
+						continue;
+					}
+					uint64_m deps[MUTT_SHARED_TABLE_MAX_DEPS];
+					mutt_SharedTableDeps(font, table, deps);
+
+					// Look for the same table loaded by another face
+					// (A free slot always exists, as every face takes at most one per table)
+					uint32_m free_slot = MUTT_NO_SHARED_TABLE;
+					uint32_m s = 0;
+					for (; s < shared_len; ++s) {
+						muttSharedTable* shared = &collection->shared[s];
+						if (!shared->refs) {
+							if (free_slot == MUTT_NO_SHARED_TABLE) {
+								free_slot = s;
+							}
 							continue;
-						} else {
-							// 2-bytes, signed
-							glyph->points[pi].x = MU_RBES16(gdata);
-							gdata += 2;
+						}
+						if (shared->table == table && shared->offset == rec->offset && shared->length == rec->length
+							&& shared->deps[0] == deps[0] && shared->deps[1] == deps[1] && shared->deps[2] == deps[2]
+						) {
+							break;
 						}
 					}
 
-					// Add as vector to prior value
-					// - Get previous x value
-					int16_m prev_x = (pi!=0) ?(glyph->points[pi-1].x) :(0);
-					// - Compute the current coordinate based on previous
-					int32_m test_val = prev_x + glyph->points[pi].x;
-					// - Verify that the point is within range
-					if (test_val < header->x_min || test_val > header->x_max) {
-						res = MUTT_INVALID_GLYF_SIMPLE_X_COORD;
-					}
-					// - Verify that the point is within FUnit range
-					if (test_val < -16384 || test_val > 16383) {
-						return MUTT_INVALID_GLYF_SIMPLE_X_COORD_FUNITS;
+					// Use it if found
+					if (s < shared_len) {
+						muttSharedTable* shared = &collection->shared[s];
+						shared->refs += 1;
+						mutt_SetTable(font, table, shared->pointer, shared->res);
+						face->shared[i] = s;
+						continue;
 					}
-					// - Consider it with currently calculated x min/max
-					if ((test_val < x_min) || (pi == 0)) {
-						x_min = test_val;
+
+					// Otherwise, load it into its own memory so that it can outlive this face
+					void* face_memory = font->memory;
+					font->memory = 0;
+					if (!mutt_TableBlockCreate(font, mutt_TableMemory(collection->data, collection->datalen, face->offset, table, font->mode_flags) - dir_size)) {
+						font->memory = face_memory;
+						mutt_ReleaseSharedTables(collection, face);
+						return MUTT_FAILED_MALLOC;
 					}
-					if ((test_val > x_max) || (pi == 0)) {
-						x_max = test_val;
+					mutt_LoadTable(font, collection->data, table);
+					void* memory = font->memory;
+					font->memory = face_memory;
+
+					// Only share tables that loaded
+					void* pointer = mutt_TablePointer(font, table);
+					if (!pointer) {
+						mutt_TableMemoryFree(memory);
+						continue;
 					}
-					// - Assign
-					glyph->points[pi++].x = (int16_m)test_val;
+					muttSharedTable* shared = &collection->shared[free_slot];
+					shared->table = table;
+					shared->offset = rec->offset;
+					shared->length = rec->length;
+					mu_memcpy(shared->deps, deps, sizeof(deps));
+					shared->pointer = pointer;
+					shared->res = mutt_TableResult(font, table);
+					shared->memory = memory;
+					shared->refs = 1;
+					face->shared[i] = free_slot;
 				}
 
-				// Loop through each y-coordinate
-				int16_m y_min = 0;
-				int16_m y_max = 0;
-				pi = 0;
-				while (pi < points) {
-					// Get flags
-					uint8_m flags = glyph->points[pi].flags;
-
-					// Get y-coordinate
-					if (flags & MUTT_Y_SHORT_VECTOR) {
-						// 1-byte
-						if (flags & MUTT_Y_IS_SAME_OR_POSITIVE_Y_SHORT_VECTOR) {
-							// Positive
-							glyph->points[pi].y = (int16_m)*gdata++;
-						} else {
-							// Negative
-							glyph->points[pi].y = -((int16_m)*gdata++);
-						}
-					} else {
-						if (flags & MUTT_Y_IS_SAME_OR_POSITIVE_Y_SHORT_VECTOR) {
-							// Repeated y-coordinate
-							glyph->points[pi].y = (pi!=0) ?(glyph->points[pi-1].y) :(0);
-							++pi;
-							// (Continue because no vector stuff is applied)
-							continue;
-						} else {
-							// 2-bytes, signed
-							glyph->points[pi].y = MU_RBES16(gdata);
-							gdata += 2;
-						}
-					}
+				return MUTT_SUCCESS;
+			}
 
-					// Add as vector to prior value
-					// - Get previous y value
-					int16_m prev_y = (pi!=0) ?(glyph->points[pi-1].y) :(0);
-					// - Compute the current coordinate based on previous
-					int32_m test_val = prev_y + glyph->points[pi].y;
-					// - Verify that the point is within range
-					if (test_val < header->y_min || test_val > header->y_max) {
-						res = MUTT_INVALID_GLYF_SIMPLE_Y_COORD;
+			MUDEF muttResult mutt_collection_load(muByte* data, uint64_m datalen, muttCollection* collection, muttLoadFlags load_flags) {
+				// Zero-out collection
+				mu_memset(collection, 0, sizeof(muttCollection));
+				// Faces always borrow the collection's data, and are never lazy
+				collection->load_flags = (load_flags | MUTT_LOAD_BORROW) & ~MUTT_LOAD_LAZY;
+				collection->data = data;
+				collection->datalen = datalen;
+
+				// Verify min. length for tag
+				if (datalen < 4) {
+					return MUTT_INVALID_COLLECTION_LENGTH;
+				}
+
+				// Treat a regular font file as one face
+				muBool single = MU_FALSE;
+				if (MU_RBEU32(data) == 0x00010000) {
+					single = MU_TRUE;
+					collection->num_faces = 1;
+				}
+				// Read TTC header otherwise
+				else {
+					// Verify ttcTag
+					if (MU_RBEU32(data) != 0x74746366) {
+						return MUTT_INVALID_COLLECTION_TAG;
 					}
-					// - Verify that the point is within FUnit range
-					if (test_val < -16384 || test_val > 16383) {
-						return MUTT_INVALID_GLYF_SIMPLE_Y_COORD_FUNITS;
+					// Verify min. length for header
+					if (datalen < 12) {
+						return MUTT_INVALID_COLLECTION_LENGTH;
 					}
-					// - Consider it with currently calculated y min/max values
-					if ((test_val < y_min) || (pi == 0)) {
-						y_min = test_val;
+					// Read & verify majorVersion & minorVersion
+					collection->major_version = MU_RBEU16(data+4);
+					collection->minor_version = MU_RBEU16(data+6);
+					if (collection->major_version != 1 && collection->major_version != 2) {
+						return MUTT_INVALID_COLLECTION_VERSION;
 					}
-					if ((test_val > y_max) || (pi == 0)) {
-						y_max = test_val;
+					// Read & verify numFonts
+					collection->num_faces = MU_RBEU32(data+8);
+					if (collection->num_faces == 0) {
+						return MUTT_INVALID_COLLECTION_NUM_FONTS;
+					}
+					// Verify length for tableDirectoryOffsets
+					if (datalen < 12+((uint64_m)collection->num_faces*4)) {
+						return MUTT_INVALID_COLLECTION_LENGTH;
 					}
-					// - Assign
-					glyph->points[pi++].y = (int16_m)test_val;
 				}
 
-				// Write calculated x/y min/max values
-				header->x_min = x_min;
-				header->y_min = y_min;
-				header->x_max = x_max;
-				header->y_max = y_max;
-				// Write how many bytes of data were used
-				if (written) {
-					*written = data-orig_data;
+				// Allocate faces
+				collection->faces = (muttCollectionFace*)mu_malloc(sizeof(muttCollectionFace)*collection->num_faces);
+				if (!collection->faces) {
+					return MUTT_FAILED_MALLOC;
 				}
-				return res;
-			}
-
-			// Calculates amount of points within a simple glyph
-			MUDEF muttResult mutt_simple_glyph_points(muttFont* font, muttGlyphHeader* header, uint16_m* num_points) {
-				// Give 0 for no contours
-				if (header->number_of_contours == 0) {
-					*num_points = 0;
-					return MUTT_SUCCESS;
+				mu_memset(collection->faces, 0, sizeof(muttCollectionFace)*collection->num_faces);
+				// Allocate shared tables
+				size_m shared_size = sizeof(muttSharedTable)*collection->num_faces*MUTT_TABLE_LOAD_ORDER_LEN;
+				collection->shared = (muttSharedTable*)mu_malloc(shared_size);
+				if (!collection->shared) {
+					mu_free(collection->faces);
+					return MUTT_FAILED_MALLOC;
 				}
+				mu_memset(collection->shared, 0, shared_size);
 
-				// Verify length for endPtsOfContours
-				uint32_m req = ((uint32_m)header->number_of_contours) * 2;
-				if (header->length < req) {
-					return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+				// Read & verify tableDirectoryOffsets
+				if (!single) {
+					for (uint32_m f = 0; f < collection->num_faces; ++f) {
+						collection->faces[f].offset = MU_RBEU32(data+12+(f*4));
+						if (collection->faces[f].offset >= datalen) {
+							mu_free(collection->shared);
+							mu_free(collection->faces);
+							return MUTT_INVALID_COLLECTION_TABLE_DIRECTORY_OFFSET;
+						}
+					}
 				}
 
-				// Skip to last element of endPtsOfContours and read
-				uint16_m rnum_points = MU_RBEU16(header->data + (((uint32_m)(header->number_of_contours-1)) * 2));
-				// Verify number of points won't overflow
-				if (rnum_points == 0xFFFF) {
-					return MUTT_INVALID_GLYF_SIMPLE_END_PTS_OF_CONTOURS;
-				}
-				// See if point count is good for maxp
-				if (++rnum_points > font->maxp->max_points) {
-					return MUTT_INVALID_GLYF_SIMPLE_POINT_COUNT;
+				return MUTT_SUCCESS;
+			}
+
+			MUDEF muttResult mutt_collection_load_file(const char* path, muttCollection* collection, muttLoadFlags load_flags) {
+				// Map file
+				muByte* data;
+				uint64_m datalen;
+				muttResult res = mutt_MapFile(path, &data, &datalen);
+				if (mutt_result_is_fatal(res)) {
+					return res;
 				}
 
-				// Write point count and give success
-				*num_points = rnum_points;
-				return MUTT_SUCCESS;
+				// Load collection out of the mapping
+				res = mutt_collection_load(data, datalen, collection, load_flags);
+				if (mutt_result_is_fatal(res)) {
+					mutt_UnmapFile(data, datalen);
+					return res;
+				}
+				collection->file_data = data;
+				collection->file_len = datalen;
+				return res;
 			}
 
-			// Simple glyph memory maximum
-			MUDEF uint32_m mutt_simple_glyph_max_size(muttFont* font) {
-				return
-					// endPtsOfContours
-					(font->maxp->max_contours*2)
-					// instructions
-					+(font->maxp->max_size_of_instructions)
-					// maxPoints
-					+(font->maxp->max_points*sizeof(muttGlyphPoint))
-				;
+			// Deloads a face and stops it from using its shared tables
+			void mutt_DeloadFace(muttCollection* collection, muttCollectionFace* face) {
+				mutt_ReleaseSharedTables(collection, face);
+				mutt_deload(&face->font);
+				mu_memset(&face->font, 0, sizeof(muttFont));
+				face->refs = 0;
 			}
 
-			// Calculates the x/y min/max for the given simple glyph
-			MUDEF muttResult mutt_simple_glyph_min_max(muttFont* font, muttGlyphHeader* header) {
-				// Verify length for endPtsOfContours and instructionLength
-				uint64_m req = (((uint32_m)header->number_of_contours)*2) + 2;
-				if (header->length < req) {
-					return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+			MUDEF muttResult mutt_collection_face(muttCollection* collection, uint32_m index, muttFont** font) {
+				if (index >= collection->num_faces) {
+					return MUTT_INVALID_COLLECTION_FACE_INDEX;
 				}
+				muttCollectionFace* face = &collection->faces[index];
 
-				// Progressive glyph data:
-				// (Move to endPtsOfContours[numContours-1])
-				muByte* data = header->data + (req-4);
-				// Read last element of endPtsOfContours
-				uint16_m num_points = MU_RBEU16(data);
-				data += 2;
-				// Verify it for number of points
-				if (num_points++ == 0xFFFF) {
-					return MUTT_INVALID_GLYF_SIMPLE_END_PTS_OF_CONTOURS;
-				}
-				if (num_points > font->maxp->max_points) {
-					return MUTT_INVALID_GLYF_SIMPLE_POINT_COUNT;
+				mutt_SpinLock(&collection->lock);
+				// Load face if it isn't loaded
+				if (!face->refs) {
+					muttResult res = mutt_LoadFont(collection->data, collection->datalen, face->offset, &face->font, collection->load_flags, collection, face, 0);
+					if (mutt_result_is_fatal(res)) {
+						mutt_SpinUnlock(&collection->lock);
+						return res;
+					}
 				}
+				face->refs += 1;
+				mutt_SpinUnlock(&collection->lock);
 
-				// Read instructionLength
-				uint16_m instruction_len = MU_RBEU16(data);
-				data += 2;
-				// Verify instructions
-				req += instruction_len;
-				if (header->length < req) {
-					return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
-				}
-				// Move past instructions
-				data += instruction_len;
+				*font = &face->font;
+				return MUTT_SUCCESS;
+			}
 
-				// Allocate flags
-				uint8_m* flags = (uint8_m*)mu_malloc(num_points);
-				if (!flags) {
-					return MUTT_FAILED_MALLOC;
+			MUDEF void mutt_collection_release(muttCollection* collection, uint32_m index) {
+				if (index >= collection->num_faces) {
+					return;
 				}
+				muttCollectionFace* face = &collection->faces[index];
 
-				// Loop through each flag
-				uint16_m pi = 0;
-				while (pi < num_points) {
-					// Verify length for this flag
-					if (header->length < ++req) {
-						mu_free(flags);
-						return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+				mutt_SpinLock(&collection->lock);
+				// Deload face once no retrieval of it is left
+				if (face->refs) {
+					face->refs -= 1;
+					if (!face->refs) {
+						mutt_DeloadFace(collection, face);
 					}
+				}
+				mutt_SpinUnlock(&collection->lock);
+			}
 
-					// Get flag
-					uint8_m flag = flags[pi] = *data;
-
-					// Get implied length of x- and y-coordinates based on flag
-					uint8_m coord_length = 0;
-					// - x
-					if (flag & MUTT_X_SHORT_VECTOR) {
-						// 1-byte x-coordinate
-						coord_length += 1;
-					} else if (!(flag & MUTT_X_IS_SAME_OR_POSITIVE_X_SHORT_VECTOR)) {
-						// 2-byte x-coordinate
-						coord_length += 2;
-					}
-					// - y
-					if (flag & MUTT_Y_SHORT_VECTOR) {
-						// 1-byte y-coordinate
-						coord_length += 1;
-					} else if (!(flag & MUTT_Y_IS_SAME_OR_POSITIVE_Y_SHORT_VECTOR)) {
-						// 2-byte y-coordinate
-						coord_length += 2;
+			MUDEF void mutt_collection_deload(muttCollection* collection) {
+				// Deload faces still loaded
+				for (uint32_m f = 0; f < collection->num_faces; ++f) {
+					if (collection->faces[f].refs) {
+						mutt_DeloadFace(collection, &collection->faces[f]);
 					}
+				}
+				// Free face and shared table state
+				mu_free(collection->shared);
+				mu_free(collection->faces);
+				// Unmap file if we own it
+				if (collection->file_data) {
+					mutt_UnmapFile(collection->file_data, collection->file_len);
+				}
+			}
 
-					// Verify length based on coord length
-					req += coord_length;
-					if (header->length < req) {
-						mu_free(flags);
-						return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
-					}
+		/* Streams */
 
-					// Increment past this point/flag
-					++pi;
-					++data;
+			#ifndef MUTT_STREAM_PAGE_SIZE
+				#define MUTT_STREAM_PAGE_SIZE 16384
+			#endif
+			#ifndef MUTT_STREAM_PAGE_COUNT
+				#define MUTT_STREAM_PAGE_COUNT 64
+			#endif
+			// Marks a page slot that doesn't hold a page yet
+			#define MUTT_STREAM_NO_PAGE ((uint64_m)-1)
+
+			// The state of a streamed font; glyph data is read through a cache
+			// of recently used pages, and the data of the glyphs being processed
+			// is kept in a chain of blocks (so that it stays put while a
+			// composite glyph is processed)
+			struct muttStream {
+				muttReadFunction read;
+				void* user;
+				uint64_m datalen;
+				// Offset of the glyf table
+				uint64_m glyf_offset;
+
+				// Page cache
+				muByte* pages;
+				uint64_m page_index[MUTT_STREAM_PAGE_COUNT];
+				uint32_m page_used[MUTT_STREAM_PAGE_COUNT];
+				uint32_m tick;
+				uint32_m lock;
+
+				// Glyph data
+				muttTableBlock* glyphs;
+			};
 
-					// Handle repeating flags:
-					if (flag & MUTT_REPEAT_FLAG) {
-						// Verify length for next flag
-						if (header->length < ++req) {
-							mu_free(flags);
-							return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
-						}
+			// Reads from the stream through the page cache
+			muttResult mutt_StreamRead(muttStream* stream, uint64_m offset, muByte* buffer, uint32_m length) {
+				mutt_SpinLock(&stream->lock);
 
-						// Get next flag as length
-						uint8_m next = *data++;
-						// If next is 0, we don't repeat at all, and pretend
-						// like this never happened
-						if (next == 0) {
-							continue;
-						}
+				while (length) {
+					uint64_m index = offset / MUTT_STREAM_PAGE_SIZE;
+					uint32_m page_offset = (uint32_m)(offset % MUTT_STREAM_PAGE_SIZE);
 
-						// Verify length for repeated coordinate flags
-						req += ((uint32_m)coord_length) * ((uint32_m)(next-1));
-						if (header->length < req) {
-							mu_free(flags);
-							return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+					// Find page, noting the least recently used page in case it isn't cached
+					uint32_m slot = 0;
+					for (uint32_m p = 0; p < MUTT_STREAM_PAGE_COUNT; ++p) {
+						if (stream->page_index[p] == index) {
+							slot = p;
+							break;
 						}
-
-						// Go through each repeat flag and copy it down
-						for (uint8_m r = 0; r < next && pi < num_points; ++r) {
-							flags[pi++] = flag;
+						if (stream->page_used[p] < stream->page_used[slot]) {
+							slot = p;
 						}
 					}
-				}
+					muByte* page = &stream->pages[(size_m)slot*MUTT_STREAM_PAGE_SIZE];
 
-				// Loop through each x-coordinate
-				pi = 0;
-				int16_m prev_x = 0;
-				while (pi < num_points) {
-					// Get x-coordinate
-					int16_m x;
-					if (flags[pi] & MUTT_X_SHORT_VECTOR) {
-						// 1-byte
-						if (flags[pi] & MUTT_X_IS_SAME_OR_POSITIVE_X_SHORT_VECTOR) {
-							// Positive
-							x = (int16_m)*data++;
-						} else {
-							// Negative
-							x = -((int16_m)*data++);
+					// Read page if not cached
+					if (stream->page_index[slot] != index) {
+						uint64_m start = index*MUTT_STREAM_PAGE_SIZE;
+						uint64_m page_len = stream->datalen - start;
+						if (page_len > MUTT_STREAM_PAGE_SIZE) {
+							page_len = MUTT_STREAM_PAGE_SIZE;
 						}
-					} else {
-						if (flags[pi] & MUTT_X_IS_SAME_OR_POSITIVE_X_SHORT_VECTOR) {
-							// Repeated x-coordinate
-							++pi;
-							continue;
-						} else {
-							// 2-bytes, signed
-							x = MU_RBES16(data);
-							data += 2;
+						if (!stream->read(stream->user, start, page, (uint32_m)page_len)) {
+							stream->page_index[slot] = MUTT_STREAM_NO_PAGE;
+							stream->page_used[slot] = 0;
+							mutt_SpinUnlock(&stream->lock);
+							return MUTT_FAILED_READ;
 						}
+						stream->page_index[slot] = index;
 					}
+					stream->page_used[slot] = ++stream->tick;
 
-					// Add as vector to prior value
-					int32_m test_val = prev_x + x;
-					// Verify FUnit range
-					if (test_val < -16384 || test_val > 16383) {
-						mu_free(flags);
-						return MUTT_INVALID_GLYF_SIMPLE_X_COORD_FUNITS;
-					}
-					// Consider it with currently calculated x min/max
-					if ((test_val < header->x_min) || (pi == 0)) {
-						header->x_min = test_val;
-					}
-					if ((test_val > header->x_max) || (pi == 0)) {
-						header->x_max = test_val;
+					// Copy what we need out of it
+					uint32_m copy = MUTT_STREAM_PAGE_SIZE - page_offset;
+					if (copy > length) {
+						copy = length;
 					}
-					// Set previous x as current x
-					prev_x = test_val;
-					++pi;
+					mu_memcpy(buffer, page+page_offset, copy);
+					buffer += copy;
+					offset += copy;
+					length -= copy;
 				}
 
-				// Loop through each y-coordinate
-				pi = 0;
-				int16_m prev_y = 0;
-				while (pi < num_points) {
-					// Get y-coordinate
-					int16_m y;
-					if (flags[pi] & MUTT_Y_SHORT_VECTOR) {
-						// 1-byte
-						if (flags[pi] & MUTT_Y_IS_SAME_OR_POSITIVE_Y_SHORT_VECTOR) {
-							// Positive
-							y = (int16_m)*data++;
-						} else {
-							// Negative
-							y = -((int16_m)*data++);
-						}
-					} else {
-						if (flags[pi] & MUTT_Y_IS_SAME_OR_POSITIVE_Y_SHORT_VECTOR) {
-							// Repeated y-coordinate
-							++pi;
-							continue;
-						} else {
-							// 2 bytes, signed
-							y = MU_RBES16(data);
-							data += 2;
-						}
-					}
+				mutt_SpinUnlock(&stream->lock);
+				return MUTT_SUCCESS;
+			}
 
-					// Add as vector to prior value
-					int32_m test_val = prev_y + y;
-					// Verify FUnit range
-					if (test_val < -16384 || test_val > 16383) {
-						mu_free(flags);
-						return MUTT_INVALID_GLYF_SIMPLE_Y_COORD_FUNITS;
-					}
-					// Consider it with currently calculated y min/max
-					if ((test_val < header->y_min) || (pi == 0)) {
-						header->y_min = test_val;
-					}
-					if ((test_val > header->y_max) || (pi == 0)) {
-						header->y_max = test_val;
+			// Allocates glyph data
+			muByte* mutt_StreamGlyphAlloc(muttStream* stream, uint32_m length) {
+				muttTableBlock* block = stream->glyphs;
+				if (!block || block->cap - block->used < length) {
+					// (Each new block doubles the room, so a reset rarely needs to merge)
+					size_m cap = (block) ?(block->cap*2) :(MUTT_TABLE_MIN_BLOCK);
+					if (cap < length) {
+						cap = length;
+					}
+					muttTableBlock* new_block = (muttTableBlock*)mu_malloc(MUTT_TABLE_BLOCK_HEADER + cap);
+					if (!new_block) {
+						return 0;
 					}
-					// Set previous y as current y
-					prev_y = test_val;
-					++pi;
+					new_block->next = block;
+					new_block->cap = cap;
+					new_block->used = 0;
+					stream->glyphs = block = new_block;
 				}
 
-				// Deallocate flags
-				mu_free(flags);
-				return MUTT_SUCCESS; if (font) {}
+				muByte* mem = ((muByte*)block) + MUTT_TABLE_BLOCK_HEADER + block->used;
+				block->used += length;
+				return mem;
 			}
 
-			// Fills in (or calculates memory needed for) "muttCompositeGlyph" struct
-			MUDEF muttResult mutt_composite_glyph(muttFont* font, muttGlyphHeader* header, muttCompositeGlyph* glyph, muByte* data, uint32_m* written) {
-				// Placeholder variables
-				uint32_m req = 0; // Required length
-				muByte* gdata = header->data; // Progressive data pointer
-
-				// For memory calculations:
-				if (!data) {
-					// Loop through each record
-					uint16_m flags = (header->length != 0) ?(MUTT_MORE_COMPONENTS) :(0);
-					uint32_m written_amt = 0;
-					muBool instructions = MU_FALSE;
-					uint32_m component_count = 0;
-
-					while (flags & MUTT_MORE_COMPONENTS) {
-						// Verify component count
-						if (++component_count > font->maxp->max_component_elements) {
-							return MUTT_INVALID_GLYF_COMPOSITE_COMPONENT_COUNT;
-						}
-						// Add component to mem req
-						written_amt += sizeof(muttComponentGlyph);
+			// Gives back all glyph data, keeping only the largest block
+			void mutt_StreamGlyphReset(muttStream* stream) {
+				muttTableBlock* block = stream->glyphs;
+				if (!block) {
+					return;
+				}
+				// (The front block is always the largest)
+				mutt_TableMemoryFree(block->next);
+				block->next = 0;
+				block->used = 0;
+			}
 
-						// Verify length for flags and glyphIndex
-						req += 4;
-						if (header->length < req) {
-							return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
-						}
-						// Read flags for if we have more components and instructions
-						uint16_m this_flags = MU_RBEU16(gdata);
-						flags = this_flags & MUTT_MORE_COMPONENTS;
-						if (this_flags & MUTT_WE_HAVE_INSTRUCTIONS) {
-							instructions = MU_TRUE;
-						}
-						// Skip past flags and glyphIndex
-						gdata += 4;
+			// Reads the data of a glyph
+			muttResult mutt_StreamGlyph(muttStream* stream, uint32_m offset, uint32_m length, muByte** data) {
+				*data = mutt_StreamGlyphAlloc(stream, length);
+				if (!*data) {
+					return MUTT_FAILED_MALLOC;
+				}
+				return mutt_StreamRead(stream, stream->glyf_offset+offset, *data, length);
+			}
 
-						// Add arguments to req length and skip past
-						if (this_flags & MUTT_ARG_1_AND_2_ARE_WORDS) {
-							// 2 bytes per
-							req += 4;
-							gdata += 4;
-						}
-						else {
-							// 1 byte per
-							req += 2;
-							gdata += 2;
-						}
+			// Loads the given tables (initialized with mutt_InitTables) from the
+			// stream in dependency order; glyf's data is left in the stream
+			void mutt_LoadStreamTables(muttFont* font, muttLoadFlags tables) {
+				muttStream* stream = font->stream;
 
-						// Add transform to req length and skip past
-						// We're not checking for mutual exclusivity here, as
-						// it's not relevant to mem req
-						if (this_flags & MUTT_WE_HAVE_A_SCALE) {
-							// One F2DOT14
-							req += 2;
-							gdata += 2;
-						}
-						else if (this_flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE) {
-							// Two F2DOT14s
-							req += 4;
-							gdata += 4;
-						}
-						else if (this_flags & MUTT_WE_HAVE_A_TWO_BY_TWO) {
-							// Four F2DOT14s
-							req += 8;
-							gdata += 8;
-						}
+				for (uint32_m i = 0; i < MUTT_TABLE_LOAD_ORDER_LEN; ++i) {
+					muttLoadFlags table = mutt_TableLoadOrder[i];
+					if (!(tables & table)) {
+						continue;
+					}
 
-						// Verify length for arguments and transform
-						if (header->length < req) {
-							return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
-						}
+					// Find table
+					muttTableRecord* rec = mutt_find_table(font, mutt_TableTag(table));
+					if (!rec) {
+						mutt_LoadTableData(font, table, 0, 0);
+						continue;
 					}
 
-					// Instruction handling
-					if (instructions) {
-						// Verify length for instruction length
-						req += 2;
-						if (header->length < req) {
-							return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+					// glyf; only note its length
+					if (table == MUTT_LOAD_GLYF) {
+						muttGlyf* glyf = (muttGlyf*)mutt_TableAlloc(font, sizeof(muttGlyf));
+						if (!glyf) {
+							font->glyf_res = MUTT_FAILED_MALLOC;
+							continue;
 						}
+						glyf->len = rec->length;
+						glyf->data = 0;
+						mutt_SetTable(font, MUTT_LOAD_GLYF, glyf, MUTT_SUCCESS);
+						continue;
+					}
 
-						// Read instruction length
-						uint16_m instruction_length = MU_RBEU16(gdata);
-						// Verify with maxp
-						if (instruction_length > font->maxp->max_size_of_instructions) {
-							return MUTT_INVALID_GLYF_COMPOSITE_INSTRUCTION_LENGTH;
-						}
-						// Verify length for instructions
-						// Unneeded here since we're just calculating mem req
-						// ...
+					// Read table
+					// (Not through the page cache; each table is only read once)
+					muByte* data = (muByte*)mu_malloc(rec->length ?rec->length :1);
+					if (!data) {
+						mutt_SetTableResult(font, table, MUTT_FAILED_MALLOC);
+						continue;
+					}
+					if (rec->length && !stream->read(stream->user, rec->offset, data, rec->length)) {
+						mutt_SetTableResult(font, table, MUTT_FAILED_READ);
+						mu_free(data);
+						continue;
+					}
 
-						// Add instructions to mem req
-						written_amt += instruction_length;
+					// Verify checksum (unless skipped; see directory loading on head)
+					if (!(font->mode_flags & MUTT_LOAD_SKIP_CHECKSUMS) &&
+						table != MUTT_LOAD_HEAD &&
+						!mutt_VerifyTableChecksum(data, rec->length, rec->checksum)
+					) {
+						mutt_SetTableResult(font, table, MUTT_INVALID_DIRECTORY_RECORD_CHECKSUM);
+						mu_free(data);
+						continue;
 					}
 
-					// Give mem req and exit
-					*written = written_amt;
-					return MUTT_SUCCESS;
+					// Load table
+					mutt_LoadTableData(font, table, data, rec->length);
+					mu_free(data);
 				}
+			}
 
-				// Placeholder variables:
-				muByte* orig_data = data; // (Used for memory usage at the end)
-				uint32_m component_count = 0; // (Used for counting components; u32 to avoid overflow)
-				muBool instructions = MU_FALSE; // (To see if we've found instructions)
-				uint16_m flags = (header->length != 0) ?(MUTT_MORE_COMPONENTS) :(0);
-
-				// Point components array to current data (what we're filling in)
-				glyph->components = (muttComponentGlyph*)data;
-				muttComponentGlyph* c = glyph->components;
+			// Frees a stream
+			void mutt_StreamFree(muttStream* stream) {
+				mutt_TableMemoryFree(stream->glyphs);
+				mu_free(stream->pages);
+				mu_free(stream);
+			}
 
-				// Loop through each component:
-				while (flags & MUTT_MORE_COMPONENTS) {
-					// Verify component count
-					if (component_count > font->maxp->max_component_elements) {
-						return MUTT_INVALID_GLYF_COMPOSITE_COMPONENT_COUNT;
-					}
+			MUDEF muttResult mutt_load_stream(muttReadFunction read, void* user, uint64_m datalen, muttFont* font, muttLoadFlags load_flags) {
+				muttResult res;
 
-					// Verify length for flags and glyphIndex
-					req += 4;
-					if (header->length < req) {
-						return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
-					}
+				// Zero-out font
+				mu_memset(font, 0, sizeof(muttFont));
+				// Store load modes
+				// (There's no data to borrow)
+				font->mode_flags = load_flags & ~(MUTT_LOAD_ALL | MUTT_LOAD_BORROW);
 
-					// Read flags
-					c->flags = MU_RBEU16(gdata);
-					gdata += 2;
-					// Mark next component
-					flags = c->flags & MUTT_MORE_COMPONENTS;
-					// Mark instructions flag
-					if (c->flags & MUTT_WE_HAVE_INSTRUCTIONS) {
-						instructions = MU_TRUE;
-					}
+				// Verify min. length
+				if (datalen < 12) {
+					return MUTT_INVALID_DIRECTORY_LENGTH;
+				}
 
-					// Read glyphIndex
-					c->glyph_index = MU_RBEU16(gdata);
-					gdata += 2;
-					// Verify index range
-					if (c->glyph_index >= font->maxp->num_glyphs) {
-						return MUTT_INVALID_GLYF_COMPOSITE_GLYPH_INDEX;
-					}
+				// Allocate stream
+				muttStream* stream = (muttStream*)mu_malloc(sizeof(muttStream));
+				if (!stream) {
+					return MUTT_FAILED_MALLOC;
+				}
+				mu_memset(stream, 0, sizeof(muttStream));
+				stream->read = read;
+				stream->user = user;
+				stream->datalen = datalen;
+				for (uint32_m p = 0; p < MUTT_STREAM_PAGE_COUNT; ++p) {
+					stream->page_index[p] = MUTT_STREAM_NO_PAGE;
+				}
+				font->stream = stream;
+				// - Allocate pages
+				stream->pages = (muByte*)mu_malloc((size_m)MUTT_STREAM_PAGE_COUNT*MUTT_STREAM_PAGE_SIZE);
+				if (!stream->pages) {
+					mutt_deload(font);
+					return MUTT_FAILED_MALLOC;
+				}
 
-					// Arguments handling:
-					if (c->flags & MUTT_ARG_1_AND_2_ARE_WORDS) {
-						// 2 bytes per argument
+				// Read table directory
+				// - Read start
+				muByte start[12];
+				if (!read(user, 0, start, 12)) {
+					mutt_deload(font);
+					return MUTT_FAILED_READ;
+				}
+				// - Read all records
+				uint32_m dir_len = 12 + ((uint32_m)MU_RBEU16(start+4))*16;
+				if (datalen < dir_len) {
+					mutt_deload(font);
+					return MUTT_INVALID_DIRECTORY_LENGTH;
+				}
+				muByte* dir_data = (muByte*)mu_malloc(dir_len);
+				if (!dir_data) {
+					mutt_deload(font);
+					return MUTT_FAILED_MALLOC;
+				}
+				if (!read(user, 0, dir_data, dir_len)) {
+					mu_free(dir_data);
+					mutt_deload(font);
+					return MUTT_FAILED_READ;
+				}
 
-						// Verify length
-						req += 4;
-						if (header->length < req) {
-							return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
-						}
+				// Allocate table memory; the tables aren't in memory to be measured,
+				// so blocks are made as tables are loaded
+				if (!mutt_TableBlockCreate(font, MUTT_TABLE_ALLOC_SIZE(sizeof(muttDirectory)) + MUTT_TABLE_ALLOC_SIZE(dir_len) + MUTT_TABLE_ALLOC_SIZE(sizeof(uint64_m)*MU_RBEU16(start+4)) + MUTT_TABLE_MIN_BLOCK)) {
+					mu_free(dir_data);
+					mutt_deload(font);
+					return MUTT_FAILED_MALLOC;
+				}
 
-						// Read values
-						if (c->flags & MUTT_ARGS_ARE_XY_VALUES) {
-							// int16 xy values
-							c->argument1 = MU_RBES16(gdata);
-							gdata += 2;
-							c->argument2 = MU_RBES16(gdata);
-							gdata += 2;
-						} else {
-							// uint16 point numbers
-							c->argument1 = MU_RBEU16(gdata);
-							gdata += 2;
-							c->argument2 = MU_RBEU16(gdata);
-							gdata += 2;
-						}
-					} else {
-						// 1 byte per argument
+				// Load table directory
+				// - Allocate
+				font->directory = (muttDirectory*)mutt_TableAlloc(font, sizeof(muttDirectory));
+				if (!font->directory) {
+					mu_free(dir_data);
+					mutt_deload(font);
+					return MUTT_FAILED_MALLOC;
+				}
+				// - Load
+				// (Checksums are verified as each table is read instead)
+				muttLoadFlags mode_flags = font->mode_flags;
+				font->mode_flags |= MUTT_LOAD_SKIP_CHECKSUMS;
+				res = mutt_LoadTableDirectory(font, font->directory, dir_data, datalen, 0);
+				font->mode_flags = mode_flags;
+				mu_free(dir_data);
+				if (mutt_result_is_fatal(res)) {
+					mutt_deload(font);
+					return res;
+				}
 
-						// Verify length
-						req += 2;
-						if (header->length < req) {
-							return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
-						}
+				// Note where glyph data is
+				muttTableRecord* glyf = mutt_find_table(font, mutt_TableTag(MUTT_LOAD_GLYF));
+				if (glyf) {
+					stream->glyf_offset = glyf->offset;
+				}
 
-						// Read values
-						if (c->flags & MUTT_ARGS_ARE_XY_VALUES) {
-							// int8 xy values
-							c->argument1 = MU_RBES8(gdata++);
-							c->argument2 = MU_RBES8(gdata++);
-						} else {
-							// uint8 point numbers
-							c->argument1 = *gdata++;
-							c->argument2 = *gdata++;
-						}
-					}
+				// Leave every table for later if lazy
+				if (font->mode_flags & MUTT_LOAD_LAZY) {
+					font->lazy_flags = MUTT_LOAD_ALL;
+					return MUTT_SUCCESS;
+				}
 
-					// Transform data handling
-					if (c->flags & MUTT_WE_HAVE_A_SCALE) {
-						// One F2DOT14
+				// Init and load tables
+				load_flags &= MUTT_LOAD_ALL;
+				mutt_InitTables(font, load_flags);
+				mutt_LoadStreamTables(font, load_flags);
 
-						// Ensure flag exclusivity
-						if ((c->flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE) || (c->flags & MUTT_WE_HAVE_A_TWO_BY_TWO)) {
-							return MUTT_INVALID_GLYF_COMPOSITE_FLAGS;
-						}
+				// Tables that weren't requested can still be loaded later
+				font->lazy_flags = mutt_LeftoverTables(font, load_flags);
+				return MUTT_SUCCESS;
+			}
 
-						// Verify length
-						req += 2;
-						if (header->length < req) {
-							return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
-						}
+		/* Caches */
+
+			// Increment whenever anything stored in a cache changes layout
+			// (table structs, the cache header, etc.)
+			#define MUTT_CACHE_VERSION 5
+			// "mutc"
+			#define MUTT_CACHE_MAGIC 0x6D757463
+			// Marks a table that isn't in a cache
+			#define MUTT_CACHE_NO_TABLE 0xFFFFFFFF
+			// Amount of table flags
+			#define MUTT_CACHE_TABLES 9
+
+			// The header at the start of a cache, which is followed by the body
+			// (all of the structs and arrays) and then the relocations (the
+			// offset of every pointer within the body, with the lowest bit set
+			// if the pointer points into font data rather than the body)
+			typedef struct muttCacheHeader muttCacheHeader;
+			struct muttCacheHeader {
+				uint32_m magic;
+				uint32_m version;
+				uint32_m pointer_size;
+				uint32_m header_size;
+				// Font data the cache was made from
+				uint64_m font_datalen;
+				uint64_m font_dir_offset;
+				uint32_m font_checksum;
+				muBool external; // If anything points into font data
+				// Body and relocations
+				uint32_m body_len;
+				uint32_m reloc_count;
+				// Font contents
+				muttLoadFlags mode_flags; // Mode flags that change table layout
+				muttLoadFlags load_flags;
+				muttLoadFlags fail_load_flags;
+				uint32_m directory;
+				uint32_m tables[MUTT_CACHE_TABLES];
+				muttResult results[MUTT_CACHE_TABLES];
+			};
+			#define MUTT_CACHE_HEADER_LEN MUTT_TABLE_ALIGN_UP(sizeof(muttCacheHeader))
+
+			// Combines a table record into a directory checksum
+			uint32_m mutt_RecordChecksum(uint32_m tag, uint32_m checksum, uint32_m offset, uint32_m length) {
+				uint32_m h = (tag * 0x9E3779B1) ^ checksum;
+				h = (h ^ (h >> 15)) * 0x85EBCA77;
+				h ^= (offset * 0xC2B2AE3D) + length;
+				return h ^ (h >> 13);
+			}
 
-						// Read
-						c->scales[0] = MUTT_F2DOT14(gdata);
-						gdata += 2;
-					}
-					else if (c->flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE) {
-						// Two F2DOT14s
+			// Returns the checksum of a loaded table directory
+			// (Records are summed, so their order doesn't matter)
+			uint32_m mutt_DirectoryChecksum(muttDirectory* dir) {
+				uint32_m sum = 0;
+				for (uint16_m r = 0; r < dir->num_tables; ++r) {
+					muttTableRecord* rec = &dir->records[r];
+					sum += mutt_RecordChecksum(rec->table_tag_u32, rec->checksum, rec->offset, rec->length);
+				}
+				return sum;
+			}
 
-						// Ensure flag exclusivity
-						if ((c->flags & MUTT_WE_HAVE_A_SCALE) || (c->flags & MUTT_WE_HAVE_A_TWO_BY_TWO)) {
-							return MUTT_INVALID_GLYF_COMPOSITE_FLAGS;
-						}
+			// Returns the checksum of a raw table directory, or 0 if the directory is out of range
+			uint32_m mutt_RawDirectoryChecksum(muByte* data, uint64_m datalen, uint64_m dir_offset) {
+				if (datalen < dir_offset+12) {
+					return 0;
+				}
+				uint16_m num_tables = MU_RBEU16(data+dir_offset+4);
+				if (datalen < dir_offset+12+((uint64_m)num_tables*16)) {
+					return 0;
+				}
+				uint32_m sum = 0;
+				muByte* rec = data+dir_offset+12;
+				for (uint16_m r = 0; r < num_tables; ++r, rec += 16) {
+					sum += mutt_RecordChecksum(MU_RBEU32(rec), MU_RBEU32(rec+4), MU_RBEU32(rec+8), MU_RBEU32(rec+12));
+				}
+				return sum;
+			}
 
-						// Verify length
-						req += 4;
-						if (header->length < req) {
-							return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
-						}
+			// Writes a cache; if body is 0, only the lengths are measured
+			typedef struct muttCacheWriter muttCacheWriter;
+			struct muttCacheWriter {
+				muByte* body;
+				uint32_m body_len;
+				muByte* relocs;
+				uint32_m reloc_count;
+				muBool external;
+				// Font data that pointers can point into
+				muByte* font_data;
+				uint64_m font_datalen;
+			};
 
-						// Read
-						c->scales[0] = MUTT_F2DOT14(gdata);
-						gdata += 2;
-						c->scales[1] = MUTT_F2DOT14(gdata);
-						gdata += 2;
-					}
-					else if (c->flags & MUTT_WE_HAVE_A_TWO_BY_TWO) {
-						// Four F2DOT14s
+			// Offset of a struct member, taken from an instance of the struct
+			#define MUTT_CACHE_MEMBER(s, m) ((uint32_m)(((muByte*)&(s)->m) - ((muByte*)(s))))
 
-						// Ensure flag exclusivity
-						if ((c->flags & MUTT_WE_HAVE_A_SCALE) || (c->flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE)) {
-							return MUTT_INVALID_GLYF_COMPOSITE_FLAGS;
-						}
+			// Copies memory into the body, returning its offset
+			uint32_m mutt_CacheCopy(muttCacheWriter* w, const void* p, uint32_m size) {
+				uint32_m off = w->body_len;
+				w->body_len += (uint32_m)MUTT_TABLE_ALIGN_UP(size);
+				if (w->body && size) {
+					mu_memcpy(w->body+off, p, size);
+				}
+				return off;
+			}
 
-						// Verify length
-						req += 8;
-						if (header->length < req) {
-							return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
-						}
+			// Sets a pointer in the body to the given offset into the body or font data
+			void mutt_CachePoint(muttCacheWriter* w, uint32_m slot, uint64_m target, muBool external) {
+				if (w->body) {
+					size_m value = (size_m)target;
+					mu_memcpy(w->body+slot, &value, sizeof(size_m));
+					uint32_m reloc = slot | ((external) ?(1) :(0));
+					mu_memcpy(w->relocs+(w->reloc_count*4), &reloc, 4);
+				}
+				w->reloc_count += 1;
+				w->external |= external;
+			}
 
-						// Read
-						c->scales[0] = MUTT_F2DOT14(gdata);
-						gdata += 2;
-						c->scales[1] = MUTT_F2DOT14(gdata);
-						gdata += 2;
-						c->scales[2] = MUTT_F2DOT14(gdata);
-						gdata += 2;
-						c->scales[3] = MUTT_F2DOT14(gdata);
-						gdata += 2;
-					}
+			// Sets a pointer in the body to 0
+			void mutt_CacheNull(muttCacheWriter* w, uint32_m slot) {
+				if (w->body) {
+					mu_memset(w->body+slot, 0, sizeof(size_m));
+				}
+			}
 
-					// Increment handle for component and component count
-					++c;
-					++component_count;
+			// Sets a pointer in the body to memory of the given size, referencing
+			// the memory in font data if it's in it, and copying it into the body
+			// otherwise; gives where it ended up
+			uint64_m mutt_CacheRef(muttCacheWriter* w, uint32_m slot, const void* p, uint32_m size, muBool* external) {
+				*external = MU_FALSE;
+				if (!p) {
+					mutt_CacheNull(w, slot);
+					return 0;
 				}
-				// Verify component count
-				if (component_count > font->maxp->max_component_elements) {
-					return MUTT_INVALID_GLYF_COMPOSITE_COMPONENT_COUNT;
+				const muByte* b = (const muByte*)p;
+				if (w->font_data && b >= w->font_data && b < w->font_data+w->font_datalen) {
+					*external = MU_TRUE;
+					mutt_CachePoint(w, slot, (uint64_m)(b-w->font_data), MU_TRUE);
+					return (uint64_m)(b-w->font_data);
 				}
-				// Move past component array
-				data += sizeof(muttComponentGlyph) * component_count;
+				uint32_m off = mutt_CacheCopy(w, p, size);
+				mutt_CachePoint(w, slot, off, MU_FALSE);
+				return off;
+			}
 
-				// Instruction handling
-				if (instructions) {
-					// Point to data
-					glyph->instructions = data;
+			// Writes each table to a cache
 
-					// Verify length for instruction length
-					req += 2;
-					if (header->length < req) {
-						return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
-					}
+			uint32_m mutt_CacheDirectory(muttCacheWriter* w, muttDirectory* dir) {
+				muBool ext;
+				uint32_m off = mutt_CacheCopy(w, dir, sizeof(muttDirectory));
+				mutt_CacheRef(w, off+MUTT_CACHE_MEMBER(dir, records), dir->records, sizeof(muttTableRecord)*dir->num_tables, &ext);
+				mutt_CacheRef(w, off+MUTT_CACHE_MEMBER(dir, sorted), dir->sorted, sizeof(uint64_m)*dir->num_tables, &ext);
+				return off;
+			}
 
-					// Read instruction length
-					glyph->instruction_length = MU_RBEU16(gdata);
-					gdata += 2;
-					// Verify with maxp
-					if (glyph->instruction_length > font->maxp->max_size_of_instructions) {
-						return MUTT_INVALID_GLYF_COMPOSITE_INSTRUCTION_LENGTH;
+			uint32_m mutt_CacheHmtx(muttCacheWriter* w, muttFont* font) {
+				muBool ext;
+				muttHmtx* hmtx = font->hmtx;
+				uint32_m off = mutt_CacheCopy(w, hmtx, sizeof(muttHmtx));
+				uint32_m num_hmetrics = font->hhea->number_of_hmetrics;
+				mutt_CacheRef(w, off+MUTT_CACHE_MEMBER(hmtx, hmetrics), hmtx->hmetrics, sizeof(muttLongHorMetric)*num_hmetrics, &ext);
+				mutt_CacheRef(w, off+MUTT_CACHE_MEMBER(hmtx, left_side_bearings), hmtx->left_side_bearings, 2*(font->maxp->num_glyphs-num_hmetrics), &ext);
+				mutt_CacheRef(w, off+MUTT_CACHE_MEMBER(hmtx, raw), hmtx->raw, (4*num_hmetrics) + (2*(font->maxp->num_glyphs-num_hmetrics)), &ext);
+				mutt_CacheRef(w, off+MUTT_CACHE_MEMBER(hmtx, advances), hmtx->advances, 2*font->maxp->num_glyphs, &ext);
+				mutt_CacheRef(w, off+MUTT_CACHE_MEMBER(hmtx, lsbs), hmtx->lsbs, 2*font->maxp->num_glyphs, &ext);
+				return off;
+			}
+
+			uint32_m mutt_CacheLoca(muttCacheWriter* w, muttFont* font) {
+				muBool ext;
+				muttLoca* loca = font->loca;
+				uint32_m off = mutt_CacheCopy(w, loca, sizeof(muttLoca));
+				uint32_m size = ((uint32_m)font->maxp->num_glyphs+1) * ((font->head->index_to_loc_format == MUTT_OFFSET_16) ?(2) :(4));
+				mutt_CacheRef(w, off+MUTT_CACHE_MEMBER(loca, offsets16), loca->offsets16, size, &ext);
+				return off;
+			}
+
+			uint32_m mutt_CacheName(muttCacheWriter* w, muttName* name) {
+				muBool ext;
+				uint32_m off = mutt_CacheCopy(w, name, sizeof(muttName));
+
+				// String data (only as much as the strings use)
+				uint32_m string_len = 0;
+				for (uint16_m r = 0; r < name->count; ++r) {
+					muttNameRecord* rec = &name->name_records[r];
+					if (rec->string && (uint32_m)(rec->string-name->string_data)+rec->length > string_len) {
+						string_len = (uint32_m)(rec->string-name->string_data)+rec->length;
 					}
+				}
+				for (uint16_m l = 0; l < name->lang_tag_count; ++l) {
+					muttLangTagRecord* rec = &name->lang_tag_records[l];
+					if (rec->lang_tag && (uint32_m)(rec->lang_tag-name->string_data)+rec->length > string_len) {
+						string_len = (uint32_m)(rec->lang_tag-name->string_data)+rec->length;
+					}
+				}
+				muBool string_ext;
+				uint64_m strings = mutt_CacheRef(w, off+MUTT_CACHE_MEMBER(name, string_data), name->string_data, string_len, &string_ext);
 
-					if (glyph->instruction_length > 0) {
-						// Verify length for instructions
-						req += glyph->instruction_length;
-						if (header->length < req) {
-							return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+				// Name records (pointing into the string data)
+				if (name->name_records) {
+					uint32_m records = mutt_CacheCopy(w, name->name_records, sizeof(muttNameRecord)*name->count);
+					mutt_CachePoint(w, off+MUTT_CACHE_MEMBER(name, name_records), records, MU_FALSE);
+					for (uint16_m r = 0; r < name->count; ++r) {
+						muttNameRecord* rec = &name->name_records[r];
+						uint32_m slot = records + (r*sizeof(muttNameRecord)) + MUTT_CACHE_MEMBER(rec, string);
+						if (rec->string) {
+							mutt_CachePoint(w, slot, strings+(uint64_m)(rec->string-name->string_data), string_ext);
+						} else {
+							mutt_CacheNull(w, slot);
 						}
-
-						// Memcpy instructions
-						mu_memcpy(glyph->instructions, gdata, glyph->instruction_length);
-						// Move data past instructions
-						data += glyph->instruction_length;
 					}
 				} else {
-					glyph->instruction_length = 0;
-					glyph->instructions = 0;
+					mutt_CacheRef(w, off+MUTT_CACHE_MEMBER(name, name_records), 0, 0, &ext);
 				}
 
-				// Copy over component count
-				glyph->component_count = (uint16_m)component_count;
-				// Write data written
-				if (written) {
-					*written = data-orig_data;
+				// Language tag records (pointing into the string data)
+				if (name->lang_tag_records) {
+					uint32_m records = mutt_CacheCopy(w, name->lang_tag_records, sizeof(muttLangTagRecord)*name->lang_tag_count);
+					mutt_CachePoint(w, off+MUTT_CACHE_MEMBER(name, lang_tag_records), records, MU_FALSE);
+					for (uint16_m l = 0; l < name->lang_tag_count; ++l) {
+						muttLangTagRecord* rec = &name->lang_tag_records[l];
+						uint32_m slot = records + (l*sizeof(muttLangTagRecord)) + MUTT_CACHE_MEMBER(rec, lang_tag);
+						if (rec->lang_tag) {
+							mutt_CachePoint(w, slot, strings+(uint64_m)(rec->lang_tag-name->string_data), string_ext);
+						} else {
+							mutt_CacheNull(w, slot);
+						}
+					}
+				} else {
+					mutt_CacheRef(w, off+MUTT_CACHE_MEMBER(name, lang_tag_records), 0, 0, &ext);
 				}
-				return MUTT_SUCCESS;
-			}
 
-			// Gets a component of a composite glyph
-			// no_more is set to true when no more components exist
-			MUDEF muttResult mutt_composite_component(muttFont* font, muttGlyphHeader* header, muByte** prog, muttComponentGlyph* component, muBool* no_more) {
-				// Much of this code is very similar to the code in mutt_composite_glyph
+				return off;
+			}
 
-				// So-far component length:
-				uint32_m req = (*prog) - header->data;
+			uint32_m mutt_CacheGlyf(muttCacheWriter* w, muttGlyf* glyf) {
+				muBool ext;
+				uint32_m off = mutt_CacheCopy(w, glyf, sizeof(muttGlyf));
+				mutt_CacheRef(w, off+MUTT_CACHE_MEMBER(glyf, data), glyf->data, glyf->len, &ext);
+				return off;
+			}
 
-				// Verify length for flags and glyphIndex
-				req += 4;
-				if (header->length < req) {
-					return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+			uint32_m mutt_CacheCmap(muttCacheWriter* w, muttCmap* cmap) {
+				muBool ext;
+				uint32_m off = mutt_CacheCopy(w, cmap, sizeof(muttCmap));
+				if (!cmap->encoding_records) {
+					mutt_CacheNull(w, off+MUTT_CACHE_MEMBER(cmap, encoding_records));
+					return off;
 				}
 
-				// Read flags
-				component->flags = MU_RBEU16(*prog);
-				*prog += 2;
-				// Mark next component
-				if (!(component->flags & MUTT_MORE_COMPONENTS)) {
-					*no_more = MU_TRUE;
-				}
+				// Encoding records
+				uint32_m records = mutt_CacheCopy(w, cmap->encoding_records, sizeof(muttEncodingRecord)*cmap->num_tables);
+				mutt_CachePoint(w, off+MUTT_CACHE_MEMBER(cmap, encoding_records), records, MU_FALSE);
 
-				// Read glyphIndex
-				component->glyph_index = MU_RBEU16(*prog);
-				*prog += 2;
-				// Verify index range
-				if (component->glyph_index >= font->maxp->num_glyphs) {
-					return MUTT_INVALID_GLYF_COMPOSITE_GLYPH_INDEX;
-				}
-
-				// Argument handling:
-				if (component->flags & MUTT_ARG_1_AND_2_ARE_WORDS) {
-					// 2 bytes per arg.
-					req += 4;
-					if (header->length < req) {
-						return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+				// Format of each encoding record
+				for (uint16_m t = 0; t < cmap->num_tables; ++t) {
+					muttEncodingRecord* rec = &cmap->encoding_records[t];
+					uint32_m slot = records + (t*sizeof(muttEncodingRecord)) + MUTT_CACHE_MEMBER(rec, encoding);
+					if (mutt_result_is_fatal(rec->result)) {
+						mutt_CacheNull(w, slot);
+						continue;
 					}
 
-					// Read values
-					if (component->flags & MUTT_ARGS_ARE_XY_VALUES) {
-						// int16 xy values
-						component->argument1 = MU_RBES16(*prog);
-						*prog += 2;
-						component->argument2 = MU_RBES16(*prog);
-						*prog += 2;
-					} else {
-						// uint16 point numbers
-						component->argument1 = MU_RBEU16(*prog);
-						*prog += 2;
-						component->argument2 = MU_RBEU16(*prog);
-						*prog += 2;
+					switch (rec->format) {
+						default: mutt_CacheNull(w, slot); break;
+						case 0: {
+							mutt_CacheRef(w, slot, rec->encoding.f0, sizeof(muttCmap0), &ext);
+						} break;
+						case 4: {
+							muttCmap4* f4 = rec->encoding.f4;
+							uint32_m f4_off = mutt_CacheCopy(w, f4, sizeof(muttCmap4));
+							mutt_CachePoint(w, slot, f4_off, MU_FALSE);
+							mutt_CacheRef(w, f4_off+MUTT_CACHE_MEMBER(f4, seg), f4->seg, sizeof(muttCmap4Segment)*f4->seg_count, &ext);
+							mutt_CacheRef(w, f4_off+MUTT_CACHE_MEMBER(f4, glyph_ids), f4->glyph_ids, 2*f4->glyph_id_count, &ext);
+							mutt_CacheRef(w, f4_off+MUTT_CACHE_MEMBER(f4, end_codes), f4->end_codes, 2*f4->seg_count, &ext);
+						} break;
+						case 12: {
+							muttCmap12* f12 = rec->encoding.f12;
+							uint32_m f12_off = mutt_CacheCopy(w, f12, sizeof(muttCmap12));
+							mutt_CachePoint(w, slot, f12_off, MU_FALSE);
+							mutt_CacheRef(w, f12_off+MUTT_CACHE_MEMBER(f12, groups), f12->groups, sizeof(muttCmap12Group)*f12->num_groups, &ext);
+						} break;
 					}
 				}
-				else {
-					// 1 byte per arg.
-					req += 2;
-					if (header->length < req) {
-						return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
-					}
 
-					// Read values
-					if (component->flags & MUTT_ARGS_ARE_XY_VALUES) {
-						// int8 xy values
-						component->argument1 = MU_RBES8((*prog)++);
-						component->argument2 = MU_RBES8((*prog)++);
-					} else {
-						// uint8 point numbers
-						component->argument1 = MU_RBEU8((*prog)++);
-						component->argument2 = MU_RBEU8((*prog)++);
-					}
-				}
+				return off;
+			}
 
-				// Transform data handling
-				if (component->flags & MUTT_WE_HAVE_A_SCALE) {
-					// One F2DOT14
-					req += 2;
-					if (header->length < req) {
-						return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
-					}
+			// Returns the loaded tables of a font that can be stored in a cache
+			// (A streamed font's glyph data was never read in)
+			muttLoadFlags mutt_CacheTables(muttFont* font) {
+				if (font->stream) {
+					return font->load_flags & ~MUTT_LOAD_GLYF;
+				}
+				return font->load_flags;
+			}
 
-					// Flag exclusivity
-					if ((component->flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE) || (component->flags & MUTT_WE_HAVE_A_TWO_BY_TWO)) {
-						return MUTT_INVALID_GLYF_COMPOSITE_FLAGS;
-					}
+			// Writes the directory and every loaded table of a font to a cache
+			void mutt_CacheFont(muttCacheWriter* w, muttFont* font, muttCacheHeader* header) {
+				header->directory = mutt_CacheDirectory(w, font->directory);
 
-					// Read value
-					component->scales[0] = MUTT_F2DOT14(*prog);
-					*prog += 2;
-				}
-				else if (component->flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE) {
-					// Two F2DOT14s
-					req += 4;
-					if (header->length < req) {
-						return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+				muttLoadFlags tables = mutt_CacheTables(font);
+				for (uint32_m i = 0; i < MUTT_CACHE_TABLES; ++i) {
+					muttLoadFlags table = 1 << i;
+					header->tables[i] = MUTT_CACHE_NO_TABLE;
+					if (!(tables & table)) {
+						// (Loaded tables left out are left to be required)
+						header->results[i] = (font->load_flags & table) ?(0) :(mutt_TableResult(font, table));
+						continue;
 					}
+					header->results[i] = mutt_TableResult(font, table);
 
-					// Flag exclusivity
-					if ((component->flags & MUTT_WE_HAVE_A_SCALE) || (component->flags & MUTT_WE_HAVE_A_TWO_BY_TWO)) {
-						return MUTT_INVALID_GLYF_COMPOSITE_FLAGS;
+					switch (table) {
+						default: break;
+						case MUTT_LOAD_MAXP: header->tables[i] = mutt_CacheCopy(w, font->maxp, sizeof(muttMaxp)); break;
+						case MUTT_LOAD_HEAD: header->tables[i] = mutt_CacheCopy(w, font->head, sizeof(muttHead)); break;
+						case MUTT_LOAD_HHEA: header->tables[i] = mutt_CacheCopy(w, font->hhea, sizeof(muttHhea)); break;
+						case MUTT_LOAD_HMTX: header->tables[i] = mutt_CacheHmtx(w, font); break;
+						case MUTT_LOAD_LOCA: header->tables[i] = mutt_CacheLoca(w, font); break;
+						case MUTT_LOAD_NAME: header->tables[i] = mutt_CacheName(w, font->name); break;
+						case MUTT_LOAD_GLYF: header->tables[i] = mutt_CacheGlyf(w, font->glyf); break;
+						case MUTT_LOAD_CMAP: header->tables[i] = mutt_CacheCmap(w, font->cmap); break;
 					}
+				}
+			}
 
-					// Read values
-					component->scales[0] = MUTT_F2DOT14(*prog);
-					*prog += 2;
-					component->scales[1] = MUTT_F2DOT14(*prog);
-					*prog += 2;
+			MUDEF muttResult mutt_font_serialize(muttFont* font, muByte* data, uint32_m* written) {
+				muttCacheHeader header;
+				mu_memset(&header, 0, sizeof(muttCacheHeader));
+
+				// Measure
+				muttCacheWriter w;
+				mu_memset(&w, 0, sizeof(muttCacheWriter));
+				w.font_data = font->data;
+				w.font_datalen = font->datalen;
+				mutt_CacheFont(&w, font, &header);
+				uint32_m body_len = w.body_len;
+				uint32_m reloc_count = w.reloc_count;
+				uint32_m len = (uint32_m)MUTT_CACHE_HEADER_LEN + body_len + (reloc_count*4);
+				if (!data) {
+					*written = len;
+					return MUTT_SUCCESS;
 				}
-				else if (component->flags & MUTT_WE_HAVE_A_TWO_BY_TWO) {
-					// Four F2DOT14s
-					req += 8;
-					if (header->length < req) {
-						return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
-					}
 
-					// Flag exclusivity
-					if ((component->flags & MUTT_WE_HAVE_A_SCALE) || (component->flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE)) {
-						return MUTT_INVALID_GLYF_COMPOSITE_FLAGS;
-					}
+				// Write body and relocations
+				mu_memset(data, 0, MUTT_CACHE_HEADER_LEN + body_len);
+				w.body = data + MUTT_CACHE_HEADER_LEN;
+				w.body_len = 0;
+				w.relocs = w.body + body_len;
+				w.reloc_count = 0;
+				mutt_CacheFont(&w, font, &header);
+
+				// Write header
+				header.magic = MUTT_CACHE_MAGIC;
+				header.version = MUTT_CACHE_VERSION;
+				header.pointer_size = sizeof(void*);
+				header.header_size = sizeof(muttCacheHeader);
+				header.font_datalen = (font->stream) ?(font->stream->datalen) :(font->datalen);
+				header.font_dir_offset = font->directory->offset;
+				header.font_checksum = mutt_DirectoryChecksum(font->directory);
+				header.external = w.external;
+				header.body_len = body_len;
+				header.reloc_count = reloc_count;
+				header.mode_flags = font->mode_flags & (MUTT_LOAD_COMPACT|MUTT_LOAD_DENSE);
+				header.load_flags = mutt_CacheTables(font);
+				header.fail_load_flags = font->fail_load_flags;
+				mu_memcpy(data, &header, sizeof(muttCacheHeader));
 
-					// Read values
-					component->scales[0] = MUTT_F2DOT14(*prog);
-					*prog += 2;
-					component->scales[1] = MUTT_F2DOT14(*prog);
-					*prog += 2;
-					component->scales[2] = MUTT_F2DOT14(*prog);
-					*prog += 2;
-					component->scales[3] = MUTT_F2DOT14(*prog);
-					*prog += 2;
+				if (written) {
+					*written = len;
 				}
-
 				return MUTT_SUCCESS;
 			}
 
-			// Gets the glyph index component by component within a composite glyph
-			// no_more is set to true when no more components exist
-			// ^ There will always be at least one component from what I'm aware
-			MUDEF muttResult mutt_composite_component_glyph(muttFont* font, muttGlyphHeader* header, muByte** prog, uint16_m* glyph_index, muBool* no_more) {
-				// prog is always at the beginning of a component record
+			MUDEF muttResult mutt_font_load_cache(muByte* cache, uint64_m cachelen, muByte* data, uint64_m datalen, muttFont* font) {
+				// Zero-out font
+				mu_memset(font, 0, sizeof(muttFont));
 
-				// Ensure length for flags + glyphIndex
-				if (((*prog+4)-header->data) > header->length) {
-					return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+				// Read & verify header
+				muttCacheHeader header;
+				if (cachelen < MUTT_CACHE_HEADER_LEN) {
+					return MUTT_INVALID_CACHE_LENGTH;
+				}
+				mu_memcpy(&header, cache, sizeof(muttCacheHeader));
+				if (header.magic != MUTT_CACHE_MAGIC) {
+					return MUTT_INVALID_CACHE_MAGIC;
+				}
+				if (header.version != MUTT_CACHE_VERSION || header.pointer_size != sizeof(void*) || header.header_size != sizeof(muttCacheHeader)) {
+					return MUTT_INVALID_CACHE_VERSION;
+				}
+				if (cachelen < MUTT_CACHE_HEADER_LEN + (uint64_m)header.body_len + ((uint64_m)header.reloc_count*4)) {
+					return MUTT_INVALID_CACHE_LENGTH;
 				}
 
-				// Read flags to see if there's any more after this
-				uint16_m flags = MU_RBEU16(*prog);
-				*prog += 2;
-				if (!(flags & MUTT_MORE_COMPONENTS)) {
-					*no_more = MU_TRUE;
+				// Verify font data
+				if (data) {
+					if (datalen != header.font_datalen || mutt_RawDirectoryChecksum(data, datalen, header.font_dir_offset) != header.font_checksum) {
+						return MUTT_INVALID_CACHE_FONT;
+					}
+				} else if (header.external) {
+					return MUTT_CACHE_REQUIRES_DATA;
 				}
-				// Read glyphIndex
-				uint16_m read_glyph_index = MU_RBEU16(*prog);
-				*prog += 2;
-				if (read_glyph_index >= font->maxp->num_glyphs) {
-					return MUTT_INVALID_GLYF_COMPOSITE_GLYPH_INDEX;
+
+				// Tables are laid out as they were in the cached font
+				font->mode_flags = header.mode_flags & (MUTT_LOAD_COMPACT|MUTT_LOAD_DENSE);
+
+				// Copy body into table memory
+				if (!mutt_TableBlockCreate(font, MUTT_TABLE_ALLOC_SIZE(header.body_len))) {
+					return MUTT_FAILED_MALLOC;
 				}
+				muByte* body = (muByte*)mutt_TableAlloc(font, header.body_len);
+				mu_memcpy(body, cache+MUTT_CACHE_HEADER_LEN, header.body_len);
 
-				// Increment prog past argument1 and argument2
-				if (flags & MUTT_ARG_1_AND_2_ARE_WORDS) {
-					*prog += 4;
-				} else {
-					*prog += 2;
+				// Relocate each pointer
+				muByte* relocs = cache+MUTT_CACHE_HEADER_LEN+header.body_len;
+				for (uint32_m r = 0; r < header.reloc_count; ++r) {
+					uint32_m reloc;
+					mu_memcpy(&reloc, relocs+(r*4), 4);
+					muBool external = (reloc & 1) != 0;
+					uint32_m slot = reloc & ~((uint32_m)1);
+					if ((uint64_m)slot+sizeof(size_m) > header.body_len) {
+						mutt_deload(font);
+						return MUTT_INVALID_CACHE_POINTER;
+					}
+					size_m* pointer = (size_m*)(body+slot);
+					if (*pointer >= ((external) ?(datalen) :(header.body_len))) {
+						mutt_deload(font);
+						return MUTT_INVALID_CACHE_POINTER;
+					}
+					*pointer = (size_m)(((external) ?(data) :(body)) + *pointer);
 				}
 
-				// Increment prog past transform data
-				// (Not checking for flag exclusivity)
-				if (flags & MUTT_WE_HAVE_A_SCALE) {
-					*prog += 2;
-				} else if (flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE) {
-					*prog += 4;
-				} else if (flags & MUTT_WE_HAVE_A_TWO_BY_TWO) {
-					*prog += 8;
+				// Fill in font
+				if (header.directory >= header.body_len) {
+					mutt_deload(font);
+					return MUTT_INVALID_CACHE_POINTER;
+				}
+				font->directory = (muttDirectory*)(body+header.directory);
+				for (uint32_m i = 0; i < MUTT_CACHE_TABLES; ++i) {
+					muttLoadFlags table = 1 << i;
+					if (header.tables[i] == MUTT_CACHE_NO_TABLE) {
+						mutt_SetTableResult(font, table, header.results[i]);
+					} else if (header.tables[i] < header.body_len) {
+						mutt_SetTable(font, table, body+header.tables[i], header.results[i]);
+					} else {
+						mutt_deload(font);
+						return MUTT_INVALID_CACHE_POINTER;
+					}
 				}
+				font->fail_load_flags = header.fail_load_flags;
+				font->datalen = header.font_datalen;
 
-				// (Not checking for length after argument1, argument2, and transform
-				// since we're not reading data from there)
+				// Borrow font data if given, which also lets tables not in the cache be required
+				if (data) {
+					font->mode_flags |= MUTT_LOAD_BORROW;
+					font->data = data;
+					font->lazy_flags = MUTT_LOAD_ALL & ~(header.load_flags | header.fail_load_flags);
+				}
 
-				// Write gylphIndex and give success
-				*glyph_index = read_glyph_index;
 				return MUTT_SUCCESS;
 			}
 
-			// Composite glyph memory maximum
-			MUDEF uint32_m mutt_composite_glyph_max_size(muttFont* font) {
-				return
-					// components
-					(font->maxp->max_component_elements*sizeof(muttComponentGlyph))
-					// instructions
-					+(font->maxp->max_size_of_instructions)
-				;
+		/* Registries */
+
+			// States of a registry font
+			#define MUTT_REGISTRY_LOADING 0
+			#define MUTT_REGISTRY_LOADED 1
+			#define MUTT_REGISTRY_FAILED 2
+
+			// A font of a registry
+			// (The font comes first so that a font pointer given by the registry is also its entry)
+			struct muttRegistryEntry {
+				muttFont font;
+				muttRegistryEntry* next;
+				uint64_m hash; // Hash of the start of the data
+				muByte* data; // Data the font was loaded from (borrowed, or copied after the entry)
+				uint64_m datalen;
+				uint64_m memory; // Memory held by the font (and data copy) when last counted
+				uint32_m refs; // Amount of retrievals not yet released
+				uint32_m used; // Tick of when it was last used
+				volatile uint32_m state;
+				muttResult result; // Result of loading the font
+			};
+
+			// Amount of bytes at the start of font data that are hashed to look it up
+			// (Enough to cover the table directory of nearly every font, which holds
+			// the offset, length, and checksum of each table)
+			#define MUTT_REGISTRY_KEY_SIZE 1024
+
+			// Hashes font data, 32 bytes at a time in four lanes
+			uint64_m mutt_HashData(muByte* data, uint64_m datalen) {
+				const uint64_m prime = 0x9E3779B97F4A7C15ULL;
+				uint64_m lanes[4] = { datalen, datalen^prime, datalen+prime, ~datalen };
+				uint64_m i = 0;
+				for (; i+32 <= datalen; i += 32) {
+					for (uint32_m l = 0; l < 4; ++l) {
+						uint64_m v;
+						mu_memcpy(&v, data+i+(l*8), 8);
+						lanes[l] = (lanes[l] ^ v) * prime;
+						lanes[l] ^= lanes[l] >> 29;
+					}
+				}
+				// Remaining bytes
+				for (; i < datalen; ++i) {
+					lanes[i%4] = (lanes[i%4] ^ data[i]) * prime;
+				}
+				// Combine lanes
+				uint64_m hash = 0;
+				for (uint32_m l = 0; l < 4; ++l) {
+					hash = (hash ^ lanes[l]) * 0xC2B2AE3D27D4EB4FULL;
+					hash ^= hash >> 31;
+				}
+				return hash;
 			}
 
-			// Glyph memory maximum
-			MUDEF uint32_m mutt_glyph_max_size(muttFont* font) {
-				// Simple:
-				uint32_m s = mutt_simple_glyph_max_size(font);
-				// Composite:
-				uint32_m c = mutt_composite_glyph_max_size(font);
-				// Return greatest
-				return (s>c) ?(s) :(c);
+			MUDEF uint64_m mutt_font_memory(muttFont* font) {
+				uint64_m memory = 0;
+				mutt_SpinLock(&font->lock);
+				for (muttTableBlock* block = (muttTableBlock*)font->memory; block; block = block->next) {
+					memory += MUTT_TABLE_BLOCK_HEADER + block->cap;
+				}
+				mutt_SpinUnlock(&font->lock);
+				return memory;
 			}
 
-		/* Misc. */
+			MUDEF void mutt_registry_create(muttFontRegistry* registry, uint64_m budget, muttLoadFlags load_flags) {
+				mu_memset(registry, 0, sizeof(muttFontRegistry));
+				registry->budget = budget;
+				registry->load_flags = load_flags;
+			}
 
-			// Performs idDelta logic
-			MUDEF uint16_m mutt_id_delta(uint16_m character_code, int16_m delta) {
-				// Just return if idDelta is 0
-				if (delta == 0) {
-					return character_code;
+			// Removes an entry from a registry's list
+			void mutt_RegistryRemove(muttFontRegistry* registry, muttRegistryEntry* entry) {
+				muttRegistryEntry** link = &registry->entries;
+				while (*link != entry) {
+					link = &(*link)->next;
 				}
+				*link = entry->next;
+				registry->num_fonts -= 1;
+			}
 
-				// Do modulo 65536 on a larger type to add without overflow
-				int32_m big_id = (int32_m)(character_code + delta) % 65536;
-				// Prevent negative cases by adding 65536 for cases under 0
-				if (big_id < 0) {
-					big_id += 65536;
+			// Deloads the least recently used fonts not in use until the registry is
+			// within budget (or there are none left to deload)
+			void mutt_RegistryEvict(muttFontRegistry* registry) {
+				while (registry->memory > registry->budget) {
+					// Find least recently used font not in use
+					// (Ticks wrap, so compare by how long ago they were)
+					muttRegistryEntry* lru = 0;
+					for (muttRegistryEntry* entry = registry->entries; entry; entry = entry->next) {
+						if (entry->refs || entry->state != MUTT_REGISTRY_LOADED) {
+							continue;
+						}
+						if (!lru || registry->tick - entry->used > registry->tick - lru->used) {
+							lru = entry;
+						}
+					}
+					if (!lru) {
+						return;
+					}
+
+					// Deload it
+					mutt_RegistryRemove(registry, lru);
+					registry->memory -= lru->memory;
+					mutt_deload(&lru->font);
+					mu_free(lru);
 				}
-				// Return that but now u16, which (I think) big_id is guaranteed to fit in
-				return (uint16_m)big_id;
 			}
 
-	/* Raster API */
+			// Lets go of a retrieval of an entry; lock must be held
+			void mutt_RegistryUnpin(muttFontRegistry* registry, muttRegistryEntry* entry) {
+				entry->refs -= 1;
+				// (Failed entries have been taken out of the registry; the last one to let go frees it)
+				if (entry->state == MUTT_REGISTRY_FAILED) {
+					if (!entry->refs) {
+						mu_free(entry);
+					}
+					return;
+				}
+				mutt_RegistryEvict(registry);
+			}
 
-		/* Math */
+			MUDEF muttResult mutt_registry_acquire(muttFontRegistry* registry, muByte* data, uint64_m datalen, muttFont** font) {
+				uint64_m hash = mutt_HashData(data, (datalen < MUTT_REGISTRY_KEY_SIZE) ?(datalen) :(MUTT_REGISTRY_KEY_SIZE));
+				mutt_SpinLock(&registry->lock);
 
-			// Float epsilon macro used for countering floating point imprecision in line calculations
-			// This value is unabashedly stolen from stb_truetype, but it works real well
-			#define MUTTR_LINE_EPSILON32 (1.f/1024.f)
+				// Find font
+				muttRegistryEntry* entry = registry->entries;
+				while (entry) {
+					if (entry->hash != hash || entry->datalen != datalen) {
+						entry = entry->next;
+						continue;
+					}
 
-			// Double epsilon macro used for same purpose as MUTTR_LINE_EPSILON32; not used as of right now
-			// This value should be tested and vetted more thoroughly if it's going to be used
-			#define MUTTR_LINE_EPSILON64 0.00000001
+					// Hold onto it so that its data can be compared without the lock
+					entry->refs += 1;
+					entry->used = ++registry->tick;
+					mutt_SpinUnlock(&registry->lock);
 
-			// Calculates IF a ray intersects a line
-			static inline muBool muttR_LineRay(float ry, float y0, float y1) {
-				// Any of these conditions must be true for intersection:
-				return
-					// Ray y is between y0 and y1 with forgiving epsilons:
-					(ry >= y0-MUTTR_LINE_EPSILON32 && ry <= y1+MUTTR_LINE_EPSILON32) ||
-					(ry >= y1-MUTTR_LINE_EPSILON32 && ry <= y0+MUTTR_LINE_EPSILON32)
-					// Line is horizontal:
-					|| (y1-y0 == 0.f)
-				;
+					// Wait for it to be loaded if another thread is loading it
+					// (Its data isn't copied until then, and borrowed data may be gone once it's failed)
+					while (mutt_AtomicLoad(&entry->state) == MUTT_REGISTRY_LOADING) {
+						mutt_Yield();
+					}
+					if (mutt_AtomicLoad(&entry->state) == MUTT_REGISTRY_LOADED &&
+						(entry->data == data || mu_memcmp(entry->data, data, (size_m)datalen) == 0)
+					) {
+						*font = &entry->font;
+						return entry->result;
+					}
+
+					// Different font (or failed to load); let go of it and keep looking
+					// (Failed fonts are taken out of the registry, so the search starts over)
+					mutt_SpinLock(&registry->lock);
+					muttRegistryEntry* next = (entry->state == MUTT_REGISTRY_FAILED) ?(registry->entries) :(entry->next);
+					mutt_RegistryUnpin(registry, entry);
+					entry = next;
+				}
+
+				// Not in registry; add it as loading
+				muBool borrow = (registry->load_flags & (MUTT_LOAD_BORROW | MUTT_LOAD_LAZY)) != 0;
+				uint64_m copy = (borrow) ?(0) :(datalen);
+				entry = (muttRegistryEntry*)mu_malloc(sizeof(muttRegistryEntry) + (size_m)copy);
+				if (!entry) {
+					mutt_SpinUnlock(&registry->lock);
+					return MUTT_FAILED_MALLOC;
+				}
+				mu_memset(entry, 0, sizeof(muttRegistryEntry));
+				entry->hash = hash;
+				entry->data = data;
+				entry->datalen = datalen;
+				entry->refs = 1;
+				entry->used = ++registry->tick;
+				entry->state = MUTT_REGISTRY_LOADING;
+				entry->next = registry->entries;
+				registry->entries = entry;
+				registry->num_fonts += 1;
+				mutt_SpinUnlock(&registry->lock);
+
+				// Load it (without holding the lock, so other fonts can be retrieved meanwhile)
+				// (Fonts that don't borrow their data keep a copy of it to be compared
+				// against, which the font borrows its tables from instead of copying them)
+				muttLoadFlags load_flags = registry->load_flags;
+				if (!borrow) {
+					entry->data = (muByte*)(entry+1);
+					mu_memcpy(entry->data, data, (size_m)datalen);
+					load_flags |= MUTT_LOAD_BORROW;
+				}
+				muttResult res = mutt_load(entry->data, datalen, &entry->font, load_flags);
+				uint64_m memory = (mutt_result_is_fatal(res)) ?(0) :(mutt_font_memory(&entry->font) + copy);
+
+				mutt_SpinLock(&registry->lock);
+				entry->result = res;
+				// - Failed; take it out of the registry
+				if (mutt_result_is_fatal(res)) {
+					mutt_RegistryRemove(registry, entry);
+					mutt_AtomicStore(&entry->state, MUTT_REGISTRY_FAILED);
+					mutt_RegistryUnpin(registry, entry);
+					mutt_SpinUnlock(&registry->lock);
+					return res;
+				}
+				// - Loaded; count its memory (which may put the registry over budget)
+				entry->memory = memory;
+				registry->memory += memory;
+				mutt_AtomicStore(&entry->state, MUTT_REGISTRY_LOADED);
+				mutt_RegistryEvict(registry);
+				mutt_SpinUnlock(&registry->lock);
+
+				*font = &entry->font;
+				return res;
 			}
 
-			// Calculates the x-value intersection of a ray and a line
-			static inline float muttR_LineRayHit(float ry, float x0, float y0, float x1, float y1) {
-				// (https://math.stackexchange.com/a/2297532)
-				return x0 + (
-					((ry-y0) * (x1-x0))
-					/
-					(y1-y0)
-				);
+			MUDEF void mutt_registry_release(muttFontRegistry* registry, muttFont* font) {
+				muttRegistryEntry* entry = (muttRegistryEntry*)font;
+
+				// Recount memory, as tables may have been required since it was counted
+				uint64_m memory = mutt_font_memory(font);
+				if (entry->data == (muByte*)(entry+1)) {
+					memory += entry->datalen;
+				}
+
+				mutt_SpinLock(&registry->lock);
+				registry->memory = registry->memory - entry->memory + memory;
+				entry->memory = memory;
+				entry->refs -= 1;
+				entry->used = ++registry->tick;
+				mutt_RegistryEvict(registry);
+				mutt_SpinUnlock(&registry->lock);
 			}
 
-			// Calculates the x- and y-value of a point on a Bezier curve (on, off, on) given t.
-			static inline void muttR_Bezier(float t,
-				float x0, float y0, float x1, float y1, float x2, float y2,
-				float* x, float* y
-			) {
-				// I think this can be optimized, but idk...
-				*x = ((1.f-t)*(1.f-t)*x0) + (2.f*(1.f-t)*t*x1) + (t*t*x2);
-				*y = ((1.f-t)*(1.f-t)*y0) + (2.f*(1.f-t)*t*y1) + (t*t*y2);
+			MUDEF void mutt_registry_deload(muttFontRegistry* registry) {
+				muttRegistryEntry* entry = registry->entries;
+				while (entry) {
+					muttRegistryEntry* next = entry->next;
+					mutt_deload(&entry->font);
+					mu_free(entry);
+					entry = next;
+				}
+				registry->entries = 0;
+				registry->num_fonts = 0;
+				registry->memory = 0;
 			}
 
-		/* Raster shape setup */
+		/* Glyf stuff */
 
-			/* Definitions */
+			// Returns whether or not a glyph can be decoded without verifying it
+			muBool mutt_GlyphTrusted(muttFont* font, uint16_m glyph_id) {
+				if (font->mode_flags & MUTT_LOAD_TRUSTED) {
+					return MU_TRUE;
+				}
+				// (Bits are only ever set once the bitset exists, so a glyph
+				// being validated meanwhile just goes through the checks)
+				uint32_m* validated = (uint32_m*)mutt_AtomicLoadPtr((void* volatile*)&font->validated);
+				return validated && ((mutt_AtomicLoad(&validated[glyph_id/32]) >> (glyph_id%32)) & 1);
+			}
 
-				// A raster shape is made up of lines, a line is defined by two points
-				struct muttR_Line {
-					// 0 is bottom, 1 is top (y0 <= y1)
-					float x0;
-					float y0;
-					float x1;
-					float y1;
-					// vec = y1-y0 (for direction)
-					float vec;
-				};
-				typedef struct muttR_Line muttR_Line;
-
-				// Used to sort the lines in increasing order of bottom point
-				int muttR_CompareLines(const void* p, const void* q) {
-					// Get lines
-					muttR_Line* l0 = (muttR_Line*)p, * l1 = (muttR_Line*)q;
-					// Return value to indicate ascending y0
-					if (l0->y0 < l1->y0) {
-						return -1;
-					} else if (l0->y0 > l1->y0) {
-						return 1;
-					}
-					// If equal, indicate descending y1
-					else if (l0->y1 > l1->y1) {
-						return -1;
-					}
-					else if (l0->y1 < l1->y1) {
-						return 1;
-					}
-					return 0;
+			// Returns whether or not a glyph header can be decoded without verifying
+			// the glyph, which is decided by the font rather than the header itself
+			// (A header whose data isn't where its glyph's data is in the font goes
+			// through the checks, as it isn't the glyph that was trusted)
+			muBool mutt_HeaderTrusted(muttFont* font, muttGlyphHeader* header) {
+				if (header->length == 0 || header->glyph_id >= font->maxp->num_glyphs || !mutt_GlyphTrusted(font, header->glyph_id)) {
+					return MU_FALSE;
 				}
+				uint32_m offset = mutt_loca_offset(font, header->glyph_id);
+				if (((uint64_m)header->length)+10 != mutt_loca_offset(font, ((uint32_m)header->glyph_id)+1) - offset) {
+					return MU_FALSE;
+				}
+				// (Streamed glyph data is read into the stream's memory)
+				return font->stream || header->data == &font->glyf->data[offset+10];
+			}
 
-				// Calculates the winding for a given line
-				static inline int8_m muttR_LineWinding(float ry, muttR_Line* line) {
-					// Don't consider winding if we're directly intersecting the high point of line
-					if (mu_fabsf(ry - line->y0) <= MUTTR_LINE_EPSILON32) {
-						return 0;
-					}
-
-					// Return winding order based on vector; down is +1, up is -1, neither is 0
-					if (line->vec < 0.f) {
-						return 1;
-					} else if (line->vec > 0.f) {
-						return -1;
+			// Fills in the "muttGlyphHeader" struct; "nested" is for glyphs
+			// retrieved while processing another glyph (such as composite
+			// components), whose data must not replace the other glyph's
+			muttResult mutt_GlyphHeader(muttFont* font, uint16_m glyph_id, muttGlyphHeader* header, muBool nested) {
+				// Get offset and length of glyph
+				uint32_m offset = mutt_loca_offset(font, glyph_id);
+				header->length = mutt_loca_offset(font, ((uint32_m)glyph_id)+1) - offset;
+
+				// Get data of glyph
+				// - Streamed; read it in
+				if (font->stream) {
+					// (A glyph that isn't nested means the glyphs from before are done)
+					if (!nested) {
+						mutt_StreamGlyphReset(font->stream);
+					}
+					if (header->length) {
+						muttResult res = mutt_StreamGlyph(font->stream, offset, header->length, &header->data);
+						if (mutt_result_is_fatal(res)) {
+							return res;
+						}
 					}
-					return 0;
+				}
+				// - In memory
+				else {
+					header->data = &font->glyf->data[offset];
 				}
 
-				// A raster shape is just a collection of lines representing a glyph
-				struct muttR_Shape {
-					uint32_m num_lines;
-					muttR_Line* lines;
-					float x_max;
-					float y_max;
-				};
-				typedef struct muttR_Shape muttR_Shape;
+				// If header length is 0, we set everything to 0 and return
+				// (because no outline)
+				if (header->length == 0) {
+					mu_memset(header, 0, sizeof(muttGlyphHeader));
+					header->glyph_id = glyph_id;
+					return MUTT_SUCCESS;
+				}
+				header->glyph_id = glyph_id;
+
+				// Trusted fonts and validated glyphs skip verifying the header
+				if (mutt_GlyphTrusted(font, glyph_id)) {
+					header->number_of_contours = MU_RBES16(header->data);
+					header->x_min = MU_RBES16(header->data+2);
+					header->y_min = MU_RBES16(header->data+4);
+					header->x_max = MU_RBES16(header->data+6);
+					header->y_max = MU_RBES16(header->data+8);
+					header->length -= 10;
+					header->data += 10;
+					return MUTT_SUCCESS;
+				}
 
-				// Sorts the lines of a shape in ascending order of bottom point
-				void muttR_ShapeSort(muttR_Shape* shape) {
-					// Just call qsort for the job
-					mu_qsort(shape->lines, shape->num_lines, sizeof(muttR_Line), muttR_CompareLines);
+				// Verify minimum length for header
+				if (header->length < 10) {
+					return MUTT_INVALID_GLYF_HEADER_LENGTH;
 				}
 
-			/* Conversions */
+				// numberOfContours
+				header->number_of_contours = MU_RBES16(header->data);
+				if (header->number_of_contours > font->maxp->max_contours) {
+					return MUTT_INVALID_GLYF_HEADER_NUMBER_OF_CONTOURS;
+				}
 
-				// Converts two points to a line
-				void muttR_GlyphLine(muttR_Line* line, float x0, float y0, float x1, float y1) {
-					// Determine lowest y0 value
-					if (y0 < y1) {
-						line->x0 = x0;
-						line->y0 = y0;
-						line->x1 = x1;
-						line->y1 = y1;
-					}
-					else {
-						line->x0 = x1;
-						line->y0 = y1;
-						line->x1 = x0;
-						line->y1 = y0;
-					}
-					// Calculate vec
-					line->vec = y1-y0;
+				// xMin
+				header->x_min = MU_RBES16(header->data+2);
+				if (header->x_min < font->head->x_min) {
+					return MUTT_INVALID_GLYF_HEADER_X_MIN;
+				}
+				// yMin
+				header->y_min = MU_RBES16(header->data+4);
+				if (header->y_min < font->head->y_min) {
+					return MUTT_INVALID_GLYF_HEADER_Y_MIN;
+				}
+				// xMax
+				header->x_max = MU_RBES16(header->data+6);
+				if (header->x_max > font->head->x_max) {
+					return MUTT_INVALID_GLYF_HEADER_X_MAX;
+				}
+				if (header->x_max < header->x_min) {
+					return MUTT_INVALID_GLYF_HEADER_X_MIN_MAX;
+				}
+				// yMax
+				header->y_max = MU_RBES16(header->data+8);
+				if (header->y_max > font->head->y_max) {
+					return MUTT_INVALID_GLYF_HEADER_Y_MAX;
+				}
+				if (header->y_max < header->y_min) {
+					return MUTT_INVALID_GLYF_HEADER_Y_MIN_MAX;
 				}
 
-				// Converts three-point Bezier (on, off, on) to lines
-				// - Constants:
-				#define MUTTR_LINES_PER_BEZIER 25
-				//#define MUTTR_LINES_PER_BEZIER 1
-				static const float MUTTR_LINES_PER_BEZIER_F = ((float)MUTTR_LINES_PER_BEZIER);
-				static const float MUTTR_LINES_PER_BEZIER_INV = 1.f / ((float)MUTTR_LINES_PER_BEZIER);
-				// - Function:
-				static inline void muttR_GlyphCurve(muttR_Line* line, float x0, float y0, float x1, float y1, float x2, float y2) {
-					// Loop through each line per Bezier
-					for (uint32_m l = 0; l < MUTTR_LINES_PER_BEZIER; ++l) {
-						// Calculate Bezier for the first point
-						float t = ((float)l) / MUTTR_LINES_PER_BEZIER_F;
-						float bx0, by0;
-						muttR_Bezier(t, x0, y0, x1, y1, x2, y2, &bx0, &by0);
-						
-						// + Second point
-						float bx1, by1;
-						muttR_Bezier(t+MUTTR_LINES_PER_BEZIER_INV, x0, y0, x1, y1, x2, y2, &bx1, &by1);
+				// Subtract header data from length
+				header->length -= 10;
+				// ...and move data up past header
+				header->data += 10;
 
-						// Make line based on this strip of the Bezier
-						muttR_GlyphLine(line++, bx0, by0, bx1, by1);
-					}
-				}
+				return MUTT_SUCCESS;
+			}
 
-				// Gets the next point of a glyph based on the contour ends
-				static inline muttRPoint* muttR_GlyphNextPoint(muttRGlyph* glyph, uint32_m p, uint32_m i, uint32_m c) {
-					// The next point is p incremented
-					muttRPoint* pn = &glyph->points[p+i];
-					// ...unless this goes over the contour's end...
-					if (p+i > glyph->contour_ends[c]) {
-						// ..in which case the next point wraps back around to the first
-						// point of the contour
-						pn -= glyph->contour_ends[c]+1;
-						if (c > 0) {
-							pn += glyph->contour_ends[c-1]+1;
-						}
-					}
-					return pn;
-				}
+			MUDEF muttResult mutt_glyph_header(muttFont* font, uint16_m glyph_id, muttGlyphHeader* header) {
+				return mutt_GlyphHeader(font, glyph_id, header, MU_FALSE);
+			}
 
-				// Calculates the amount of lines needed to represent a glyph
-				uint32_m muttR_GlyphLineCount(muttRGlyph* glyph) {
-					// Keep count of lines:
-					uint32_m count = 0;
-					// Keep count of contours:
-					uint16_m c = 0;
+			// Gives the amount of bytes that the x- and y-coordinates of a point take
+			uint32_m mutt_CoordLength(uint8_m flags) {
+				// Indexed by (short vector) | (is same or positive << 1)
+				static const uint8_m lengths[4] = { 2, 1, 0, 1 };
+				return lengths[((flags>>1)&1) | ((flags>>3)&2)] // x
+					+ lengths[((flags>>2)&1) | ((flags>>4)&2)]  // y
+				;
+			}
 
-					// Loop through each point
-					for (uint32_m p = 0; p < glyph->num_points;) {
-						// Increment contour ID if necessary
-						if (p > glyph->contour_ends[c]) {
-							// Go to beginning of contour to avoid over-counting sometimes
-							p = glyph->contour_ends[c]+1;
-							++c;
-						}
+			// Gives the amount of bytes that the x-coordinate of a point takes
+			uint32_m mutt_XCoordLength(uint8_m flags) {
+				// Indexed by (short vector) | (is same or positive << 1)
+				static const uint8_m lengths[4] = { 2, 1, 0, 1 };
+				return lengths[((flags>>1)&1) | ((flags>>3)&2)];
+			}
 
-						// Get current point
-						muttRPoint* p0 = &glyph->points[p];
+			// Selects the delta of a coordinate of the given kind ("is_short" and "is_same"
+			// are 0 or 1) from the data without branching, moving the data past it
+			// (2 bytes must be readable from the data)
+			int32_m mutt_CoordDelta(muByte** pdata, int32_m is_short, int32_m is_same) {
+				// Indexed by (short vector) | (is same or positive << 1)
+				static const uint8_m lengths[4] = { 2, 1, 0, 1 };
+				muByte* data = *pdata;
+
+				// Read both possible values
+				int32_m byte = data[0];
+				int32_m word = (int16_m)((uint16_m)((data[0] << 8) | data[1]));
+				// Byte is negative if not "same"
+				int32_m not_same = is_same - 1;
+				byte = (byte ^ not_same) - not_same;
+				// Word is 0 (repeated) if "same"
+				word &= not_same;
+
+				// Pick one
+				*pdata = data + lengths[is_short | (is_same << 1)];
+				int32_m short_mask = -is_short;
+				return (byte & short_mask) | (word & ~short_mask);
+			}
 
-						// If current point is ON curve (ON...):
-						if (p0->flags & MUTTR_ON_CURVE) {
-							// Get next point
-							muttRPoint* p1 = muttR_GlyphNextPoint(glyph, p, 1, c);
-							// If next point is ON curve (ON, ON):
-							if (p1->flags & MUTTR_ON_CURVE) {
-								// One more line, go to next point
-								++count;
-								++p;
-								continue;
-							}
+			// Gives the delta of a coordinate of the given kind with branching, moving the
+			// data past it
+			int32_m mutt_CoordDeltaSafe(muByte** pdata, int32_m is_short, int32_m is_same) {
+				int32_m delta = 0;
+				if (is_short) {
+					// 1-byte, positive or negative
+					delta = **pdata;
+					*pdata += 1;
+					if (!is_same) {
+						delta = -delta;
+					}
+				} else if (!is_same) {
+					// 2-bytes, signed
+					delta = MU_RBES16(*pdata);
+					*pdata += 2;
+				}
+				return delta;
+			}
 
-							// If we're here, the next point is OFF curve (ON, OFF...)
-							// It must be a Bezier, and we must go forward two points
-							count += MUTTR_LINES_PER_BEZIER;
-							p += 2;
-							continue;
+			// Decodes the x- (axis 0) or y-coordinates (axis 1) of each point based on
+			// their flags, giving the min/max coordinate and the data past them
+			// (Length has already been verified; the range of the coordinates is verified
+			// by the caller from the min/max, which are 32-bit to catch overflow)
+			muByte* mutt_DecodeCoords(muByte* gdata, muttGlyphPoint* points, uint16_m num_points, uint8_m axis, int32_m* min, int32_m* max) {
+				// Flags for this axis
+				uint8_m short_flag = (axis) ?(MUTT_Y_SHORT_VECTOR) :(MUTT_X_SHORT_VECTOR);
+				uint8_m same_flag = (axis) ?(MUTT_Y_IS_SAME_OR_POSITIVE_Y_SHORT_VECTOR) :(MUTT_X_IS_SAME_OR_POSITIVE_X_SHORT_VECTOR);
+
+				int32_m value = 0, lo = 0, hi = 0;
+				if (num_points != 0) {
+					lo = 16383;
+					hi = -16384;
+				}
+
+				for (uint16_m pi = 0; pi < num_points; ++pi) {
+					uint8_m flags = points[pi].flags;
+
+					// Get delta from prior coordinate
+					int32_m delta;
+					if (flags & short_flag) {
+						// 1-byte, positive or negative
+						delta = *gdata++;
+						if (!(flags & same_flag)) {
+							delta = -delta;
 						}
+					} else if (flags & same_flag) {
+						// Repeated
+						delta = 0;
+					} else {
+						// 2-bytes, signed
+						delta = MU_RBES16(gdata);
+						gdata += 2;
+					}
 
-						// Get previous point
-						muttRPoint* pn1 = &glyph->points[p-1];
-						muttRPoint n1;
-						// Edge case for point being 0:
-						if (p == 0) {
-							// Wrap to end of this contour
-							pn1 = &n1;
-							n1.flags = glyph->points[glyph->contour_ends[0]].flags;
-						}
-						// Edge case for point being first point of this contour:
-						else if (c > 0 && (uint16_m)(glyph->contour_ends[c-1]+1) == p) {
-							// Wrap to end of this contour
-							pn1 = &n1;
-							n1.flags = glyph->points[glyph->contour_ends[c]].flags;
-						}
+					// Add to running coordinate
+					value += delta;
+					lo = (value < lo) ?(value) :(lo);
+					hi = (value > hi) ?(value) :(hi);
+					if (axis) {
+						points[pi].y = (int16_m)value;
+					} else {
+						points[pi].x = (int16_m)value;
+					}
+				}
 
-						// Skip is previous point is ON curve;
-						// this avoids duplicate lines from what I'm aware
-						if (pn1->flags & MUTTR_ON_CURVE) {
-							++p;
-							continue;
+				*min = lo;
+				*max = hi;
+				return gdata;
+			}
+
+			// Decodes the flags of a simple glyph without verifying anything (for trusted
+			// fonts), writing each one "stride" bytes apart to "flags", and giving the data
+			// past them and how many bytes the x-coordinates take (if "x_length" isn't 0)
+			muByte* mutt_TrustedFlags(muByte* gdata, uint8_m* flags, size_m stride, uint16_m num_points, uint32_m* x_length) {
+				uint16_m pi = 0; // (point index)
+				uint32_m length = 0;
+				while (pi < num_points) {
+					uint8_m this_flags = *gdata++;
+
+					// Get amount of points with this flag
+					// (Repeats past the point count are permitted, so they're still cut off)
+					uint32_m run = 1;
+					if (this_flags & MUTT_REPEAT_FLAG) {
+						run += *gdata++;
+						if (run > (uint32_m)(num_points-pi)) {
+							run = num_points-pi;
 						}
+					}
 
-						// If we're here, we started on an OFF point
-						// It must be a Bezier, and we must go forward one point
-						count += MUTTR_LINES_PER_BEZIER;
-						++p;
-						//continue;
+					// Fill flags
+					uint8_m* out = flags + (stride * pi);
+					for (uint32_m r = 0; r < run; ++r) {
+						out[stride * r] = this_flags;
+					}
+					pi += run;
+					if (x_length) {
+						length += run * mutt_XCoordLength(this_flags);
 					}
+				}
 
-					// Return final count
-					return count;
+				if (x_length) {
+					*x_length = length;
 				}
+				return gdata;
+			}
 
-				// Converts an rglyph to a shape
-				muttResult muttR_ShapeCreate(muttRGlyph* glyph, muttR_Shape* shape) {
-					// Calculate number of lines needed
-					shape->num_lines = muttR_GlyphLineCount(glyph);
-					// Allocate lines
-					shape->lines = (muttR_Line*)mu_malloc(sizeof(muttR_Line)*shape->num_lines);
-					if (!shape->lines) {
-						return MUTT_FAILED_MALLOC;
-					}
+			// Fills in "muttSimpleGlyph" struct without verifying anything (for trusted fonts)
+			muttResult mutt_TrustedSimpleGlyph(muttGlyphHeader* header, muttSimpleGlyph* glyph, muByte* data, uint32_m* written) {
+				muttResult res = MUTT_SUCCESS;
+				muByte* gdata = header->data;
+				muByte* orig_data = data;
 
-					// Loop through each point
-					uint32_m c = 0; // (contour tracker)
-					muttR_Line* l = shape->lines; // (shape tracker)
-					for (uint32_m p = 0; p < glyph->num_points;) {
-						// Increment contour ID if necessary
-						if (p > glyph->contour_ends[c]) {
-							// Go to beginning of contour to avoid over-counting sometimes
-							p = glyph->contour_ends[c]+1;
-							++c;
-						}
+				// Copy endPtsOfContours
+				glyph->end_pts_of_contours = (uint16_m*)data;
+				data += ((uint32_m)header->number_of_contours)*2;
+				for (uint16_m c = 0; c < header->number_of_contours; ++c) {
+					glyph->end_pts_of_contours[c] = MU_RBEU16(gdata);
+					gdata += 2;
+				}
+				uint16_m points = 0;
+				if (header->number_of_contours != 0) {
+					points = glyph->end_pts_of_contours[header->number_of_contours-1] + 1;
+				}
 
-						// Get current point
-						muttRPoint* p0 = &glyph->points[p];
+				// Copy instructions
+				glyph->instruction_length = MU_RBEU16(gdata);
+				gdata += 2;
+				if (glyph->instruction_length != 0) {
+					glyph->instructions = (uint8_m*)data;
+					mu_memcpy(glyph->instructions, gdata, glyph->instruction_length);
+					data += glyph->instruction_length;
+					gdata += glyph->instruction_length;
+				}
 
-						// If current point is ON curve (ON...):
-						if (p0->flags & MUTTR_ON_CURVE) {
-							// Get next point
-							muttRPoint* p1 = muttR_GlyphNextPoint(glyph, p, 1, c);
-							// If next point is ON curve (ON, ON):
-							if (p1->flags & MUTTR_ON_CURVE) {
-								// Form line between two points and move on by one
-								muttR_GlyphLine(l++, p0->x, p0->y, p1->x, p1->y);
-								++p;
-								continue;
-							}
+				// Decode flags
+				glyph->points = (muttGlyphPoint*)data;
+				data += points*sizeof(muttGlyphPoint);
+				// (The coordinates are decoded one after the other, so the x length isn't needed)
+				gdata = mutt_TrustedFlags(gdata, &glyph->points[0].flags, sizeof(muttGlyphPoint), points, 0);
 
-							// If we're here, the next point is OFF curve (ON, OFF...)
-							// Get next-next point
-							muttRPoint* p2 = muttR_GlyphNextPoint(glyph, p, 2, c);
-							// If next-next point is ON the curve (ON, OFF, ON):
-							if (p2->flags & MUTTR_ON_CURVE) {
-								// Form basic Bezier and move on
-								muttR_GlyphCurve(l, p0->x, p0->y, p1->x, p1->y, p2->x, p2->y);
-								l += MUTTR_LINES_PER_BEZIER;
-								p += 2;
-								continue;
-							}
+				// Decode coordinates
+				int32_m x_min, x_max, y_min, y_max;
+				gdata = mutt_DecodeCoords(gdata, glyph->points, points, 0, &x_min, &x_max);
+				mutt_DecodeCoords(gdata, glyph->points, points, 1, &y_min, &y_max);
 
-							// If we're here, the next-next point is OFF the curve: (ON, OFF, OFF):
-							else {
-								// Bezier, with last point needing to be mid-pointed
-								muttR_GlyphCurve(l, p0->x, p0->y, p1->x, p1->y,
-									(p1->x + p2->x) / 2.f, (p1->y + p2->y) / 2.f
-								);
+				// Give the same non-fatal results as the checked path
+				if (points != 0) {
+					if (x_min < header->x_min || x_max > header->x_max) {
+						res = MUTT_INVALID_GLYF_SIMPLE_X_COORD;
+					}
+					if (y_min < header->y_min || y_max > header->y_max) {
+						res = MUTT_INVALID_GLYF_SIMPLE_Y_COORD;
+					}
+				}
 
-								l += MUTTR_LINES_PER_BEZIER;
-								p += 2;
-								continue;
-							}
-						}
+				// Write calculated x/y min/max values
+				header->x_min = x_min;
+				header->y_min = y_min;
+				header->x_max = x_max;
+				header->y_max = y_max;
+				if (written) {
+					*written = data-orig_data;
+				}
+				return res;
+			}
 
-						// If we're here, the current point is OFF curve (OFF...)
-						// Get previous point:
-						muttRPoint* pn1 = &glyph->points[p-1];
-						muttRPoint n1;
-						// Edge case for point being 0:
-						if (p == 0) {
-							// Wrap to last point of this contour
-							pn1 = &n1;
-							n1.x = glyph->points[glyph->contour_ends[0]].x;
-							n1.y = glyph->points[glyph->contour_ends[0]].y;
-							n1.flags = glyph->points[glyph->contour_ends[0]].flags;
-						}
-						// Edge case for point being first of contour:
-						else if (c > 0 && (uint16_m)(glyph->contour_ends[c-1]+1) == p) {
-							// Wrap to last point of this contour
-							pn1 = &n1;
-							n1.x = glyph->points[glyph->contour_ends[c]].x;
-							n1.y = glyph->points[glyph->contour_ends[c]].y;
-							n1.flags = glyph->points[glyph->contour_ends[c]].flags;
-						}
+			// Fills in (or calculates memory needed for) "muttSimpleGlyph" struct
+			MUDEF muttResult mutt_simple_glyph(muttFont* font, muttGlyphHeader* header, muttSimpleGlyph* glyph, muByte* data, uint32_m* written) {
+				// Decode trusted glyphs without verifying anything
+				// (Glyphs with no data still go through the checks, which reject them)
+				if (data && mutt_HeaderTrusted(font, header)) {
+					return mutt_TrustedSimpleGlyph(header, glyph, data, written);
+				}
 
-						// Leave if previous point is ON;
-						// this avoids duplicate lines from what I'm aware
-						if (pn1->flags & MUTTR_ON_CURVE) {
-							++p;
-							continue;
-						}
+				muttResult res = MUTT_SUCCESS;
 
-						// Get next point:
-						muttRPoint* p1 = muttR_GlyphNextPoint(glyph, p, 1, c);
+				// Verify length for endPtsOfContours and instructionLength
+				// (req is u64 to avoid possible overflow)
+				uint64_m req = (((uint32_m)header->number_of_contours)*2) + 2;
+				if (header->length < req) {
+					return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+				}
 
-						// x0 and y0 must be midpointed between pn1 and p0 since
-						// both are OFF curve:
-						float x0 = (pn1->x + p0->x) / 2.f;
-						float y0 = (pn1->y + p0->y) / 2.f;
-						// x1 and y1 are just p0 since it's OFF curve:
-						float x1 = p0->x;
-						float y1 = p0->y;
-						// x2 and y2 are just p1:
-						float x2 = p1->x;
-						float y2 = p1->y;
-						// ...unless it's OFF curve, in which case it must be
-						// midpointed:
-						if (!(p1->flags & MUTTR_ON_CURVE)) {
-							x2 = (x1 + x2) / 2.f;
-							y2 = (y1 + y2) / 2.f;
+				// Glyph data:
+				muByte* gdata = header->data;
+
+				// Memory size calculation:
+				if (!data) {
+					// Add endPtsOfContours to memory
+					uint32_m min_size = header->number_of_contours*2;
+
+					// To calculate amount of points:
+					uint16_m points = 0;
+					if (header->number_of_contours != 0) {
+						// Skip to last element of endPtsOfContours and read
+						gdata += (uint32_m)(header->number_of_contours-1)*2;
+						points = MU_RBEU16(gdata);
+
+						// Verify last element of endPtsOfContours
+						if (points == 0xFFFF) {
+							return MUTT_INVALID_GLYF_SIMPLE_END_PTS_OF_CONTOURS;
 						}
 
-						// Bezier and move on:
-						muttR_GlyphCurve(l, x0, y0, x1, y1, x2, y2);
-						l += MUTTR_LINES_PER_BEZIER;
-						++p;
-						//continue;
+						// Skip past last element
+						++points;
+						gdata += 2;
 					}
 
-					// Sort all lines
-					muttR_ShapeSort(shape);
-					// Set max x/y
-					shape->x_max = glyph->x_max;
-					shape->y_max = glyph->y_max;
+					// Verify point count
+					if (points > font->maxp->max_points) {
+						return MUTT_INVALID_GLYF_SIMPLE_POINT_COUNT;
+					}
+					// Add points to memory
+					min_size += ((uint32_m)points)*sizeof(muttGlyphPoint);
+
+					// Add instructions to memory
+					uint16_m instruction_length = MU_RBEU16(gdata);
+					if (instruction_length > font->maxp->max_size_of_instructions) {
+						return MUTT_INVALID_GLYF_SIMPLE_INSTRUCTION_LENGTH;
+					}
+					min_size += instruction_length;
+
+					// Check for size fitting
+					// This should not need to be checked, as it is calculated via maxp,
+					// to which all of these values are also checked to not exceed.
+					/*if (min_size > mutt_simple_glyph_max_size(font)) {
+						return MUTT_INVALID_GLYF_SIMPLE_;
+					}*/
 
+					// Set memory req
+					*written = min_size;
 					return MUTT_SUCCESS;
 				}
 
-				// Frees all memory used by a shape
-				void muttR_ShapeDestroy(muttR_Shape* shape) {
-					if (shape->lines) {
-						mu_free(shape->lines);
-					}
-				}
+				// Store pointer to original data
+				muByte* orig_data = data;
 
-		/* Intersection/Hit logic */
+				// Allocate endPtsOfContours
+				glyph->end_pts_of_contours = (uint16_m*)data;
+				data += ((uint32_m)header->number_of_contours)*2;
 
-			// A hit:
-			struct muttR_Hit {
-				// The x-value of the intersection
-				float x;
-				// The line which it intersected with
-				uint32_m l;
-			};
-			typedef struct muttR_Hit muttR_Hit;
+				// Loop through each contour
+				uint16_m points = 0;
+				for (uint16_m c = 0; c < header->number_of_contours; ++c) {
+					// Copy value for endPtsOfContour
+					glyph->end_pts_of_contours[c] = MU_RBEU16(gdata);
 
-			// Used to sort intersections in order of increasing x-value
-			int muttR_HitCompare(const void* p, const void* q) {
-				// Get hits
-				muttR_Hit* h0 = (muttR_Hit*)p, * h1 = (muttR_Hit*)q;
-				// Indicate which hit's x-value is greater
-				if (h0->x < h1->x) {
-					return -1;
-				} else if (h0->x > h1->x) {
-					return 1;
-				}
-				return 0;
-			}
+					// Verify increasing order
+					if (c != 0) {
+						if (glyph->end_pts_of_contours[c] <= glyph->end_pts_of_contours[c-1]) {
+							return MUTT_INVALID_GLYF_SIMPLE_END_PTS_OF_CONTOURS;
+						}
+					}
 
-			// Updates the active line list based on the ray
-			static inline void muttR_ActiveLines(muttR_Line* lines, uint32_m num_lines, uint32_m* first, uint32_m* len, float ry) {
-				// Increase length to include possible new in-range lines
-				while ((*first) + (*len) < num_lines) {
-					if (ry >= lines[(*first) + (*len)].y0 - MUTTR_LINE_EPSILON32) {
-						*len += 1;
-					} else {
-						break;
+					// Get point count if we're on the last index
+					if (c == header->number_of_contours-1) {
+						points = glyph->end_pts_of_contours[c];
+						// Verify last element
+						if (points == 0xFFFF) {
+							return MUTT_INVALID_GLYF_SIMPLE_END_PTS_OF_CONTOURS;
+						}
+						// Increment points by one to get count (since last value is an index)
+						++points;
 					}
+
+					// Move to next entry in endPtsOfContours
+					gdata += 2;
 				}
-			}
 
-			// Calculates all hits for a given ray and its active lines
-			// Returns amount of hits, and gives winding as well
-			static inline uint32_m muttR_Hits(muttR_Line* lines, uint32_m num_lines, float ry, muttR_Hit* hits, int32_m* winding) {
-				uint32_m num_hits = 0;
+				// Verify point count
+				if (points > font->maxp->max_points) {
+					return MUTT_INVALID_GLYF_SIMPLE_POINT_COUNT;
+				}
 
-				// Loop through each line
-				for (uint32_m l = 0; l < num_lines; ++l) {
-					// If ray intersects with line:
-					if (ry < lines[l].y1 + MUTTR_LINE_EPSILON32) {
-						// Add intersection values
-						float x = muttR_LineRayHit(ry, lines[l].x0, lines[l].y0, lines[l].x1, lines[l].y1);
-						// Add if intersection is valid
-						if (x >= 0.f) {
-							hits[num_hits  ].x = x;
-							hits[num_hits++].l = l;
+				// instructionLength
+				glyph->instruction_length = MU_RBEU16(gdata);
+				gdata += 2;
+				// + Verify instructionLength
+				if (glyph->instruction_length > font->maxp->max_size_of_instructions) {
+					return MUTT_INVALID_GLYF_SIMPLE_INSTRUCTION_LENGTH;
+				}
+
+				// For instructions:
+				if (glyph->instruction_length != 0) {
+					// Verify length for instructions
+					req += glyph->instruction_length;
+					if (header->length < req) {
+						return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+					}
+					// Allocate
+					glyph->instructions = (uint8_m*)data;
+					// Copy over
+					mu_memcpy(glyph->instructions, gdata, glyph->instruction_length);
+					// Move past instructions
+					data += glyph->instruction_length;
+					gdata += glyph->instruction_length;
+				}
+
+				// Allocate points
+				glyph->points = (muttGlyphPoint*)data;
+				data += points*sizeof(muttGlyphPoint);
+
+				// Decode flags, filling each repeat run at once, and sum up how many
+				// bytes the x- and y-coordinates take
+				uint16_m pi = 0; // (point index)
+				uint32_m coord_length = 0;
+				while (pi < points) {
+					// Verify length for this flag
+					if (header->length < ++req) {
+						return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+					}
+					uint8_m flags = *gdata++;
+
+					// Get amount of points with this flag
+					uint32_m run = 1;
+					if (flags & MUTT_REPEAT_FLAG) {
+						// Verify length for repeat count
+						if (header->length < ++req) {
+							return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
 						}
+						run += *gdata++;
+						// Cut off repeats past the point count
+						// (Mentioned in documentation)
+						if (run > (uint32_m)(points-pi)) {
+							run = points-pi;
+						}
+					}
+
+					// Fill flags
+					muttGlyphPoint* point = glyph->points + pi;
+					for (uint32_m r = 0; r < run; ++r) {
+						point[r].flags = flags;
 					}
+					pi += run;
+					coord_length += run * mutt_CoordLength(flags);
 				}
 
-				// Sort hits
-				mu_qsort(hits, num_hits, sizeof(muttR_Hit), muttR_HitCompare);
+				// Verify length for every coordinate at once
+				// (Allows the coordinates to be decoded without checking length)
+				req += coord_length;
+				if (header->length < req) {
+					return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+				}
 
-				// Calculate total winding order
-				*winding = 0;
-				for (uint32_m hitw = 0; hitw < num_hits; ++hitw) {
-					winding += muttR_LineWinding(ry, &lines[hits[hitw].l]);
+				// Decode x-coordinates
+				int32_m x_min, x_max;
+				gdata = mutt_DecodeCoords(gdata, glyph->points, points, 0, &x_min, &x_max);
+				// - Verify that they're within FUnit range
+				if (x_min < -16384 || x_max > 16383) {
+					return MUTT_INVALID_GLYF_SIMPLE_X_COORD_FUNITS;
+				}
+				// - Verify that they're within range of the header
+				if (points != 0 && (x_min < header->x_min || x_max > header->x_max)) {
+					res = MUTT_INVALID_GLYF_SIMPLE_X_COORD;
 				}
 
-				return num_hits;
+				// Decode y-coordinates
+				int32_m y_min, y_max;
+				gdata = mutt_DecodeCoords(gdata, glyph->points, points, 1, &y_min, &y_max);
+				// - Verify that they're within FUnit range
+				if (y_min < -16384 || y_max > 16383) {
+					return MUTT_INVALID_GLYF_SIMPLE_Y_COORD_FUNITS;
+				}
+				// - Verify that they're within range of the header
+				if (points != 0 && (y_min < header->y_min || y_max > header->y_max)) {
+					res = MUTT_INVALID_GLYF_SIMPLE_Y_COORD;
+				}
+
+				// Write calculated x/y min/max values
+				header->x_min = x_min;
+				header->y_min = y_min;
+				header->x_max = x_max;
+				header->y_max = y_max;
+				// Write how many bytes of data were used
+				if (written) {
+					*written = data-orig_data;
+				}
+				return res;
 			}
 
-		/* Rasterization per method */
+			// Calculates amount of points within a simple glyph
+			MUDEF muttResult mutt_simple_glyph_points(muttFont* font, muttGlyphHeader* header, uint16_m* num_points) {
+				// Give 0 for no contours
+				if (header->number_of_contours == 0) {
+					*num_points = 0;
+					return MUTT_SUCCESS;
+				}
 
-			// MUTTR_FULL_PIXEL_BI_LEVEL
-			muttResult muttR_FullPixelBiLevel(muttR_Shape* shape, muttRBitmap* bitmap, uint8_m adv, uint8_m in, uint8_m out) {
-				// Allocate hit tracker
-				muttR_Hit* hits = (muttR_Hit*)mu_malloc(shape->num_lines*sizeof(muttR_Hit));
-				if (!hits) {
-					return MUTT_FAILED_MALLOC;
+				// Verify length for endPtsOfContours
+				uint32_m req = ((uint32_m)header->number_of_contours) * 2;
+				if (header->length < req) {
+					return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
 				}
 
-				// Set all pixels to out first
-				if (adv != 4) {
-					mu_memset(bitmap->pixels, out, bitmap->width * bitmap->height * adv);
-				} else {
-					mu_memset(bitmap->pixels, 0, bitmap->width * bitmap->height * adv);
+				// Skip to last element of endPtsOfContours and read
+				uint16_m rnum_points = MU_RBEU16(header->data + (((uint32_m)(header->number_of_contours-1)) * 2));
+				// Verify number of points won't overflow
+				if (rnum_points == 0xFFFF) {
+					return MUTT_INVALID_GLYF_SIMPLE_END_PTS_OF_CONTOURS;
+				}
+				// See if point count is good for maxp
+				if (++rnum_points > font->maxp->max_points) {
+					return MUTT_INVALID_GLYF_SIMPLE_POINT_COUNT;
 				}
 
-				// Initialize active lines
-				uint32_m first_line = 0;
-				uint32_m line_len = 0;
+				// Write point count and give success
+				*num_points = rnum_points;
+				return MUTT_SUCCESS;
+			}
 
-				// Loop through each horizontal strip from bottom to top
-				for (uint32_m h = 0; h < bitmap->height; ++h) {
-					// Calculate horizontal pixel offset
-					uint64_m hpix_offset = bitmap->stride*((bitmap->height-h)-1);
+			// Simple glyph memory maximum
+			MUDEF uint32_m mutt_simple_glyph_max_size(muttFont* font) {
+				return
+					// endPtsOfContours
+					(font->maxp->max_contours*2)
+					// instructions
+					+(font->maxp->max_size_of_instructions)
+					// maxPoints
+					+(font->maxp->max_points*sizeof(muttGlyphPoint))
+				;
+			}
 
-					// Just fill all x-values with out if the height is now outside of the glyph range
-					// (+ double-pixel extra for bleeding and ceiling)
-					if (h > shape->y_max+2) {
-						break;
+			// Simple glyph loaded with memory from an arena
+			MUDEF muttResult mutt_simple_glyph_arena(muttFont* font, muttGlyphHeader* header, muttSimpleGlyph* glyph, muttArena* arena) {
+				// Calculate exact memory needed
+				uint32_m size;
+				muttResult res = mutt_simple_glyph(font, header, 0, 0, &size);
+				if (mutt_result_is_fatal(res)) {
+					return res;
+				}
+
+				// Allocate it
+				uint64_m mark = mutt_arena_mark(arena);
+				muByte* data = (muByte*)mutt_arena_alloc(arena, size);
+				if (!data) {
+					return MUTT_FAILED_ARENA;
+				}
+
+				// Load glyph, letting go of memory on failure
+				res = mutt_simple_glyph(font, header, glyph, data, 0);
+				if (mutt_result_is_fatal(res)) {
+					mutt_arena_reset(arena, mark);
+				}
+				return res;
+			}
+
+			// Calculates the x/y min/max of a simple glyph by scanning only its flags and
+			// coordinates, giving its point count
+			// (The range of the coordinates is verified by the caller from the min/max)
+			muttResult mutt_SimpleBounds(muttFont* font, muttGlyphHeader* header, int32_m* min, int32_m* max, uint16_m* points) {
+				// Verify length for endPtsOfContours and instructionLength
+				uint64_m req = (((uint32_m)header->number_of_contours)*2) + 2;
+				if (header->length < req) {
+					return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+				}
+
+				// Verify increasing order of endPtsOfContours
+				// (Same checks, in the same order, as mutt_simple_glyph)
+				muByte* data = header->data;
+				for (uint16_m c = 1; c < header->number_of_contours; ++c) {
+					if (MU_RBEU16(data+(c*2)) <= MU_RBEU16(data+((c-1)*2))) {
+						return MUTT_INVALID_GLYF_SIMPLE_END_PTS_OF_CONTOURS;
 					}
+				}
 
-					// Calculate y-value of ray (middle of pixel)
-					float ray_y = ((float)h) + .5f;
+				// Progressive glyph data:
+				// (Move to endPtsOfContours[numContours-1])
+				data += req-4;
+				// Read last element of endPtsOfContours
+				uint16_m num_points = MU_RBEU16(data);
+				data += 2;
+				// Verify it for number of points
+				if (num_points++ == 0xFFFF) {
+					return MUTT_INVALID_GLYF_SIMPLE_END_PTS_OF_CONTOURS;
+				}
+				if (num_points > font->maxp->max_points) {
+					return MUTT_INVALID_GLYF_SIMPLE_POINT_COUNT;
+				}
 
-					// Update active line list
-					muttR_ActiveLines(shape->lines, shape->num_lines, &first_line, &line_len, ray_y);
-					// Calculate all hits with active lines (+ winding)
-					int32_m winding;
-					uint32_m num_hits = muttR_Hits(&shape->lines[first_line], line_len, ray_y, hits, &winding);
+				// Read instructionLength
+				uint16_m instruction_len = MU_RBEU16(data);
+				data += 2;
+				// Verify instructions
+				if (instruction_len > font->maxp->max_size_of_instructions) {
+					return MUTT_INVALID_GLYF_SIMPLE_INSTRUCTION_LENGTH;
+				}
+				req += instruction_len;
+				if (header->length < req) {
+					return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+				}
+				// Move past instructions
+				data += instruction_len;
 
-					// If there are any hits:
-					if (num_hits != 0) {
-						// Set each range of in x-values based on hits to being filled in
-						size_m prev_x = mu_roundf(hits[0].x);
-						winding -= muttR_LineWinding(ray_y, &shape->lines[hits[0].l]);
-						for (uint32_m hn = 1; hn < num_hits; ++hn) {
-							if (winding != 0) {
-								if (adv != 4 || in != 0) {
-									mu_memset(&bitmap->pixels[hpix_offset+(prev_x*adv)], in, ((size_m)adv) * (((size_m)mu_roundf(hits[hn].x)) - prev_x));
-								} else {
-									uint8_m arr[4] = { 0, 0, 0, 255 };
-									size_m ie = (((size_m)mu_roundf(hits[hn].x)) - prev_x);
-									for (size_m i = 0; i < ie; ++i) {
-										mu_memcpy(&bitmap->pixels[hpix_offset+(prev_x*adv)+(i*4)], arr, 4);
-									}
-								}
-							}
-							prev_x = mu_roundf(hits[hn].x);
-							winding -= muttR_LineWinding(ray_y, &shape->lines[hits[hn].l]);
+				// Go through the flags to find out where the coordinates are
+				muByte* flags = data;
+				uint32_m x_length = 0, y_length = 0;
+				uint16_m pi = 0;
+				while (pi < num_points) {
+					// Verify length for this flag (and its repeat count)
+					if (header->length < ++req) {
+						return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+					}
+					uint8_m flag = *data++;
+					uint32_m run = 1;
+					if (flag & MUTT_REPEAT_FLAG) {
+						if (header->length < ++req) {
+							return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+						}
+						run += *data++;
+						if (run > (uint32_m)(num_points-pi)) {
+							run = num_points-pi;
+						}
+					}
+					pi += run;
+
+					// (y flags are one bit up from x flags)
+					x_length += run * mutt_XCoordLength(flag);
+					y_length += run * mutt_XCoordLength(flag >> 1);
+				}
+				// Verify length for coordinates
+				req += x_length + y_length;
+				if (header->length < req) {
+					return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+				}
+
+				// Go through the flags again, running through both coordinate arrays
+				muByte* xdata = data;
+				muByte* ydata = data + x_length;
+				muByte* end = ydata + y_length;
+				int32_m x = 0, y = 0;
+				int32_m x_lo = 16383, x_hi = -16384, y_lo = 16383, y_hi = -16384;
+
+				pi = 0;
+				while (pi < num_points) {
+					// Get this flag and the amount of points with it
+					uint8_m flag = *flags++;
+					uint32_m run = 1;
+					if (flag & MUTT_REPEAT_FLAG) {
+						run += *flags++;
+						if (run > (uint32_m)(num_points-pi)) {
+							run = num_points-pi;
+						}
+					}
+					pi += run;
+					int32_m x_short = (flag >> 1) & 1, x_same = (flag >> 4) & 1;
+					int32_m y_short = (flag >> 2) & 1, y_same = (flag >> 5) & 1;
+
+					for (; run != 0; --run) {
+						// Add deltas to running coordinates
+						// (x-coordinates come before the y-coordinates, so only the latter
+						// need checking)
+						if (ydata + 1 < end) {
+							x += mutt_CoordDelta(&xdata, x_short, x_same);
+							y += mutt_CoordDelta(&ydata, y_short, y_same);
+						} else {
+							x += mutt_CoordDeltaSafe(&xdata, x_short, x_same);
+							y += mutt_CoordDeltaSafe(&ydata, y_short, y_same);
 						}
+
+						// Track min/max
+						x_lo = (x < x_lo) ?(x) :(x_lo);
+						x_hi = (x > x_hi) ?(x) :(x_hi);
+						y_lo = (y < y_lo) ?(y) :(y_lo);
+						y_hi = (y > y_hi) ?(y) :(y_hi);
 					}
 				}
 
-				mu_free(hits);
+				min[0] = x_lo; max[0] = x_hi;
+				min[1] = y_lo; max[1] = y_hi;
+				*points = num_points;
+				return MUTT_SUCCESS;
+			}
+
+			// Calculates the x/y min/max for the given simple glyph
+			MUDEF muttResult mutt_simple_glyph_min_max(muttFont* font, muttGlyphHeader* header) {
+				int32_m min[2], max[2];
+				uint16_m points;
+				muttResult res = mutt_SimpleBounds(font, header, min, max, &points);
+				if (mutt_result_is_fatal(res)) {
+					return res;
+				}
+
+				// Verify FUnit range
+				if (min[0] < -16384 || max[0] > 16383) {
+					return MUTT_INVALID_GLYF_SIMPLE_X_COORD_FUNITS;
+				}
+				if (min[1] < -16384 || max[1] > 16383) {
+					return MUTT_INVALID_GLYF_SIMPLE_Y_COORD_FUNITS;
+				}
+
+				header->x_min = min[0];
+				header->y_min = min[1];
+				header->x_max = max[0];
+				header->y_max = max[1];
 				return MUTT_SUCCESS;
 			}
 
-			// MUTTR_FULL_PIXEL_AANXN inner handling
-			muttResult muttR_FullPixelAANXN(muttR_Shape* shape, muttRBitmap* bitmap, uint8_m adv, float in, float out, uint8_m vs, uint8_m hs) {
-				// Allocate hit tracker
-				muttR_Hit* hits = (muttR_Hit*)mu_malloc(shape->num_lines * sizeof(muttR_Hit));
-				if (!hits) {
-					return MUTT_FAILED_MALLOC;
+			// Fills in (or calculates memory needed for) "muttCompositeGlyph" struct
+			MUDEF muttResult mutt_composite_glyph(muttFont* font, muttGlyphHeader* header, muttCompositeGlyph* glyph, muByte* data, uint32_m* written) {
+				// Placeholder variables
+				uint32_m req = 0; // Required length
+				muByte* gdata = header->data; // Progressive data pointer
+
+				// For memory calculations:
+				if (!data) {
+					// Loop through each record
+					uint16_m flags = (header->length != 0) ?(MUTT_MORE_COMPONENTS) :(0);
+					uint32_m written_amt = 0;
+					muBool instructions = MU_FALSE;
+					uint32_m component_count = 0;
+
+					while (flags & MUTT_MORE_COMPONENTS) {
+						// Verify component count
+						if (++component_count > font->maxp->max_component_elements) {
+							return MUTT_INVALID_GLYF_COMPOSITE_COMPONENT_COUNT;
+						}
+						// Add component to mem req
+						written_amt += sizeof(muttComponentGlyph);
+
+						// Verify length for flags and glyphIndex
+						req += 4;
+						if (header->length < req) {
+							return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+						}
+						// Read flags for if we have more components and instructions
+						uint16_m this_flags = MU_RBEU16(gdata);
+						flags = this_flags & MUTT_MORE_COMPONENTS;
+						if (this_flags & MUTT_WE_HAVE_INSTRUCTIONS) {
+							instructions = MU_TRUE;
+						}
+						// Skip past flags and glyphIndex
+						gdata += 4;
+
+						// Add arguments to req length and skip past
+						if (this_flags & MUTT_ARG_1_AND_2_ARE_WORDS) {
+							// 2 bytes per
+							req += 4;
+							gdata += 4;
+						}
+						else {
+							// 1 byte per
+							req += 2;
+							gdata += 2;
+						}
+
+						// Add transform to req length and skip past
+						// We're not checking for mutual exclusivity here, as
+						// it's not relevant to mem req
+						if (this_flags & MUTT_WE_HAVE_A_SCALE) {
+							// One F2DOT14
+							req += 2;
+							gdata += 2;
+						}
+						else if (this_flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE) {
+							// Two F2DOT14s
+							req += 4;
+							gdata += 4;
+						}
+						else if (this_flags & MUTT_WE_HAVE_A_TWO_BY_TWO) {
+							// Four F2DOT14s
+							req += 8;
+							gdata += 8;
+						}
+
+						// Verify length for arguments and transform
+						if (header->length < req) {
+							return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+						}
+					}
+
+					// Instruction handling
+					if (instructions) {
+						// Verify length for instruction length
+						req += 2;
+						if (header->length < req) {
+							return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+						}
+
+						// Read instruction length
+						uint16_m instruction_length = MU_RBEU16(gdata);
+						// Verify with maxp
+						if (instruction_length > font->maxp->max_size_of_instructions) {
+							return MUTT_INVALID_GLYF_COMPOSITE_INSTRUCTION_LENGTH;
+						}
+						// Verify length for instructions
+						// Unneeded here since we're just calculating mem req
+						// ...
+
+						// Add instructions to mem req
+						written_amt += instruction_length;
+					}
+
+					// Give mem req and exit
+					*written = written_amt;
+					return MUTT_SUCCESS;
+				}
+
+				// Placeholder variables:
+				muByte* orig_data = data; // (Used for memory usage at the end)
+				uint32_m component_count = 0; // (Used for counting components; u32 to avoid overflow)
+				muBool instructions = MU_FALSE; // (To see if we've found instructions)
+				uint16_m flags = (header->length != 0) ?(MUTT_MORE_COMPONENTS) :(0);
+
+				// Point components array to current data (what we're filling in)
+				glyph->components = (muttComponentGlyph*)data;
+				muttComponentGlyph* c = glyph->components;
+
+				// Loop through each component:
+				while (flags & MUTT_MORE_COMPONENTS) {
+					// Verify component count
+					if (component_count > font->maxp->max_component_elements) {
+						return MUTT_INVALID_GLYF_COMPOSITE_COMPONENT_COUNT;
+					}
+
+					// Verify length for flags and glyphIndex
+					req += 4;
+					if (header->length < req) {
+						return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+					}
+
+					// Read flags
+					c->flags = MU_RBEU16(gdata);
+					gdata += 2;
+					// Mark next component
+					flags = c->flags & MUTT_MORE_COMPONENTS;
+					// Mark instructions flag
+					if (c->flags & MUTT_WE_HAVE_INSTRUCTIONS) {
+						instructions = MU_TRUE;
+					}
+
+					// Read glyphIndex
+					c->glyph_index = MU_RBEU16(gdata);
+					gdata += 2;
+					// Verify index range
+					if (c->glyph_index >= font->maxp->num_glyphs) {
+						return MUTT_INVALID_GLYF_COMPOSITE_GLYPH_INDEX;
+					}
+
+					// Arguments handling:
+					if (c->flags & MUTT_ARG_1_AND_2_ARE_WORDS) {
+						// 2 bytes per argument
+
+						// Verify length
+						req += 4;
+						if (header->length < req) {
+							return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+						}
+
+						// Read values
+						if (c->flags & MUTT_ARGS_ARE_XY_VALUES) {
+							// int16 xy values
+							c->argument1 = MU_RBES16(gdata);
+							gdata += 2;
+							c->argument2 = MU_RBES16(gdata);
+							gdata += 2;
+						} else {
+							// uint16 point numbers
+							c->argument1 = MU_RBEU16(gdata);
+							gdata += 2;
+							c->argument2 = MU_RBEU16(gdata);
+							gdata += 2;
+						}
+					} else {
+						// 1 byte per argument
+
+						// Verify length
+						req += 2;
+						if (header->length < req) {
+							return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+						}
+
+						// Read values
+						if (c->flags & MUTT_ARGS_ARE_XY_VALUES) {
+							// int8 xy values
+							c->argument1 = MU_RBES8(gdata++);
+							c->argument2 = MU_RBES8(gdata++);
+						} else {
+							// uint8 point numbers
+							c->argument1 = *gdata++;
+							c->argument2 = *gdata++;
+						}
+					}
+
+					// Transform data handling
+					if (c->flags & MUTT_WE_HAVE_A_SCALE) {
+						// One F2DOT14
+
+						// Ensure flag exclusivity
+						if ((c->flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE) || (c->flags & MUTT_WE_HAVE_A_TWO_BY_TWO)) {
+							return MUTT_INVALID_GLYF_COMPOSITE_FLAGS;
+						}
+
+						// Verify length
+						req += 2;
+						if (header->length < req) {
+							return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+						}
+
+						// Read
+						c->scales[0] = MUTT_F2DOT14(gdata);
+						gdata += 2;
+					}
+					else if (c->flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE) {
+						// Two F2DOT14s
+
+						// Ensure flag exclusivity
+						if ((c->flags & MUTT_WE_HAVE_A_SCALE) || (c->flags & MUTT_WE_HAVE_A_TWO_BY_TWO)) {
+							return MUTT_INVALID_GLYF_COMPOSITE_FLAGS;
+						}
+
+						// Verify length
+						req += 4;
+						if (header->length < req) {
+							return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+						}
+
+						// Read
+						c->scales[0] = MUTT_F2DOT14(gdata);
+						gdata += 2;
+						c->scales[1] = MUTT_F2DOT14(gdata);
+						gdata += 2;
+					}
+					else if (c->flags & MUTT_WE_HAVE_A_TWO_BY_TWO) {
+						// Four F2DOT14s
+
+						// Ensure flag exclusivity
+						if ((c->flags & MUTT_WE_HAVE_A_SCALE) || (c->flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE)) {
+							return MUTT_INVALID_GLYF_COMPOSITE_FLAGS;
+						}
+
+						// Verify length
+						req += 8;
+						if (header->length < req) {
+							return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+						}
+
+						// Read
+						c->scales[0] = MUTT_F2DOT14(gdata);
+						gdata += 2;
+						c->scales[1] = MUTT_F2DOT14(gdata);
+						gdata += 2;
+						c->scales[2] = MUTT_F2DOT14(gdata);
+						gdata += 2;
+						c->scales[3] = MUTT_F2DOT14(gdata);
+						gdata += 2;
+					}
+
+					// Increment handle for component and component count
+					++c;
+					++component_count;
+				}
+				// Verify component count
+				if (component_count > font->maxp->max_component_elements) {
+					return MUTT_INVALID_GLYF_COMPOSITE_COMPONENT_COUNT;
+				}
+				// Move past component array
+				data += sizeof(muttComponentGlyph) * component_count;
+
+				// Instruction handling
+				if (instructions) {
+					// Point to data
+					glyph->instructions = data;
+
+					// Verify length for instruction length
+					req += 2;
+					if (header->length < req) {
+						return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+					}
+
+					// Read instruction length
+					glyph->instruction_length = MU_RBEU16(gdata);
+					gdata += 2;
+					// Verify with maxp
+					if (glyph->instruction_length > font->maxp->max_size_of_instructions) {
+						return MUTT_INVALID_GLYF_COMPOSITE_INSTRUCTION_LENGTH;
+					}
+
+					if (glyph->instruction_length > 0) {
+						// Verify length for instructions
+						req += glyph->instruction_length;
+						if (header->length < req) {
+							return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+						}
+
+						// Memcpy instructions
+						mu_memcpy(glyph->instructions, gdata, glyph->instruction_length);
+						// Move data past instructions
+						data += glyph->instruction_length;
+					}
+				} else {
+					glyph->instruction_length = 0;
+					glyph->instructions = 0;
+				}
+
+				// Copy over component count
+				glyph->component_count = (uint16_m)component_count;
+				// Write data written
+				if (written) {
+					*written = data-orig_data;
+				}
+				return MUTT_SUCCESS;
+			}
+
+			// Gets a component of a composite glyph
+			// no_more is set to true when no more components exist
+			MUDEF muttResult mutt_composite_component(muttFont* font, muttGlyphHeader* header, muByte** prog, muttComponentGlyph* component, muBool* no_more) {
+				// Much of this code is very similar to the code in mutt_composite_glyph
+
+				// So-far component length:
+				uint32_m req = (*prog) - header->data;
+
+				// Verify length for flags and glyphIndex
+				req += 4;
+				if (header->length < req) {
+					return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+				}
+
+				// Read flags
+				component->flags = MU_RBEU16(*prog);
+				*prog += 2;
+				// Mark next component
+				if (!(component->flags & MUTT_MORE_COMPONENTS)) {
+					*no_more = MU_TRUE;
+				}
+
+				// Read glyphIndex
+				component->glyph_index = MU_RBEU16(*prog);
+				*prog += 2;
+				// Verify index range
+				if (component->glyph_index >= font->maxp->num_glyphs) {
+					return MUTT_INVALID_GLYF_COMPOSITE_GLYPH_INDEX;
+				}
+
+				// Argument handling:
+				if (component->flags & MUTT_ARG_1_AND_2_ARE_WORDS) {
+					// 2 bytes per arg.
+					req += 4;
+					if (header->length < req) {
+						return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+					}
+
+					// Read values
+					if (component->flags & MUTT_ARGS_ARE_XY_VALUES) {
+						// int16 xy values
+						component->argument1 = MU_RBES16(*prog);
+						*prog += 2;
+						component->argument2 = MU_RBES16(*prog);
+						*prog += 2;
+					} else {
+						// uint16 point numbers
+						component->argument1 = MU_RBEU16(*prog);
+						*prog += 2;
+						component->argument2 = MU_RBEU16(*prog);
+						*prog += 2;
+					}
+				}
+				else {
+					// 1 byte per arg.
+					req += 2;
+					if (header->length < req) {
+						return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+					}
+
+					// Read values
+					if (component->flags & MUTT_ARGS_ARE_XY_VALUES) {
+						// int8 xy values
+						component->argument1 = MU_RBES8((*prog)++);
+						component->argument2 = MU_RBES8((*prog)++);
+					} else {
+						// uint8 point numbers
+						component->argument1 = MU_RBEU8((*prog)++);
+						component->argument2 = MU_RBEU8((*prog)++);
+					}
+				}
+
+				// Transform data handling
+				if (component->flags & MUTT_WE_HAVE_A_SCALE) {
+					// One F2DOT14
+					req += 2;
+					if (header->length < req) {
+						return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+					}
+
+					// Flag exclusivity
+					if ((component->flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE) || (component->flags & MUTT_WE_HAVE_A_TWO_BY_TWO)) {
+						return MUTT_INVALID_GLYF_COMPOSITE_FLAGS;
+					}
+
+					// Read value
+					component->scales[0] = MUTT_F2DOT14(*prog);
+					*prog += 2;
+				}
+				else if (component->flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE) {
+					// Two F2DOT14s
+					req += 4;
+					if (header->length < req) {
+						return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+					}
+
+					// Flag exclusivity
+					if ((component->flags & MUTT_WE_HAVE_A_SCALE) || (component->flags & MUTT_WE_HAVE_A_TWO_BY_TWO)) {
+						return MUTT_INVALID_GLYF_COMPOSITE_FLAGS;
+					}
+
+					// Read values
+					component->scales[0] = MUTT_F2DOT14(*prog);
+					*prog += 2;
+					component->scales[1] = MUTT_F2DOT14(*prog);
+					*prog += 2;
+				}
+				else if (component->flags & MUTT_WE_HAVE_A_TWO_BY_TWO) {
+					// Four F2DOT14s
+					req += 8;
+					if (header->length < req) {
+						return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+					}
+
+					// Flag exclusivity
+					if ((component->flags & MUTT_WE_HAVE_A_SCALE) || (component->flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE)) {
+						return MUTT_INVALID_GLYF_COMPOSITE_FLAGS;
+					}
+
+					// Read values
+					component->scales[0] = MUTT_F2DOT14(*prog);
+					*prog += 2;
+					component->scales[1] = MUTT_F2DOT14(*prog);
+					*prog += 2;
+					component->scales[2] = MUTT_F2DOT14(*prog);
+					*prog += 2;
+					component->scales[3] = MUTT_F2DOT14(*prog);
+					*prog += 2;
+				}
+
+				return MUTT_SUCCESS;
+			}
+
+			// Gets the glyph index component by component within a composite glyph
+			// no_more is set to true when no more components exist
+			// ^ There will always be at least one component from what I'm aware
+			MUDEF muttResult mutt_composite_component_glyph(muttFont* font, muttGlyphHeader* header, muByte** prog, uint16_m* glyph_index, muBool* no_more) {
+				// prog is always at the beginning of a component record
+
+				// Ensure length for flags + glyphIndex
+				if (((*prog+4)-header->data) > header->length) {
+					return MUTT_INVALID_GLYF_COMPOSITE_LENGTH;
+				}
+
+				// Read flags to see if there's any more after this
+				uint16_m flags = MU_RBEU16(*prog);
+				*prog += 2;
+				if (!(flags & MUTT_MORE_COMPONENTS)) {
+					*no_more = MU_TRUE;
+				}
+				// Read glyphIndex
+				uint16_m read_glyph_index = MU_RBEU16(*prog);
+				*prog += 2;
+				if (read_glyph_index >= font->maxp->num_glyphs) {
+					return MUTT_INVALID_GLYF_COMPOSITE_GLYPH_INDEX;
+				}
+
+				// Increment prog past argument1 and argument2
+				if (flags & MUTT_ARG_1_AND_2_ARE_WORDS) {
+					*prog += 4;
+				} else {
+					*prog += 2;
+				}
+
+				// Increment prog past transform data
+				// (Not checking for flag exclusivity)
+				if (flags & MUTT_WE_HAVE_A_SCALE) {
+					*prog += 2;
+				} else if (flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE) {
+					*prog += 4;
+				} else if (flags & MUTT_WE_HAVE_A_TWO_BY_TWO) {
+					*prog += 8;
+				}
+
+				// (Not checking for length after argument1, argument2, and transform
+				// since we're not reading data from there)
+
+				// Write gylphIndex and give success
+				*glyph_index = read_glyph_index;
+				return MUTT_SUCCESS;
+			}
+
+			// Composite glyph memory maximum
+			MUDEF uint32_m mutt_composite_glyph_max_size(muttFont* font) {
+				return
+					// components
+					(font->maxp->max_component_elements*sizeof(muttComponentGlyph))
+					// instructions
+					+(font->maxp->max_size_of_instructions)
+				;
+			}
+
+			// Composite glyph loaded with memory from an arena
+			MUDEF muttResult mutt_composite_glyph_arena(muttFont* font, muttGlyphHeader* header, muttCompositeGlyph* glyph, muttArena* arena) {
+				// Calculate exact memory needed
+				uint32_m size;
+				muttResult res = mutt_composite_glyph(font, header, 0, 0, &size);
+				if (mutt_result_is_fatal(res)) {
+					return res;
+				}
+
+				// Allocate it
+				uint64_m mark = mutt_arena_mark(arena);
+				muByte* data = (muByte*)mutt_arena_alloc(arena, size);
+				if (!data) {
+					return MUTT_FAILED_ARENA;
+				}
+
+				// Load glyph, letting go of memory on failure
+				res = mutt_composite_glyph(font, header, glyph, data, 0);
+				if (mutt_result_is_fatal(res)) {
+					mutt_arena_reset(arena, mark);
+				}
+				return res;
+			}
+
+			// Glyph memory maximum
+			MUDEF uint32_m mutt_glyph_max_size(muttFont* font) {
+				// Simple:
+				uint32_m s = mutt_simple_glyph_max_size(font);
+				// Composite:
+				uint32_m c = mutt_composite_glyph_max_size(font);
+				// Return greatest
+				return (s>c) ?(s) :(c);
+			}
+
+			// Glyphs validated at a time by one thread
+			// (A multiple of 32 so that each word of the validity bitset is only written by
+			// one thread)
+			#define MUTT_VALIDATE_CHUNK 64
+
+			// State of a font being validated across threads
+			typedef struct muttValidation muttValidation;
+			struct muttValidation {
+				// (A copy of the font that always goes through the checks)
+				muttFont* font;
+				muttFontReport* report;
+				// Bitset of validated glyphs of the actual font
+				uint32_m* validated;
+				// Memory each thread needs for loading any glyph, resolving any composite
+				// glyph, and its scratch
+				uint32_m glyph_size;
+				uint32_m rglyph_size;
+				uint32_m scratch_size;
+				// Index of the next chunk of glyphs to be validated
+				uint32_m next;
+				// Lowest invalid glyph ID found so far (num_glyphs if none) and its result
+				uint32_m lowest;
+				muttResult result;
+				// If a thread couldn't allocate its memory
+				uint32_m failed_malloc;
+				// Lock for the invalid glyph data
+				uint32_m lock;
+			};
+
+			muttResult mutt_CompositeMinMaxResolve(muttFont* font, muttGlyphHeader* header, muByte* data, muByte* scratch);
+
+			// Validates a single glyph with the usual checks, giving its bounds
+			muttResult mutt_ValidateGlyph(muttFont* font, uint16_m glyph_id, muttValidation* v, muByte* mem, muttGlyphBounds* bounds) {
+				// Get header
+				muttGlyphHeader header;
+				muttResult res = mutt_GlyphHeader(font, glyph_id, &header, MU_FALSE);
+				if (mutt_result_is_fatal(res)) {
+					return res;
+				}
+
+				// Empty (no outline to verify):
+				if (header.number_of_contours == 0) {
+					res = MUTT_SUCCESS;
+				}
+				// Simple:
+				else if (header.number_of_contours > 0) {
+					muttSimpleGlyph glyph;
+					res = mutt_simple_glyph(font, &header, &glyph, mem, 0);
+				}
+				// Composite:
+				else {
+					muttCompositeGlyph glyph;
+					res = mutt_composite_glyph(font, &header, &glyph, mem, 0);
+					if (!mutt_result_is_fatal(res)) {
+						res = mutt_CompositeMinMaxResolve(font, &header, mem + v->glyph_size, mem + v->glyph_size + v->rglyph_size);
+					}
+				}
+				if (mutt_result_is_fatal(res)) {
+					return res;
+				}
+
+				// Give bounds (overwritten by loading the glyph)
+				if (bounds) {
+					bounds->x_min = header.x_min;
+					bounds->y_min = header.y_min;
+					bounds->x_max = header.x_max;
+					bounds->y_max = header.y_max;
+				}
+				return MUTT_SUCCESS;
+			}
+
+			// Validates chunks of glyphs until there are none left
+			void mutt_ValidateWork(void* arg) {
+				muttValidation* v = (muttValidation*)arg;
+				muttFontReport* report = v->report;
+				uint32_m num_glyphs = v->font->maxp->num_glyphs;
+
+				// Allocate this thread's memory
+				muByte* mem = (muByte*)mu_malloc(v->glyph_size + v->rglyph_size + v->scratch_size);
+				if (!mem) {
+					mutt_AtomicStore(&v->failed_malloc, 1);
+					return;
+				}
+
+				while (MU_TRUE) {
+					// Get next chunk
+					// (Without a report, no new chunks are started once an invalid glyph is found;
+					// every chunk before it has already been taken, so the lowest is still found)
+					uint32_m g = mutt_AtomicAdd(&v->next, 1) * MUTT_VALIDATE_CHUNK;
+					if (g >= num_glyphs || mutt_AtomicLoad(&v->failed_malloc)) {
+						break;
+					}
+					if (!report && mutt_AtomicLoad(&v->lowest) != num_glyphs) {
+						break;
+					}
+					uint32_m end = g + MUTT_VALIDATE_CHUNK;
+					if (end > num_glyphs) {
+						end = num_glyphs;
+					}
+
+					// Validate each glyph in chunk
+					uint32_m first = g;
+					uint32_m valid[MUTT_VALIDATE_CHUNK/32] = { 0 };
+					for (; g < end; ++g) {
+						muttGlyphBounds* bounds = (report) ?(&report->bounds[g]) :(0);
+						muttResult res = mutt_ValidateGlyph(v->font, (uint16_m)g, v, mem, bounds);
+
+						// Valid:
+						if (!mutt_result_is_fatal(res)) {
+							valid[(g-first)/32] |= ((uint32_m)1) << (g%32);
+							continue;
+						}
+
+						// Invalid:
+						mutt_SpinLock(&v->lock);
+						if (g < v->lowest) {
+							v->result = res;
+							mutt_AtomicStore(&v->lowest, g);
+						}
+						if (report) {
+							++report->num_invalid;
+						}
+						mutt_SpinUnlock(&v->lock);
+						if (!report) {
+							break;
+						}
+					}
+
+					// Mark valid glyphs as validated
+					// (The font may be in use by other threads, so they're set atomically)
+					for (uint32_m w = 0; w < MUTT_VALIDATE_CHUNK/32; ++w) {
+						if (valid[w]) {
+							mutt_AtomicOr(&v->validated[(first/32)+w], valid[w]);
+							if (report) {
+								report->valid[(first/32)+w] = valid[w];
+							}
+						}
+					}
+					if (!report && g < end) {
+						break;
+					}
+				}
+
+				mu_free(mem);
+			}
+
+			MUDEF muttResult mutt_font_validate(muttFont* font, uint32_m threads, muttFontReport* report) {
+				// Get bitset of validated glyphs, creating it if there isn't one
+				// (The lock keeps two validations from both creating it)
+				mutt_SpinLock(&font->lock);
+				uint32_m* validated = font->validated;
+				if (!validated) {
+					size_m validated_size = sizeof(uint32_m) * ((((size_m)font->maxp->num_glyphs)+31) / 32);
+					validated = (uint32_m*)mu_malloc(validated_size + 1);
+					if (!validated) {
+						mutt_SpinUnlock(&font->lock);
+						return MUTT_FAILED_MALLOC;
+					}
+					mu_memset(validated, 0, validated_size);
+					mutt_AtomicStorePtr((void* volatile*)&font->validated, validated);
+				}
+				mutt_SpinUnlock(&font->lock);
+
+				// Validate with a copy of the font that goes through the checks for
+				// every glyph (including ones already trusted, or cached as outlines),
+				// so that the font itself is never modified while it may be in use
+				muttFont checked = *font;
+				checked.mode_flags &= ~MUTT_LOAD_TRUSTED;
+				checked.validated = 0;
+				checked.outlines = 0;
+
+				muttValidation v;
+				mu_memset(&v, 0, sizeof(muttValidation));
+				v.font = &checked;
+				v.report = report;
+				v.validated = validated;
+				v.glyph_size = MUTT_TABLE_ALIGN_UP(mutt_glyph_max_size(font));
+				v.rglyph_size = MUTT_TABLE_ALIGN_UP(mutt_composite_rglyph_max(font));
+				v.scratch_size = mutt_composite_scratch_max(font);
+				v.lowest = font->maxp->num_glyphs;
+				v.result = MUTT_SUCCESS;
+
+				// Allocate report
+				// (Bitset is zeroed, as only valid bits are set; bounds of invalid glyphs are 0)
+				if (report) {
+					uint32_m words = (((uint32_m)font->maxp->num_glyphs)+31) / 32;
+					uint32_m valid_size = MUTT_TABLE_ALIGN_UP(words * sizeof(uint32_m));
+					muByte* mem = (muByte*)mu_malloc(valid_size + (((uint32_m)font->maxp->num_glyphs) * sizeof(muttGlyphBounds)) + 1);
+					if (!mem) {
+						return MUTT_FAILED_MALLOC;
+					}
+					mu_memset(mem, 0, valid_size + (((uint32_m)font->maxp->num_glyphs) * sizeof(muttGlyphBounds)));
+					report->num_glyphs = font->maxp->num_glyphs;
+					report->num_invalid = 0;
+					report->valid = (uint32_m*)mem;
+					report->bounds = (muttGlyphBounds*)(mem + valid_size);
+				}
+
+				// Validate across threads
+				// (Streamed glyph data can't be shared across threads)
+				uint32_m chunks = (((uint32_m)font->maxp->num_glyphs) + MUTT_VALIDATE_CHUNK-1) / MUTT_VALIDATE_CHUNK;
+				threads = (font->stream) ?(1) :(mutt_ThreadCount(threads, chunks));
+				if (threads == 0) {
+					threads = 1;
+				}
+				mutt_RunThreads(mutt_ValidateWork, &v, threads);
+
+				if (v.failed_malloc) {
+					if (report) {
+						mutt_report_deload(report);
+					}
+					return MUTT_FAILED_MALLOC;
+				}
+				return v.result;
+			}
+
+			MUDEF muBool mutt_report_valid(muttFontReport* report, uint16_m glyph_id) {
+				return (report->valid[glyph_id/32] >> (glyph_id%32)) & 1;
+			}
+
+			MUDEF void mutt_report_deload(muttFontReport* report) {
+				if (report->valid) {
+					mu_free(report->valid);
+					report->valid = 0;
+					report->bounds = 0;
+				}
+			}
+
+			MUDEF muttResult mutt_font_trust(muttFont* font) {
+				return mutt_font_validate(font, 1, 0);
+			}
+
+		/* Misc. */
+
+			// Performs idDelta logic
+			MUDEF uint16_m mutt_id_delta(uint16_m character_code, int16_m delta) {
+				// Just return if idDelta is 0
+				if (delta == 0) {
+					return character_code;
+				}
+
+				// Do modulo 65536 on a larger type to add without overflow
+				int32_m big_id = (int32_m)(character_code + delta) % 65536;
+				// Prevent negative cases by adding 65536 for cases under 0
+				if (big_id < 0) {
+					big_id += 65536;
+				}
+				// Return that but now u16, which (I think) big_id is guaranteed to fit in
+				return (uint16_m)big_id;
+			}
+
+		/* Outline cache */
+
+			typedef struct muttOutline muttOutline;
+
+			// A decoded simple glyph outline, or flattened composite glyph outline
+			// (Contour ends and points are allocated right after it)
+			struct muttOutline {
+				// Neighbors in least-recently-used order (prev is more recent)
+				muttOutline* prev;
+				muttOutline* next;
+				// Amount of threads using it
+				uint32_m refs;
+				// Memory it takes up, in bytes
+				uint32_m size;
+				uint16_m glyph_id;
+				// Result of decoding it (non-fatal)
+				muttResult result;
+				// Header with validated x/y min/max
+				muttGlyphHeader header;
+				// Simple glyph (with no instructions)
+				// (if header.number_of_contours is positive)
+				muttSimpleGlyph glyph;
+				// Flattened composite glyph with points in FUnits and its x/y min/max
+				// (if header.number_of_contours is negative)
+				uint16_m num_points;
+				uint16_m num_contours;
+				muttRPoint* points;
+				uint16_m* contour_ends;
+				float x_min, y_min, x_max, y_max;
+			};
+
+			struct muttOutlineCache {
+				uint64_m budget;
+				uint64_m memory;
+				// Outline of each glyph ID (0 if not cached)
+				muttOutline** outlines;
+				// Most and least recently used outlines
+				muttOutline* first;
+				muttOutline* last;
+				uint32_m lock;
+			};
+
+			MUDEF muttResult mutt_outline_cache_create(muttFont* font, uint64_m budget) {
+				// Just change budget if it exists already
+				if (font->outlines) {
+					mutt_SpinLock(&font->outlines->lock);
+					font->outlines->budget = budget;
+					mutt_SpinUnlock(&font->outlines->lock);
+					return MUTT_SUCCESS;
+				}
+
+				// Allocate cache and outline pointers
+				muttOutlineCache* cache = (muttOutlineCache*)mu_malloc(sizeof(muttOutlineCache));
+				if (!cache) {
+					return MUTT_FAILED_MALLOC;
+				}
+				mu_memset(cache, 0, sizeof(muttOutlineCache));
+				cache->budget = budget;
+				cache->outlines = (muttOutline**)mu_malloc(sizeof(muttOutline*) * ((size_m)font->maxp->num_glyphs));
+				if (!cache->outlines) {
+					mu_free(cache);
+					return MUTT_FAILED_MALLOC;
+				}
+				mu_memset(cache->outlines, 0, sizeof(muttOutline*) * ((size_m)font->maxp->num_glyphs));
+
+				font->outlines = cache;
+				return MUTT_SUCCESS;
+			}
+
+			void mutt_OutlineCacheFree(muttOutlineCache* cache) {
+				muttOutline* outline = cache->first;
+				while (outline) {
+					muttOutline* next = outline->next;
+					mu_free(outline);
+					outline = next;
+				}
+				mu_free(cache->outlines);
+				mu_free(cache);
+			}
+
+			// Takes an outline out of the least-recently-used list
+			void mutt_OutlineUnlink(muttOutlineCache* cache, muttOutline* outline) {
+				if (outline->prev) {
+					outline->prev->next = outline->next;
+				} else {
+					cache->first = outline->next;
+				}
+				if (outline->next) {
+					outline->next->prev = outline->prev;
+				} else {
+					cache->last = outline->prev;
+				}
+			}
+
+			// Puts an outline at the front of the least-recently-used list
+			void mutt_OutlineLinkFirst(muttOutlineCache* cache, muttOutline* outline) {
+				outline->prev = 0;
+				outline->next = cache->first;
+				if (cache->first) {
+					cache->first->prev = outline;
+				} else {
+					cache->last = outline;
+				}
+				cache->first = outline;
+			}
+
+			// Removes the least recently used outlines not in use until the cache is
+			// within budget (or there are none left to remove); lock must be held
+			void mutt_OutlineEvict(muttOutlineCache* cache) {
+				muttOutline* outline = cache->last;
+				while (outline && cache->memory > cache->budget) {
+					muttOutline* prev = outline->prev;
+					if (!outline->refs) {
+						mutt_OutlineUnlink(cache, outline);
+						cache->outlines[outline->glyph_id] = 0;
+						cache->memory -= outline->size;
+						mu_free(outline);
+					}
+					outline = prev;
+				}
+			}
+
+			// Gives the cached outline of a glyph ID (0 if it isn't cached), marking it as
+			// used; it must be let go of with mutt_OutlineRelease
+			muttOutline* mutt_OutlineFind(muttOutlineCache* cache, uint16_m glyph_id) {
+				mutt_SpinLock(&cache->lock);
+				muttOutline* cached = cache->outlines[glyph_id];
+				if (cached) {
+					cached->refs += 1;
+					mutt_OutlineUnlink(cache, cached);
+					mutt_OutlineLinkFirst(cache, cached);
+				}
+				mutt_SpinUnlock(&cache->lock);
+				return cached;
+			}
+
+			// Caches a newly created outline (with a reference count of 1), giving the
+			// outline to use for its glyph ID, which is the other outline if another
+			// thread cached it meanwhile (in which case the created outline is freed)
+			muttOutline* mutt_OutlineInsert(muttOutlineCache* cache, muttOutline* created) {
+				mutt_SpinLock(&cache->lock);
+				// Use the other outline if it exists
+				muttOutline* cached = cache->outlines[created->glyph_id];
+				if (cached) {
+					cached->refs += 1;
+					mutt_SpinUnlock(&cache->lock);
+					mu_free(created);
+					return cached;
+				}
+				// Cache it (which may put the cache over budget)
+				cache->outlines[created->glyph_id] = created;
+				mutt_OutlineLinkFirst(cache, created);
+				cache->memory += created->size;
+				mutt_OutlineEvict(cache);
+				mutt_SpinUnlock(&cache->lock);
+				return created;
+			}
+
+			// Gets the outline of a simple glyph (with at least one contour) from the
+			// cache, decoding and caching it if it's not there; decoding uses "temp",
+			// which must be "mutt_simple_glyph_max_size" bytes
+			// The outline must be let go of with mutt_OutlineRelease
+			muttResult mutt_OutlineAcquire(muttFont* font, uint16_m glyph_id, muttGlyphHeader* header, muByte* temp, muttOutline** outline) {
+				// Give cached outline if it exists
+				muttOutline* cached = mutt_OutlineFind(font->outlines, glyph_id);
+				if (cached) {
+					*outline = cached;
+					return cached->result;
+				}
+
+				// Decode it (without holding the lock)
+				muttSimpleGlyph glyph;
+				muttGlyphHeader validated = *header;
+				muttResult res = mutt_simple_glyph(font, &validated, &glyph, temp, 0);
+				if (mutt_result_is_fatal(res)) {
+					return res;
+				}
+
+				// Allocate outline with contour ends and points after it
+				uint32_m num_contours = (uint32_m)header->number_of_contours;
+				uint32_m num_points = ((uint32_m)glyph.end_pts_of_contours[num_contours-1]) + 1;
+				uint32_m contours_size = MUTT_TABLE_ALIGN_UP(num_contours * sizeof(uint16_m));
+				uint32_m size = sizeof(muttOutline) + contours_size + (num_points * sizeof(muttGlyphPoint));
+				muttOutline* created = (muttOutline*)mu_malloc(size);
+				if (!created) {
+					return MUTT_FAILED_MALLOC;
+				}
+
+				// Fill it in
+				created->refs = 1;
+				created->size = size;
+				created->glyph_id = glyph_id;
+				created->result = res;
+				created->header = validated;
+				created->glyph.end_pts_of_contours = (uint16_m*)(created + 1);
+				created->glyph.instruction_length = 0;
+				created->glyph.instructions = 0;
+				created->glyph.points = (muttGlyphPoint*)(((muByte*)(created + 1)) + contours_size);
+				mu_memcpy(created->glyph.end_pts_of_contours, glyph.end_pts_of_contours, num_contours * sizeof(uint16_m));
+				mu_memcpy(created->glyph.points, glyph.points, num_points * sizeof(muttGlyphPoint));
+
+				*outline = mutt_OutlineInsert(font->outlines, created);
+				return (*outline)->result;
+			}
+
+			// Lets go of an outline given by mutt_OutlineAcquire
+			void mutt_OutlineRelease(muttFont* font, muttOutline* outline) {
+				muttOutlineCache* cache = font->outlines;
+				mutt_SpinLock(&cache->lock);
+				outline->refs -= 1;
+				mutt_OutlineEvict(cache);
+				mutt_SpinUnlock(&cache->lock);
+			}
+
+	/* Raster API */
+
+		/* Math */
+
+			// Float epsilon macro used for countering floating point imprecision in line calculations
+			// This value is unabashedly stolen from stb_truetype, but it works real well
+			#define MUTTR_LINE_EPSILON32 (1.f/1024.f)
+
+			// Double epsilon macro used for same purpose as MUTTR_LINE_EPSILON32; not used as of right now
+			// This value should be tested and vetted more thoroughly if it's going to be used
+			#define MUTTR_LINE_EPSILON64 0.00000001
+
+			// Calculates IF a ray intersects a line
+			static inline muBool muttR_LineRay(float ry, float y0, float y1) {
+				// Any of these conditions must be true for intersection:
+				return
+					// Ray y is between y0 and y1 with forgiving epsilons:
+					(ry >= y0-MUTTR_LINE_EPSILON32 && ry <= y1+MUTTR_LINE_EPSILON32) ||
+					(ry >= y1-MUTTR_LINE_EPSILON32 && ry <= y0+MUTTR_LINE_EPSILON32)
+					// Line is horizontal:
+					|| (y1-y0 == 0.f)
+				;
+			}
+
+			// Calculates the x-value intersection of a ray and a line
+			static inline float muttR_LineRayHit(float ry, float x0, float y0, float x1, float y1) {
+				// (https://math.stackexchange.com/a/2297532)
+				return x0 + (
+					((ry-y0) * (x1-x0))
+					/
+					(y1-y0)
+				);
+			}
+
+			// Calculates the x- and y-value of a point on a Bezier curve (on, off, on) given t.
+			static inline void muttR_Bezier(float t,
+				float x0, float y0, float x1, float y1, float x2, float y2,
+				float* x, float* y
+			) {
+				// I think this can be optimized, but idk...
+				*x = ((1.f-t)*(1.f-t)*x0) + (2.f*(1.f-t)*t*x1) + (t*t*x2);
+				*y = ((1.f-t)*(1.f-t)*y0) + (2.f*(1.f-t)*t*y1) + (t*t*y2);
+			}
+
+		/* Raster shape setup */
+
+			/* Definitions */
+
+				// A raster shape is made up of lines, a line is defined by two points
+				struct muttR_Line {
+					// 0 is bottom, 1 is top (y0 <= y1)
+					float x0;
+					float y0;
+					float x1;
+					float y1;
+					// vec = y1-y0 (for direction)
+					float vec;
+				};
+				typedef struct muttR_Line muttR_Line;
+
+				// Used to sort the lines in increasing order of bottom point
+				int muttR_CompareLines(const void* p, const void* q) {
+					// Get lines
+					muttR_Line* l0 = (muttR_Line*)p, * l1 = (muttR_Line*)q;
+					// Return value to indicate ascending y0
+					if (l0->y0 < l1->y0) {
+						return -1;
+					} else if (l0->y0 > l1->y0) {
+						return 1;
+					}
+					// If equal, indicate descending y1
+					else if (l0->y1 > l1->y1) {
+						return -1;
+					}
+					else if (l0->y1 < l1->y1) {
+						return 1;
+					}
+					return 0;
+				}
+
+				// Calculates the winding for a given line
+				static inline int8_m muttR_LineWinding(float ry, muttR_Line* line) {
+					// Don't consider winding if we're directly intersecting the high point of line
+					if (mu_fabsf(ry - line->y0) <= MUTTR_LINE_EPSILON32) {
+						return 0;
+					}
+
+					// Return winding order based on vector; down is +1, up is -1, neither is 0
+					if (line->vec < 0.f) {
+						return 1;
+					} else if (line->vec > 0.f) {
+						return -1;
+					}
+					return 0;
+				}
+
+				// A raster shape is just a collection of lines representing a glyph
+				struct muttR_Shape {
+					uint32_m num_lines;
+					muttR_Line* lines;
+					float x_max;
+					float y_max;
+				};
+				typedef struct muttR_Shape muttR_Shape;
+
+				// Sorts the lines of a shape in ascending order of bottom point
+				void muttR_ShapeSort(muttR_Shape* shape) {
+					// Just call qsort for the job
+					mu_qsort(shape->lines, shape->num_lines, sizeof(muttR_Line), muttR_CompareLines);
+				}
+
+			/* Conversions */
+
+				// Converts two points to a line
+				void muttR_GlyphLine(muttR_Line* line, float x0, float y0, float x1, float y1) {
+					// Determine lowest y0 value
+					if (y0 < y1) {
+						line->x0 = x0;
+						line->y0 = y0;
+						line->x1 = x1;
+						line->y1 = y1;
+					}
+					else {
+						line->x0 = x1;
+						line->y0 = y1;
+						line->x1 = x0;
+						line->y1 = y0;
+					}
+					// Calculate vec
+					line->vec = y1-y0;
+				}
+
+				// Converts three-point Bezier (on, off, on) to lines
+				// - Constants:
+				#define MUTTR_LINES_PER_BEZIER 25
+				//#define MUTTR_LINES_PER_BEZIER 1
+				static const float MUTTR_LINES_PER_BEZIER_F = ((float)MUTTR_LINES_PER_BEZIER);
+				static const float MUTTR_LINES_PER_BEZIER_INV = 1.f / ((float)MUTTR_LINES_PER_BEZIER);
+				// - Function:
+				static inline void muttR_GlyphCurve(muttR_Line* line, float x0, float y0, float x1, float y1, float x2, float y2) {
+					// Loop through each line per Bezier
+					for (uint32_m l = 0; l < MUTTR_LINES_PER_BEZIER; ++l) {
+						// Calculate Bezier for the first point
+						float t = ((float)l) / MUTTR_LINES_PER_BEZIER_F;
+						float bx0, by0;
+						muttR_Bezier(t, x0, y0, x1, y1, x2, y2, &bx0, &by0);
+						
+						// + Second point
+						float bx1, by1;
+						muttR_Bezier(t+MUTTR_LINES_PER_BEZIER_INV, x0, y0, x1, y1, x2, y2, &bx1, &by1);
+
+						// Make line based on this strip of the Bezier
+						muttR_GlyphLine(line++, bx0, by0, bx1, by1);
+					}
+				}
+
+				// Gets the next point of a glyph based on the contour ends
+				static inline muttRPoint* muttR_GlyphNextPoint(muttRGlyph* glyph, uint32_m p, uint32_m i, uint32_m c) {
+					// The next point is p incremented
+					muttRPoint* pn = &glyph->points[p+i];
+					// ...unless this goes over the contour's end...
+					if (p+i > glyph->contour_ends[c]) {
+						// ..in which case the next point wraps back around to the first
+						// point of the contour
+						pn -= glyph->contour_ends[c]+1;
+						if (c > 0) {
+							pn += glyph->contour_ends[c-1]+1;
+						}
+					}
+					return pn;
+				}
+
+				// Calculates the amount of lines needed to represent a glyph
+				uint32_m muttR_GlyphLineCount(muttRGlyph* glyph) {
+					// Keep count of lines:
+					uint32_m count = 0;
+					// Keep count of contours:
+					uint16_m c = 0;
+
+					// Loop through each point
+					for (uint32_m p = 0; p < glyph->num_points;) {
+						// Increment contour ID if necessary
+						if (p > glyph->contour_ends[c]) {
+							// Go to beginning of contour to avoid over-counting sometimes
+							p = glyph->contour_ends[c]+1;
+							++c;
+						}
+
+						// Get current point
+						muttRPoint* p0 = &glyph->points[p];
+
+						// If current point is ON curve (ON...):
+						if (p0->flags & MUTTR_ON_CURVE) {
+							// Get next point
+							muttRPoint* p1 = muttR_GlyphNextPoint(glyph, p, 1, c);
+							// If next point is ON curve (ON, ON):
+							if (p1->flags & MUTTR_ON_CURVE) {
+								// One more line, go to next point
+								++count;
+								++p;
+								continue;
+							}
+
+							// If we're here, the next point is OFF curve (ON, OFF...)
+							// It must be a Bezier, and we must go forward two points
+							count += MUTTR_LINES_PER_BEZIER;
+							p += 2;
+							continue;
+						}
+
+						// Get previous point
+						muttRPoint* pn1 = &glyph->points[p-1];
+						muttRPoint n1;
+						// Edge case for point being 0:
+						if (p == 0) {
+							// Wrap to end of this contour
+							pn1 = &n1;
+							n1.flags = glyph->points[glyph->contour_ends[0]].flags;
+						}
+						// Edge case for point being first point of this contour:
+						else if (c > 0 && (uint16_m)(glyph->contour_ends[c-1]+1) == p) {
+							// Wrap to end of this contour
+							pn1 = &n1;
+							n1.flags = glyph->points[glyph->contour_ends[c]].flags;
+						}
+
+						// Skip is previous point is ON curve;
+						// this avoids duplicate lines from what I'm aware
+						if (pn1->flags & MUTTR_ON_CURVE) {
+							++p;
+							continue;
+						}
+
+						// If we're here, we started on an OFF point
+						// It must be a Bezier, and we must go forward one point
+						count += MUTTR_LINES_PER_BEZIER;
+						++p;
+						//continue;
+					}
+
+					// Return final count
+					return count;
+				}
+
+				// Allocates memory for rasterization from arena, or from the heap if arena is 0
+				void* muttR_Alloc(muttArena* arena, size_m size) {
+					if (arena) {
+						return mutt_arena_alloc(arena, size);
+					}
+					return mu_malloc(size);
+				}
+
+				// Frees memory allocated with muttR_Alloc
+				// (Arena memory is let go of by the caller resetting the arena)
+				void muttR_Free(muttArena* arena, void* p) {
+					if (!arena) {
+						mu_free(p);
+					}
+				}
+
+				// Converts an rglyph to a shape
+				muttResult muttR_ShapeCreate(muttRGlyph* glyph, muttR_Shape* shape, muttArena* arena) {
+					// Calculate number of lines needed
+					shape->num_lines = muttR_GlyphLineCount(glyph);
+					// Allocate lines
+					shape->lines = (muttR_Line*)muttR_Alloc(arena, sizeof(muttR_Line)*shape->num_lines);
+					if (!shape->lines) {
+						return (arena) ?(MUTT_FAILED_ARENA) :(MUTT_FAILED_MALLOC);
+					}
+
+					// Loop through each point
+					uint32_m c = 0; // (contour tracker)
+					muttR_Line* l = shape->lines; // (shape tracker)
+					for (uint32_m p = 0; p < glyph->num_points;) {
+						// Increment contour ID if necessary
+						if (p > glyph->contour_ends[c]) {
+							// Go to beginning of contour to avoid over-counting sometimes
+							p = glyph->contour_ends[c]+1;
+							++c;
+						}
+
+						// Get current point
+						muttRPoint* p0 = &glyph->points[p];
+
+						// If current point is ON curve (ON...):
+						if (p0->flags & MUTTR_ON_CURVE) {
+							// Get next point
+							muttRPoint* p1 = muttR_GlyphNextPoint(glyph, p, 1, c);
+							// If next point is ON curve (ON, ON):
+							if (p1->flags & MUTTR_ON_CURVE) {
+								// Form line between two points and move on by one
+								muttR_GlyphLine(l++, p0->x, p0->y, p1->x, p1->y);
+								++p;
+								continue;
+							}
+
+							// If we're here, the next point is OFF curve (ON, OFF...)
+							// Get next-next point
+							muttRPoint* p2 = muttR_GlyphNextPoint(glyph, p, 2, c);
+							// If next-next point is ON the curve (ON, OFF, ON):
+							if (p2->flags & MUTTR_ON_CURVE) {
+								// Form basic Bezier and move on
+								muttR_GlyphCurve(l, p0->x, p0->y, p1->x, p1->y, p2->x, p2->y);
+								l += MUTTR_LINES_PER_BEZIER;
+								p += 2;
+								continue;
+							}
+
+							// If we're here, the next-next point is OFF the curve: (ON, OFF, OFF):
+							else {
+								// Bezier, with last point needing to be mid-pointed
+								muttR_GlyphCurve(l, p0->x, p0->y, p1->x, p1->y,
+									(p1->x + p2->x) / 2.f, (p1->y + p2->y) / 2.f
+								);
+
+								l += MUTTR_LINES_PER_BEZIER;
+								p += 2;
+								continue;
+							}
+						}
+
+						// If we're here, the current point is OFF curve (OFF...)
+						// Get previous point:
+						muttRPoint* pn1 = &glyph->points[p-1];
+						muttRPoint n1;
+						// Edge case for point being 0:
+						if (p == 0) {
+							// Wrap to last point of this contour
+							pn1 = &n1;
+							n1.x = glyph->points[glyph->contour_ends[0]].x;
+							n1.y = glyph->points[glyph->contour_ends[0]].y;
+							n1.flags = glyph->points[glyph->contour_ends[0]].flags;
+						}
+						// Edge case for point being first of contour:
+						else if (c > 0 && (uint16_m)(glyph->contour_ends[c-1]+1) == p) {
+							// Wrap to last point of this contour
+							pn1 = &n1;
+							n1.x = glyph->points[glyph->contour_ends[c]].x;
+							n1.y = glyph->points[glyph->contour_ends[c]].y;
+							n1.flags = glyph->points[glyph->contour_ends[c]].flags;
+						}
+
+						// Leave if previous point is ON;
+						// this avoids duplicate lines from what I'm aware
+						if (pn1->flags & MUTTR_ON_CURVE) {
+							++p;
+							continue;
+						}
+
+						// Get next point:
+						muttRPoint* p1 = muttR_GlyphNextPoint(glyph, p, 1, c);
+
+						// x0 and y0 must be midpointed between pn1 and p0 since
+						// both are OFF curve:
+						float x0 = (pn1->x + p0->x) / 2.f;
+						float y0 = (pn1->y + p0->y) / 2.f;
+						// x1 and y1 are just p0 since it's OFF curve:
+						float x1 = p0->x;
+						float y1 = p0->y;
+						// x2 and y2 are just p1:
+						float x2 = p1->x;
+						float y2 = p1->y;
+						// ...unless it's OFF curve, in which case it must be
+						// midpointed:
+						if (!(p1->flags & MUTTR_ON_CURVE)) {
+							x2 = (x1 + x2) / 2.f;
+							y2 = (y1 + y2) / 2.f;
+						}
+
+						// Bezier and move on:
+						muttR_GlyphCurve(l, x0, y0, x1, y1, x2, y2);
+						l += MUTTR_LINES_PER_BEZIER;
+						++p;
+						//continue;
+					}
+
+					// Sort all lines
+					muttR_ShapeSort(shape);
+					// Set max x/y
+					shape->x_max = glyph->x_max;
+					shape->y_max = glyph->y_max;
+
+					return MUTT_SUCCESS;
+				}
+
+				// Frees all memory used by a shape
+				void muttR_ShapeDestroy(muttR_Shape* shape, muttArena* arena) {
+					if (shape->lines) {
+						muttR_Free(arena, shape->lines);
+					}
+				}
+
+		/* Intersection/Hit logic */
+
+			// A hit:
+			struct muttR_Hit {
+				// The x-value of the intersection
+				float x;
+				// The line which it intersected with
+				uint32_m l;
+			};
+			typedef struct muttR_Hit muttR_Hit;
+
+			// Used to sort intersections in order of increasing x-value
+			int muttR_HitCompare(const void* p, const void* q) {
+				// Get hits
+				muttR_Hit* h0 = (muttR_Hit*)p, * h1 = (muttR_Hit*)q;
+				// Indicate which hit's x-value is greater
+				if (h0->x < h1->x) {
+					return -1;
+				} else if (h0->x > h1->x) {
+					return 1;
+				}
+				return 0;
+			}
+
+			// Updates the active line list based on the ray
+			static inline void muttR_ActiveLines(muttR_Line* lines, uint32_m num_lines, uint32_m* first, uint32_m* len, float ry) {
+				// Increase length to include possible new in-range lines
+				while ((*first) + (*len) < num_lines) {
+					if (ry >= lines[(*first) + (*len)].y0 - MUTTR_LINE_EPSILON32) {
+						*len += 1;
+					} else {
+						break;
+					}
+				}
+			}
+
+			// Calculates all hits for a given ray and its active lines
+			// Returns amount of hits, and gives winding as well
+			static inline uint32_m muttR_Hits(muttR_Line* lines, uint32_m num_lines, float ry, muttR_Hit* hits, int32_m* winding) {
+				uint32_m num_hits = 0;
+
+				// Loop through each line
+				for (uint32_m l = 0; l < num_lines; ++l) {
+					// If ray intersects with line:
+					if (ry < lines[l].y1 + MUTTR_LINE_EPSILON32) {
+						// Add intersection values
+						float x = muttR_LineRayHit(ry, lines[l].x0, lines[l].y0, lines[l].x1, lines[l].y1);
+						// Add if intersection is valid
+						if (x >= 0.f) {
+							hits[num_hits  ].x = x;
+							hits[num_hits++].l = l;
+						}
+					}
+				}
+
+				// Sort hits
+				mu_qsort(hits, num_hits, sizeof(muttR_Hit), muttR_HitCompare);
+
+				// Calculate total winding order
+				*winding = 0;
+				for (uint32_m hitw = 0; hitw < num_hits; ++hitw) {
+					winding += muttR_LineWinding(ry, &lines[hits[hitw].l]);
+				}
+
+				return num_hits;
+			}
+
+		/* Rasterization per method */
+
+			// MUTTR_FULL_PIXEL_BI_LEVEL
+			muttResult muttR_FullPixelBiLevel(muttR_Shape* shape, muttRBitmap* bitmap, uint8_m adv, uint8_m in, uint8_m out, muttArena* arena) {
+				// Allocate hit tracker
+				muttR_Hit* hits = (muttR_Hit*)muttR_Alloc(arena, shape->num_lines*sizeof(muttR_Hit));
+				if (!hits) {
+					return (arena) ?(MUTT_FAILED_ARENA) :(MUTT_FAILED_MALLOC);
+				}
+
+				// Set all pixels to out first
+				if (adv != 4) {
+					mu_memset(bitmap->pixels, out, bitmap->width * bitmap->height * adv);
+				} else {
+					mu_memset(bitmap->pixels, 0, bitmap->width * bitmap->height * adv);
+				}
+
+				// Initialize active lines
+				uint32_m first_line = 0;
+				uint32_m line_len = 0;
+
+				// Loop through each horizontal strip from bottom to top
+				for (uint32_m h = 0; h < bitmap->height; ++h) {
+					// Calculate horizontal pixel offset
+					uint64_m hpix_offset = bitmap->stride*((bitmap->height-h)-1);
+
+					// Just fill all x-values with out if the height is now outside of the glyph range
+					// (+ double-pixel extra for bleeding and ceiling)
+					if (h > shape->y_max+2) {
+						break;
+					}
+
+					// Calculate y-value of ray (middle of pixel)
+					float ray_y = ((float)h) + .5f;
+
+					// Update active line list
+					muttR_ActiveLines(shape->lines, shape->num_lines, &first_line, &line_len, ray_y);
+					// Calculate all hits with active lines (+ winding)
+					int32_m winding;
+					uint32_m num_hits = muttR_Hits(&shape->lines[first_line], line_len, ray_y, hits, &winding);
+
+					// If there are any hits:
+					if (num_hits != 0) {
+						// Set each range of in x-values based on hits to being filled in
+						size_m prev_x = mu_roundf(hits[0].x);
+						winding -= muttR_LineWinding(ray_y, &shape->lines[hits[0].l]);
+						for (uint32_m hn = 1; hn < num_hits; ++hn) {
+							if (winding != 0) {
+								if (adv != 4 || in != 0) {
+									mu_memset(&bitmap->pixels[hpix_offset+(prev_x*adv)], in, ((size_m)adv) * (((size_m)mu_roundf(hits[hn].x)) - prev_x));
+								} else {
+									uint8_m arr[4] = { 0, 0, 0, 255 };
+									size_m ie = (((size_m)mu_roundf(hits[hn].x)) - prev_x);
+									for (size_m i = 0; i < ie; ++i) {
+										mu_memcpy(&bitmap->pixels[hpix_offset+(prev_x*adv)+(i*4)], arr, 4);
+									}
+								}
+							}
+							prev_x = mu_roundf(hits[hn].x);
+							winding -= muttR_LineWinding(ray_y, &shape->lines[hits[hn].l]);
+						}
+					}
+				}
+
+				muttR_Free(arena, hits);
+				return MUTT_SUCCESS;
+			}
+
+			// MUTTR_FULL_PIXEL_AANXN inner handling
+			muttResult muttR_FullPixelAANXN(muttR_Shape* shape, muttRBitmap* bitmap, uint8_m adv, float in, float out, uint8_m vs, uint8_m hs, muttArena* arena) {
+				// Allocate hit tracker
+				muttR_Hit* hits = (muttR_Hit*)muttR_Alloc(arena, shape->num_lines * sizeof(muttR_Hit));
+				if (!hits) {
+					return (arena) ?(MUTT_FAILED_ARENA) :(MUTT_FAILED_MALLOC);
+				}
+
+				// Set all pixels to out first
+				if (adv != 4) {
+					mu_memset(bitmap->pixels, out, bitmap->width * bitmap->height * adv);
+				} else {
+					mu_memset(bitmap->pixels, 0, bitmap->width * bitmap->height * adv);
+				}
+
+				// Initialize active lines
+				uint32_m first_line = 0;
+				uint32_m line_len = 0;
+
+				// Calculate how much a pixel is worth
+				uint8_m div = roundf(256.f / ((float)vs));
+
+				// Loop through each horizontal strip from bottom to top
+				for (uint32_m h = 0; h < bitmap->height; ++h) {
+					// Calculate horizontal pixel offset
+					uint64_m hpix_offset = bitmap->stride * ((bitmap->height - h) - 1);
+
+					// Loop through each inner horiz. strip
+					for (uint8_m hi = 0; hi < hs; ++hi) {
+						// Calculate y-value of ray (middle of pixel)
+						float ray_y = ((float)h) + (((float)(hi+1)) / ((float)hs)) - (1.f / (2.f * ((float)hs)));
+
+						// Update active line list
+						muttR_ActiveLines(shape->lines, shape->num_lines, &first_line, &line_len, ray_y);
+						// Calculate all hits with active lines (+ winding)
+						int32_m winding;
+						uint32_m num_hits = muttR_Hits(&shape->lines[first_line], line_len, ray_y, hits, &winding);
+
+						// If there are any hits:
+						if (num_hits != 0) {
+							winding -= muttR_LineWinding(ray_y, &shape->lines[hits[0].l]);
+							for (uint32_m hn = 1; hn < num_hits; ++hn) {
+								// If this range between these two hits should be filled:
+								if (winding != 0) {
+									// Calculate first and last pixel of range
+									muByte* first = &bitmap->pixels[hpix_offset+(((size_m)mu_floorf(hits[hn-1].x))*adv)];
+									muByte* last = &bitmap->pixels[hpix_offset+(((size_m)mu_floorf(hits[hn].x))*adv)];
+									if (first != last) {
+										// First pixel handling
+										float pix_x = mu_floorf(hits[hn-1].x);
+										float per = mu_roundf((1.f - (hits[hn-1].x - pix_x)) * ((float)vs)) / ((float)vs);
+										uint8_m add = mu_roundf(((float)div) * per);
+										for (uint8_m a = 0; a < adv; ++a) {
+											if (adv == 4 && a+1 < adv) {
+												*first = in;
+											}
+											else if (in == 255 || adv == 4) {
+												if (*first + add > 255) {
+													*first = 255;
+												} else {
+													*first += add;
+												}
+											}
+											else {
+												if (*first - add < 0) {
+													*first = 0;
+												} else {
+													*first -= add;
+												}
+											}
+											first++;
+										}
+										// Last pixel handling
+										pix_x = mu_floorf(hits[hn].x);
+										per = mu_roundf((1.f - (hits[hn].x - pix_x)) * ((float)vs)) / ((float)vs);
+										add = mu_roundf(((float)div) * (1.f - per));
+										for (uint8_m a = 0; a < adv; ++a) {
+											if (adv == 4 && a+1 < adv) {
+												*(last + a) = in;
+											}
+											else if (in == 255 || adv == 4) {
+												if (*(last + a) + add > 255) {
+													*(last + a) = 255;
+												} else {
+													*(last + a) += add;
+												}
+											} else {
+												if (*(last + a) - add < 0) {
+													*(last + a) = 0;
+												} else {
+													*(last + a) -= add;
+												}
+											}
+										}
+										// Intermediate pixel handling
+										uint8_m a = 0;
+										while (first != last) {
+											if (adv == 4 && a+1 < adv) {
+												*first = in;
+											}
+											else if (in == 255 || adv == 4) {
+												if (*first + div > 255) {
+													*first = 255;
+												} else {
+													*first += div;
+												}
+											}
+											else {
+												if (*first - div < 0) {
+													*first = 0;
+												} else {
+													*first -= div;
+												}
+											}
+
+											++first;
+											a = (a + 1) % 4;
+										}
+									}
+								}
+								winding -= muttR_LineWinding(ray_y, &shape->lines[hits[hn].l]);
+							}
+						}
+					}
+				}
+
+				muttR_Free(arena, hits);
+				return MUTT_SUCCESS;
+			}
+
+		/* Rasterization */
+
+			// Converts channels to advance
+			uint8_m muttR_ChannelsAdv(muttRChannels channels) {
+				switch (channels) {
+					default: return 1; break;
+					case MUTTR_R: return 1; break;
+					case MUTTR_RGB: return 3; break;
+					case MUTTR_RGBA: return 4; break;
+				}
+			}
+
+			// Rasterizes a glyph, with memory from arena, or from the heap if arena is 0
+			muttResult muttR_RasterGlyph(muttRGlyph* glyph, muttRBitmap* bitmap, muttRMethod method, muttArena* arena) {
+				// Convert rglyph to shape
+				muttR_Shape shape;
+				muttResult res = muttR_ShapeCreate(glyph, &shape, arena);
+				if (mutt_result_is_fatal(res)) {
+					return res;
+				}
+
+				// Per-pixel advance based on channels:
+				uint8_m adv = muttR_ChannelsAdv(bitmap->channels);
+				// In/Out value based on io_color:
+				uint8_m in  = (bitmap->io_color == MUTTR_BW) ?(255) :(0);
+				uint8_m out = ~in;
+
+				// Render shape based on method
+				switch (method) {
+					// Unrecognized method:
+					default: {
+						res = MUTT_UNKNOWN_RASTER_METHOD;
+					} break;
+
+					// Full-pixel bi-level
+					case MUTTR_FULL_PIXEL_BI_LEVEL: {
+						res = muttR_FullPixelBiLevel(&shape, bitmap, adv, in, out, arena);
+					} break;
+
+					// Full-pixel AA 2x2
+					case MUTTR_FULL_PIXEL_AA2X2: {
+						res = muttR_FullPixelAANXN(&shape, bitmap, adv, in, out, 2, 2, arena);
+					} break;
+					// Full-pixel AA 4x4
+					case MUTTR_FULL_PIXEL_AA4X4: {
+						res = muttR_FullPixelAANXN(&shape, bitmap, adv, in, out, 4, 4, arena);
+					} break;
+					// Full-pixel AA 8x8
+					case MUTTR_FULL_PIXEL_AA8X8: {
+						res = muttR_FullPixelAANXN(&shape, bitmap, adv, in, out, 8, 8, arena);
+					} break;
+				}
+
+				// Free resources and return latest non-fatal result
+				muttR_ShapeDestroy(&shape, arena);
+				return res;
+			}
+
+			// Rasterizes a glyph
+			MUDEF muttResult mutt_raster_glyph(muttRGlyph* glyph, muttRBitmap* bitmap, muttRMethod method) {
+				return muttR_RasterGlyph(glyph, bitmap, method, 0);
+			}
+
+			// Rasterizes a glyph with memory from an arena
+			MUDEF muttResult mutt_raster_glyph_arena(muttRGlyph* glyph, muttRBitmap* bitmap, muttRMethod method, muttArena* arena) {
+				// Rasterize, letting go of all memory used after
+				uint64_m mark = mutt_arena_mark(arena);
+				muttResult res = muttR_RasterGlyph(glyph, bitmap, method, arena);
+				mutt_arena_reset(arena, mark);
+				return res;
+			}
+
+		/* Conversion */
+
+			// FUnits to pixel-units
+			MUDEF float mutt_funits_to_punits(muttFont* font, float funits, float point_size, float ppi) {
+				return point_size * funits * ppi / (72.f * font->head->units_per_em);
+			}
+
+			// Gets the ascent/descent/lsb/advance-width of an rglyph for a glyph ID
+			MUDEF void mutt_rglyph_metrics(muttFont* font, muttGlyphHeader* header, uint16_m glyph_id, muttRGlyph* rglyph, float point_size, float ppi) {
+				// Offsets
+				float py = -mutt_funits_to_punits(font, header->y_min, point_size, ppi) + 1.f;
+
+				// Ascender + Descender
+				rglyph->ascender  = py + mutt_funits_to_punits(font, font->hhea->ascender , point_size, ppi);
+				rglyph->descender = py + mutt_funits_to_punits(font, font->hhea->descender, point_size, ppi);
+
+				// Left-side bearing + Advance width
+				rglyph->lsb = mutt_funits_to_punits(font, mutt_glyph_lsb(font, glyph_id), point_size, ppi);
+				rglyph->advance_width = mutt_funits_to_punits(font, mutt_glyph_advance(font, glyph_id), point_size, ppi);
+			}
+
+			// Converts FUnits to pixel-units in bulk
+			// (Each operation is in the same order as mutt_funits_to_punits so that the results match)
+			void mutt_FUnitsToPUnitsBulk(int32_m* funits, float* punits, uint32_m count, float point_size, float ppi, float units_per_em) {
+				float div = 72.f * units_per_em;
+				uint32_m i = 0;
+
+				#if defined(MUTT_AVX2)
+
+				__m256 v_point_size = _mm256_set1_ps(point_size);
+				__m256 v_ppi = _mm256_set1_ps(ppi);
+				__m256 v_div = _mm256_set1_ps(div);
+				for (; i+8 <= count; i += 8) {
+					__m256 f = _mm256_cvtepi32_ps(_mm256_loadu_si256((const __m256i*)(funits+i)));
+					_mm256_storeu_ps(punits+i, _mm256_div_ps(_mm256_mul_ps(_mm256_mul_ps(v_point_size, f), v_ppi), v_div));
+				}
+
+				#elif defined(MUTT_SSSE3) || defined(MUTT_SSE2)
+
+				__m128 v_point_size = _mm_set1_ps(point_size);
+				__m128 v_ppi = _mm_set1_ps(ppi);
+				__m128 v_div = _mm_set1_ps(div);
+				for (; i+4 <= count; i += 4) {
+					__m128 f = _mm_cvtepi32_ps(_mm_loadu_si128((const __m128i*)(funits+i)));
+					_mm_storeu_ps(punits+i, _mm_div_ps(_mm_mul_ps(_mm_mul_ps(v_point_size, f), v_ppi), v_div));
+				}
+
+				#endif
+
+				for (; i < count; ++i) {
+					punits[i] = point_size * ((float)funits[i]) * ppi / div;
+				}
+			}
+
+			// Amount of glyphs gathered at a time by mutt_glyph_metrics_batch
+			#define MUTT_METRICS_BATCH_CHUNK 64
+
+			MUDEF void mutt_glyph_metrics_batch(muttFont* font, uint16_m* glyph_ids, uint32_m count, float point_size, float ppi, float* advances, float* lsbs) {
+				int32_m funits[MUTT_METRICS_BATCH_CHUNK];
+				float units_per_em = font->head->units_per_em;
+				muBool dense = (font->mode_flags & MUTT_LOAD_DENSE) != 0;
+
+				for (uint32_m c = 0; c < count; c += MUTT_METRICS_BATCH_CHUNK) {
+					uint32_m len = count - c;
+					if (len > MUTT_METRICS_BATCH_CHUNK) {
+						len = MUTT_METRICS_BATCH_CHUNK;
+					}
+
+					// Advance widths
+					if (advances) {
+						if (dense) {
+							for (uint32_m i = 0; i < len; ++i) {
+								funits[i] = font->hmtx->advances[glyph_ids[c+i]];
+							}
+						} else {
+							for (uint32_m i = 0; i < len; ++i) {
+								funits[i] = mutt_glyph_advance(font, glyph_ids[c+i]);
+							}
+						}
+						mutt_FUnitsToPUnitsBulk(funits, advances+c, len, point_size, ppi, units_per_em);
+					}
+
+					// Left-side bearings
+					if (lsbs) {
+						if (dense) {
+							for (uint32_m i = 0; i < len; ++i) {
+								funits[i] = font->hmtx->lsbs[glyph_ids[c+i]];
+							}
+						} else {
+							for (uint32_m i = 0; i < len; ++i) {
+								funits[i] = mutt_glyph_lsb(font, glyph_ids[c+i]);
+							}
+						}
+						mutt_FUnitsToPUnitsBulk(funits, lsbs+c, len, point_size, ppi, units_per_em);
+					}
+				}
+			}
+
+			/* Simple */
+
+				// Simple glyph -> raster glyph
+				MUDEF muttResult mutt_simple_rglyph(muttFont* font, muttGlyphHeader* header, muttSimpleGlyph* glyph, muttRGlyph* rglyph, float point_size, float ppi, muByte* data, uint32_m* written) {
+					// For written calculations:
+					if (!data) {
+						uint32_m write = 0;
+						// points
+						write += sizeof(muttRPoint) * (glyph->end_pts_of_contours[header->number_of_contours-1] + 1);
+						// contour_ends
+						write += sizeof(uint16_m) * header->number_of_contours;
+						// Write data needed
+						*written = write;
+						return MUTT_SUCCESS;
+					}
+
+					// Get data for arrays
+					muByte* orig_data = data;
+					// - points
+					rglyph->num_points = glyph->end_pts_of_contours[header->number_of_contours-1] + 1;
+					rglyph->points = (muttRPoint*)data;
+					data += sizeof(muttRPoint) * ((uint32_m)rglyph->num_points);
+					// - contour_ends
+					rglyph->num_contours = header->number_of_contours;
+					rglyph->contour_ends = (uint16_m*)data;
+					data += sizeof(uint16_m) * ((uint32_m)rglyph->num_contours);
+					// Write written data amount
+					if (written) {
+						*written = data-orig_data;
+					}
+
+					// Calculate point offsets based on glyph's min/max values
+					float px = -mutt_funits_to_punits(font, header->x_min, point_size, ppi) + 1.f;
+					float py = -mutt_funits_to_punits(font, header->y_min, point_size, ppi) + 1.f;
+
+					// Loop through each point
+					for (uint16_m p = 0; p < rglyph->num_points; ++p) {
+						// X and Y
+						rglyph->points[p].x = px + mutt_funits_to_punits(font, glyph->points[p].x, point_size, ppi);
+						rglyph->points[p].y = py + mutt_funits_to_punits(font, glyph->points[p].y, point_size, ppi);
+						// Flags
+						rglyph->points[p].flags = (glyph->points[p].flags & MUTT_ON_CURVE_POINT) ?(MUTTR_ON_CURVE) :(0);
+					}
+
+					// Copy over contour ends
+					mu_memcpy(rglyph->contour_ends, glyph->end_pts_of_contours, sizeof(uint16_m) * ((uint32_m)rglyph->num_contours));
+
+					// Caclculate x_max and y_max
+					rglyph->x_max = px + mutt_funits_to_punits(font, header->x_max, point_size, ppi);
+					rglyph->y_max = py + mutt_funits_to_punits(font, header->y_max, point_size, ppi);
+
+					return MUTT_SUCCESS;
+				}
+
+				// Memory maximum
+				MUDEF uint32_m mutt_simple_rglyph_max(muttFont* font) {
+					return
+						// points
+						(sizeof(muttRPoint) * font->maxp->max_points)
+						// contour_ends
+						+ (sizeof(uint16_m) * font->maxp->max_contours)
+					;
+				}
+
+				// Simple glyph -> raster glyph, with memory from an arena
+				MUDEF muttResult mutt_simple_rglyph_arena(muttFont* font, muttGlyphHeader* header, muttSimpleGlyph* glyph, muttRGlyph* rglyph, float point_size, float ppi, muttArena* arena) {
+					// Calculate exact memory needed
+					uint32_m size;
+					mutt_simple_rglyph(font, header, glyph, rglyph, point_size, ppi, 0, &size);
+
+					// Allocate it
+					muByte* data = (muByte*)mutt_arena_alloc(arena, size);
+					if (!data) {
+						return MUTT_FAILED_ARENA;
+					}
+
+					// Convert
+					return mutt_simple_rglyph(font, header, glyph, rglyph, point_size, ppi, data, 0);
+				}
+
+			/* Composite */
+
+				// A composite glyph within a composite glyph whose components are being processed
+				struct muttR_CompFrame {
+					// Component (within the parent glyph) that is this glyph
+					muttComponentGlyph comp;
+					// Header of this glyph
+					muttGlyphHeader header;
+					// Progress through this glyph's components
+					muByte* bprog;
+					muBool no_more;
+					uint32_m component_count;
+					// Points before this glyph's components were processed
+					uint16_m prev_num_points;
+					muttRPoint* prev_points;
+				};
+				typedef struct muttR_CompFrame muttR_CompFrame;
+
+				// Used to pass data between function calls within composite glyph processing
+				struct muttR_CompProg {
+					// Progressives (move up between rglyphs):
+					uint32_m num_contours;
+					uint32_m num_points;
+					uint16_m* contour_ends;
+					muttRPoint* points;
+					float x_min;
+					float y_min;
+					float x_max;
+					float y_max;
+					// Actual rglyph being filled in:
+					muttRGlyph* rglyph;
+					// Temp simple glyph mem:
+					muByte* temp_simple_max;
+					// Stack of composite glyphs being processed:
+					muttR_CompFrame* frames;
+					uint32_m num_frames;
+					// Max values:
+					uint16_m max_contours;
+					uint16_m max_points;
+				};
+				typedef struct muttR_CompProg muttR_CompProg;
+
+				// Initializes a CompProg struct
+				// (scratch is mutt_composite_scratch_max bytes, holding the temp simple glyph
+				// memory followed by the stack)
+				void muttR_CompProg_init(muttR_CompProg* prog, muttRGlyph* rglyph, muByte* scratch, muttFont* font) {
+					// Set numerical progressives to 0
+					prog->num_contours = 0;
+					prog->num_points = 0;
+					prog->x_min = 0.f;
+					prog->y_min = 0.f;
+					prog->x_max = 0.f;
+					prog->y_max = 0.f;
+					// Set initial progressive pointers
+					prog->contour_ends = rglyph->contour_ends;
+					prog->points = rglyph->points;
+					// Rglyph
+					prog->rglyph = rglyph;
+					rglyph->num_points = 0;
+					rglyph->num_contours = 0;
+					// Temp simple max and stack
+					prog->temp_simple_max = scratch;
+					prog->frames = (muttR_CompFrame*)(scratch + MUTT_TABLE_ALIGN_UP(mutt_simple_glyph_max_size(font)));
+					prog->num_frames = 0;
+					// Max values
+					prog->max_contours = font->maxp->max_composite_contours;
+					prog->max_points = font->maxp->max_composite_points;
+				}
+
+				// Converts simple glyph component to rglyph within the CompProg
+				// Glyph must have at least 1 contour
+				// This process gives the raw TrueType coordinates in float form;
+				// point and PPI are accounted for afterwards to separate that
+				// logic from the point alignment and such.
+				muttResult mutt_composite_simple_rglyph(muttR_CompProg* prog, muttGlyphHeader* header, muttSimpleGlyph* glyph, muttComponentGlyph* comp) {
+					// Account for number of contours
+					prog->num_contours += header->number_of_contours;
+					if (prog->num_contours > prog->max_contours) {
+						return MUTT_INVALID_RGLYPH_COMPOSITE_CONTOUR_COUNT;
+					}
+					// Account for number of points
+					prog->num_points += glyph->end_pts_of_contours[header->number_of_contours-1]+1;
+					if (prog->num_points > prog->max_points) {
+						return MUTT_INVALID_RGLYPH_COMPOSITE_POINT_COUNT;
+					}
+					uint16_m num_points = glyph->end_pts_of_contours[header->number_of_contours-1]+1;
+
+					// Calculate scales
+					float xscale=1.f, scale01=0.f, scale10=0.f, yscale=1.f;
+
+					if (comp->flags & MUTT_WE_HAVE_A_SCALE) {
+						// One scale applied to x and y
+						xscale = yscale = comp->scales[0];
+					}
+					else if (comp->flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE) {
+						// Individual x and y scale
+						xscale = comp->scales[0];
+						yscale = comp->scales[1];
+					}
+					else if (comp->flags & MUTT_WE_HAVE_A_TWO_BY_TWO) {
+						// Full 2x2 affine transformation
+						xscale  = comp->scales[0];
+						scale01 = comp->scales[1];
+						scale10 = comp->scales[2];
+						yscale  = comp->scales[3];
+					}
+
+
+					// Calculate argument1 & argument2 offsets
+					float argument1, argument2;
+					if (comp->flags & MUTT_ARGS_ARE_XY_VALUES) {
+						// Just read the offsets
+						argument1 = comp->argument1;
+						argument2 = comp->argument2;
+						// Possible scaling:
+						if (comp->flags & MUTT_SCALED_COMPONENT_OFFSET) {
+							float n_argument1 = (xscale  * argument1) + (scale10 * argument2);
+							float n_argument2 = (scale01 * argument1) + (yscale  * argument2);
+							argument1 = n_argument1;
+							argument2 = n_argument2;
+							// Possible rounding:
+							if (comp->flags & MUTT_ROUND_XY_TO_GRID) {
+								argument1 = mu_roundf(argument1);
+								argument2 = mu_roundf(argument2);
+							}
+						}
+					}
+					else {
+						// argument1 is parent (prog->rglyph) point number
+						// argument2 is child (glyph) point number
+						// Offset should align these two points
+
+						// NOTE: phantom points can be used in this process, but
+						// mutt v1.0.0 doesn't have support for gvar (which, as
+						// far as I can tell, is needed to process the phantom
+						// points); composite glyphs that depend on phantom
+						// points will, for now, render incorrectly or possibly
+						// not render successfully at all.
+
+						// - Parent point -
+						// Ensure point number is in range
+						if (comp->argument1 >= prog->rglyph->num_points) {
+							return MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_ARGUMENT1;
+						}
+						// Get parent x and y
+						float parent_x = prog->rglyph->points[comp->argument1].x;
+						float parent_y = prog->rglyph->points[comp->argument1].y;
+
+						// - Child point -
+						// Ensure point number is in range
+						if (comp->argument2 >= num_points) {
+							return MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_ARGUMENT2;
+						}
+						// Get child x and y
+						float t_child_x = glyph->points[comp->argument2].x;
+						float t_child_y = glyph->points[comp->argument2].y;
+						// Calculate it with scales applied so that point is still
+						// aligned with scales
+						float child_x = (xscale  * t_child_x) + (scale10 * t_child_y);
+						float child_y = (scale01 * t_child_x) + (yscale  * t_child_y);
+
+						// Calcaulte argument1 & argument2 to be offsets that align
+						// the child point to the parent point
+						argument1 = parent_x - child_x;
+						argument2 = parent_y - child_y;
+					}
+
+					// Loop through each point
+					for (uint16_m p = 0; p < num_points; ++p) {
+						// Calculate scaled point
+						float point_x = glyph->points[p].x;
+						float point_y = glyph->points[p].y;
+						prog->points[p].x = (xscale  * point_x) + (scale10 * point_y);
+						prog->points[p].y = (scale01 * point_x) + (yscale  * point_y);
+						// Add offsets
+						prog->points[p].x += argument1;
+						prog->points[p].y += argument2;
+
+						// Flags of this point
+						prog->points[p].flags = (glyph->points[p].flags & MUTT_ON_CURVE_POINT) ?(MUTTR_ON_CURVE) :(0);
+					}
+					// Push progressive points pointer
+					prog->points += num_points;
+
+					// Loop through each contour end
+					for (uint16_m c = 0; c < header->number_of_contours; ++c) {
+						// Each contour end is the glyph-relative contour end
+						// with the offset of all the previous points
+						// I'm bad at explaining numbers
+						prog->contour_ends[c] = prog->rglyph->num_points + glyph->end_pts_of_contours[c];
+					}
+					// Push progressive contour ends pointer
+					prog->contour_ends += header->number_of_contours;
+
+					// Add to rglyph
+					prog->rglyph->num_points += num_points;
+					prog->rglyph->num_contours += header->number_of_contours;
+					return MUTT_SUCCESS;
+				}
+
+				// Applies a composite component's transformation and offset to the points
+				// of the composite glyph it refers to, which have already been processed
+				// (This code is considerably similar to mutt_composite_simple_rglyph)
+				muttResult mutt_ComponentTransform(muttR_CompProg* prog, muttComponentGlyph* comp, uint16_m prev_num_points, muttRPoint* prev_points) {
+					// Calculate this component's values
+					uint16_m num_points = prog->num_points - prev_num_points;
+
+					// Calculate scales
+					float xscale=1.f, scale01=0.f, scale10=0.f, yscale=1.f;
+
+					if (comp->flags & MUTT_WE_HAVE_A_SCALE) {
+						// One scale applied to x and y
+						xscale = yscale = comp->scales[0];
+					}
+					else if (comp->flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE) {
+						// Individual x and y scale
+						xscale = comp->scales[0];
+						yscale = comp->scales[1];
+					}
+					else if (comp->flags & MUTT_WE_HAVE_A_TWO_BY_TWO) {
+						// Full 2x2 affine transformation
+						xscale  = comp->scales[0];
+						scale01 = comp->scales[1];
+						scale10 = comp->scales[2];
+						yscale  = comp->scales[3];
+					}
+
+					// Calculate argument1 and argument2 offsets
+					float argument1, argument2;
+					if (comp->flags & MUTT_ARGS_ARE_XY_VALUES) {
+						// Just read the offsets
+						argument1 = comp->argument1;
+						argument2 = comp->argument2;
+						// Possible scaling:
+						if (comp->flags & MUTT_SCALED_COMPONENT_OFFSET) {
+							float n_argument1 = (xscale  * argument1) + (scale10 * argument2);
+							float n_argument2 = (scale01 * argument1) + (yscale  * argument2);
+							argument1 = n_argument1;
+							argument2 = n_argument2;
+							// Possible rounding:
+							if (comp->flags & MUTT_ROUND_XY_TO_GRID) {
+								argument1 = mu_roundf(argument1);
+								argument2 = mu_roundf(argument2);
+							}
+						}
+					}
+					else {
+						// argument1 is parent (rglyph->points, prev_num_points)
+						// argument2 is child (prev_points, num_points)
+
+						// - Parent point -
+						// Ensure point range
+						if (comp->argument1 >= prev_num_points) {
+							return MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_ARGUMENT1;
+						}
+						// Get parent x and y
+						float parent_x = prog->rglyph->points[comp->argument1].x;
+						float parent_y = prog->rglyph->points[comp->argument1].y;
+
+						// - Child point -
+						// Ensure point range
+						if (comp->argument2 >= num_points) {
+							return MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_ARGUMENT2;
+						}
+						// Get child x and y
+						float t_child_x = prev_points[comp->argument2].x;
+						float t_child_y = prev_points[comp->argument2].y;
+						// Calculate it with scales applied so that point is still
+						// aligned with scales
+						float child_x = (xscale  * t_child_x) + (scale10 * t_child_y);
+						float child_y = (scale01 * t_child_x) + (yscale  * t_child_y);
+
+						// Calculate argument1 & argument2 to be offsets that align
+						// the child point to the parent point
+						argument1 = parent_x - child_x;
+						argument2 = parent_y - child_y;
+					}
+
+					// Loop through each point
+					for (uint16_m p = 0; p < num_points; ++p) {
+						// Calculate scaled point
+						float point_x = prev_points[p].x;
+						float point_y = prev_points[p].y;
+						prev_points[p].x = (xscale  * point_x) + (scale10 * point_y);
+						prev_points[p].y = (scale01 * point_x) + (yscale  * point_y);
+						// Add offsets
+						prev_points[p].x += argument1;
+						prev_points[p].y += argument2;
+					}
+
+					return MUTT_SUCCESS;
 				}
 
-				// Set all pixels to out first
-				if (adv != 4) {
-					mu_memset(bitmap->pixels, out, bitmap->width * bitmap->height * adv);
-				} else {
-					mu_memset(bitmap->pixels, 0, bitmap->width * bitmap->height * adv);
-				}
+				// Starts processing a composite component for CompProg: simple glyphs are
+				// processed right away, and composite glyphs are pushed onto the stack to
+				// have their components processed
+				muttResult mutt_ComponentEnter(muttFont* font, muttR_CompProg* prog, muttComponentGlyph* comp) {
+					muttResult res = MUTT_SUCCESS;
 
-				// Initialize active lines
-				uint32_m first_line = 0;
-				uint32_m line_len = 0;
+					// Get header of glyph index
+					muttGlyphHeader header;
+					res = mutt_GlyphHeader(font, comp->glyph_index, &header, MU_TRUE);
+					if (mutt_result_is_fatal(res)) {
+						return res;
+					}
 
-				// Calculate how much a pixel is worth
-				uint8_m div = roundf(256.f / ((float)vs));
+					// Simple glyph with contours:
+					if (header.number_of_contours > 0) {
+						// Get simple glyph from outline cache if there is one
+						if (font->outlines) {
+							muttOutline* outline;
+							res = mutt_OutlineAcquire(font, comp->glyph_index, &header, prog->temp_simple_max, &outline);
+							if (mutt_result_is_fatal(res)) {
+								return res;
+							}
 
-				// Loop through each horizontal strip from bottom to top
-				for (uint32_m h = 0; h < bitmap->height; ++h) {
-					// Calculate horizontal pixel offset
-					uint64_m hpix_offset = bitmap->stride * ((bitmap->height - h) - 1);
+							// Process simple glyph
+							res = mutt_composite_simple_rglyph(prog, &outline->header, &outline->glyph, comp);
+							mutt_OutlineRelease(font, outline);
+							return res;
+						}
 
-					// Loop through each inner horiz. strip
-					for (uint8_m hi = 0; hi < hs; ++hi) {
-						// Calculate y-value of ray (middle of pixel)
-						float ray_y = ((float)h) + (((float)(hi+1)) / ((float)hs)) - (1.f / (2.f * ((float)hs)));
+						// Get simple glyph
+						muttSimpleGlyph glyph;
+						res = mutt_simple_glyph(font, &header, &glyph, prog->temp_simple_max, 0);
+						if (mutt_result_is_fatal(res)) {
+							return res;
+						}
 
-						// Update active line list
-						muttR_ActiveLines(shape->lines, shape->num_lines, &first_line, &line_len, ray_y);
-						// Calculate all hits with active lines (+ winding)
-						int32_m winding;
-						uint32_m num_hits = muttR_Hits(&shape->lines[first_line], line_len, ray_y, hits, &winding);
+						// Process simple glyph
+						return mutt_composite_simple_rglyph(prog, &header, &glyph, comp);
+					}
 
-						// If there are any hits:
-						if (num_hits != 0) {
-							winding -= muttR_LineWinding(ray_y, &shape->lines[hits[0].l]);
-							for (uint32_m hn = 1; hn < num_hits; ++hn) {
-								// If this range between these two hits should be filled:
-								if (winding != 0) {
-									// Calculate first and last pixel of range
-									muByte* first = &bitmap->pixels[hpix_offset+(((size_m)mu_floorf(hits[hn-1].x))*adv)];
-									muByte* last = &bitmap->pixels[hpix_offset+(((size_m)mu_floorf(hits[hn].x))*adv)];
-									if (first != last) {
-										// First pixel handling
-										float pix_x = mu_floorf(hits[hn-1].x);
-										float per = mu_roundf((1.f - (hits[hn-1].x - pix_x)) * ((float)vs)) / ((float)vs);
-										uint8_m add = mu_roundf(((float)div) * per);
-										for (uint8_m a = 0; a < adv; ++a) {
-											if (adv == 4 && a+1 < adv) {
-												*first = in;
-											}
-											else if (in == 255 || adv == 4) {
-												if (*first + add > 255) {
-													*first = 255;
-												} else {
-													*first += add;
-												}
-											}
-											else {
-												if (*first - add < 0) {
-													*first = 0;
-												} else {
-													*first -= add;
-												}
-											}
-											first++;
-										}
-										// Last pixel handling
-										pix_x = mu_floorf(hits[hn].x);
-										per = mu_roundf((1.f - (hits[hn].x - pix_x)) * ((float)vs)) / ((float)vs);
-										add = mu_roundf(((float)div) * (1.f - per));
-										for (uint8_m a = 0; a < adv; ++a) {
-											if (adv == 4 && a+1 < adv) {
-												*(last + a) = in;
-											}
-											else if (in == 255 || adv == 4) {
-												if (*(last + a) + add > 255) {
-													*(last + a) = 255;
-												} else {
-													*(last + a) += add;
-												}
-											} else {
-												if (*(last + a) - add < 0) {
-													*(last + a) = 0;
-												} else {
-													*(last + a) -= add;
-												}
-											}
-										}
-										// Intermediate pixel handling
-										uint8_m a = 0;
-										while (first != last) {
-											if (adv == 4 && a+1 < adv) {
-												*first = in;
-											}
-											else if (in == 255 || adv == 4) {
-												if (*first + div > 255) {
-													*first = 255;
-												} else {
-													*first += div;
-												}
-											}
-											else {
-												if (*first - div < 0) {
-													*first = 0;
-												} else {
-													*first -= div;
-												}
-											}
+					// Simple glyph with no contours:
+					else if (header.number_of_contours == 0) {
+						// Do nothing for this guy
+						return res;
+					}
 
-											++first;
-											a = (a + 1) % 4;
-										}
-									}
-								}
-								winding -= muttR_LineWinding(ray_y, &shape->lines[hits[hn].l]);
-							}
+					// Composite glyph:
+					// - Verify depth
+					// (The components of the top composite glyph are at depth 1)
+					if (prog->num_frames + 2 > font->maxp->max_component_depth) {
+						return MUTT_INVALID_RGLYPH_COMPOSITE_DEPTH;
+					}
+					// - Verify that it isn't already being processed
+					for (uint32_m f = 0; f < prog->num_frames; ++f) {
+						if (prog->frames[f].comp.glyph_index == comp->glyph_index) {
+							return MUTT_INVALID_RGLYPH_COMPOSITE_CYCLE;
 						}
 					}
+					// - Push it
+					muttR_CompFrame* frame = &prog->frames[prog->num_frames++];
+					frame->comp = *comp;
+					frame->header = header;
+					frame->bprog = header.data;
+					frame->no_more = MU_FALSE;
+					frame->component_count = 0;
+					frame->prev_num_points = prog->num_points;
+					frame->prev_points = prog->points;
+					return res;
 				}
 
-				mu_free(hits);
-				return MUTT_SUCCESS;
-			}
-
-		/* Rasterization */
-
-			// Converts channels to advance
-			uint8_m muttR_ChannelsAdv(muttRChannels channels) {
-				switch (channels) {
-					default: return 1; break;
-					case MUTTR_R: return 1; break;
-					case MUTTR_RGB: return 3; break;
-					case MUTTR_RGBA: return 4; break;
-				}
-			}
+				// Processes composite component for CompProg
+				// (Composite glyphs within it are processed with the stack in prog rather
+				// than by recursion)
+				muttResult mutt_component_rglyph(muttFont* font, muttR_CompProg* prog, muttComponentGlyph* comp) {
+					uint32_m base = prog->num_frames;
+					muttResult res = mutt_ComponentEnter(font, prog, comp);
+					if (mutt_result_is_fatal(res)) {
+						return res;
+					}
 
-			// Rasterizes a glyph
-			MUDEF muttResult mutt_raster_glyph(muttRGlyph* glyph, muttRBitmap* bitmap, muttRMethod method) {
-				// Convert rglyph to shape
-				muttR_Shape shape;
-				muttResult res = muttR_ShapeCreate(glyph, &shape);
-				if (mutt_result_is_fatal(res)) {
-					return res;
-				}
+					while (prog->num_frames > base) {
+						muttR_CompFrame* frame = &prog->frames[prog->num_frames-1];
 
-				// Per-pixel advance based on channels:
-				uint8_m adv = muttR_ChannelsAdv(bitmap->channels);
-				// In/Out value based on io_color:
-				uint8_m in  = (bitmap->io_color == MUTTR_BW) ?(255) :(0);
-				uint8_m out = ~in;
+						// Process next component of the composite glyph on top
+						if (!frame->no_more) {
+							// Verify incremented component count
+							if (++frame->component_count > font->maxp->max_component_elements) {
+								return MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_COUNT;
+							}
 
-				// Render shape based on method
-				switch (method) {
-					// Unrecognized method:
-					default: {
-						res = MUTT_UNKNOWN_RASTER_METHOD;
-					} break;
+							// Get individual component
+							muttComponentGlyph this_component;
+							res = mutt_composite_component(font, &frame->header, &frame->bprog, &this_component, &frame->no_more);
+							if (mutt_result_is_fatal(res)) {
+								return res;
+							}
+							// Start processing it (which may push it)
+							res = mutt_ComponentEnter(font, prog, &this_component);
+							if (mutt_result_is_fatal(res)) {
+								return res;
+							}
+							continue;
+						}
 
-					// Full-pixel bi-level
-					case MUTTR_FULL_PIXEL_BI_LEVEL: {
-						res = muttR_FullPixelBiLevel(&shape, bitmap, adv, in, out);
-					} break;
+						// Every component is processed; apply this glyph's transformation and pop it
+						res = mutt_ComponentTransform(prog, &frame->comp, frame->prev_num_points, frame->prev_points);
+						if (mutt_result_is_fatal(res)) {
+							return res;
+						}
+						prog->num_frames -= 1;
+					}
 
-					// Full-pixel AA 2x2
-					case MUTTR_FULL_PIXEL_AA2X2: {
-						res = muttR_FullPixelAANXN(&shape, bitmap, adv, in, out, 2, 2);
-					} break;
-					// Full-pixel AA 4x4
-					case MUTTR_FULL_PIXEL_AA4X4: {
-						res = muttR_FullPixelAANXN(&shape, bitmap, adv, in, out, 4, 4);
-					} break;
-					// Full-pixel AA 8x8
-					case MUTTR_FULL_PIXEL_AA8X8: {
-						res = muttR_FullPixelAANXN(&shape, bitmap, adv, in, out, 8, 8);
-					} break;
+					return res;
 				}
 
-				// Free resources and return latest non-fatal result
-				muttR_ShapeDestroy(&shape);
-				return res;
-			}
+				// Converts composite points in FUnits (which can be rglyph->points) to pixel
+				// coordinates in rglyph->points, based on the given x/y min/max in FUnits
+				void mutt_CompositePUnits(muttFont* font, muttRPoint* funits, muttRGlyph* rglyph, float x_min, float y_min, float x_max, float y_max, float point_size, float ppi) {
+					// Much of this code is considerably similar to mutt_simple_rglyph
 
-		/* Conversion */
+					// Calculate point offsets based on glyph's min/max values
+					float px = -mutt_funits_to_punits(font, x_min, point_size, ppi) + 1.f;
+					float py = -mutt_funits_to_punits(font, y_min, point_size, ppi) + 1.f;
 
-			// FUnits to pixel-units
-			MUDEF float mutt_funits_to_punits(muttFont* font, float funits, float point_size, float ppi) {
-				return point_size * funits * ppi / (72.f * font->head->units_per_em);
-			}
+					// Loop through each point
+					for (uint16_m p = 0; p < rglyph->num_points; ++p) {
+						// X and Y
+						rglyph->points[p].x = px + mutt_funits_to_punits(font, funits[p].x, point_size, ppi);
+						rglyph->points[p].y = py + mutt_funits_to_punits(font, funits[p].y, point_size, ppi);
+						// Flags
+						rglyph->points[p].flags = funits[p].flags;
+					}
 
-			// Gets the ascent/descent/lsb/advance-width of an rglyph for a glyph ID
-			MUDEF void mutt_rglyph_metrics(muttFont* font, muttGlyphHeader* header, uint16_m glyph_id, muttRGlyph* rglyph, float point_size, float ppi) {
-				// Offsets
-				float py = -mutt_funits_to_punits(font, header->y_min, point_size, ppi) + 1.f;
+					// Calculate x/y max
+					rglyph->x_max = px + mutt_funits_to_punits(font, x_max, point_size, ppi);
+					rglyph->y_max = py + mutt_funits_to_punits(font, y_max, point_size, ppi);
+				}
 
-				// Ascender + Descender
-				rglyph->ascender  = py + mutt_funits_to_punits(font, font->hhea->ascender , point_size, ppi);
-				rglyph->descender = py + mutt_funits_to_punits(font, font->hhea->descender, point_size, ppi);
+				// Converts all TrueType-calculated coordinates from a composite-converted rglyph
+				// to pixel coordinates
+				// OR, if convert_to_punits is false, it just calculates the x/y min/max within
+				// prog
+				muttResult mutt_composite_rglyph_coords(muttFont* font, muttR_CompProg* prog, muttRGlyph* rglyph, float point_size, float ppi, muBool convert_to_punits) {
+					// Calculate x/y min/max values
+					prog->x_min = prog->x_max = rglyph->points[0].x;
+					prog->y_min = prog->y_max = rglyph->points[0].y;
+					for (uint16_m p = 1; p < rglyph->num_points; ++p) {
+						// x min/max
+						if (rglyph->points[p].x < prog->x_min) {
+							prog->x_min = rglyph->points[p].x;
+						}
+						if (rglyph->points[p].x > prog->x_max) {
+							prog->x_max = rglyph->points[p].x;
+						}
+						// y min/max
+						if (rglyph->points[p].y < prog->y_min) {
+							prog->y_min = rglyph->points[p].y;
+						}
+						if (rglyph->points[p].y > prog->y_max) {
+							prog->y_max = rglyph->points[p].y;
+						}
+					}
 
-				// Left-side bearing + Advance width
-				if (glyph_id >= font->hhea->number_of_hmetrics) {
-					// lsb is in lsb array:
-					rglyph->lsb = mutt_funits_to_punits(font, font->hmtx->left_side_bearings[glyph_id - font->hhea->number_of_hmetrics], point_size, ppi);
-					// Advance width is last advance width
-					if (font->hhea->number_of_hmetrics > 0) {
-						rglyph->advance_width = mutt_funits_to_punits(font, font->hmtx->hmetrics[font->hhea->number_of_hmetrics - 1].advance_width, point_size, ppi);
-					} else {
-						// Defaulting on 0 for advance width with no hmetrics specified
-						rglyph->advance_width = 0;
+					// Ensure FUnit range
+					if (prog->x_min < -16384.f || prog->x_min > 16383.f ||
+						prog->x_max < -16384.f || prog->x_max > 16383.f) {
+						return MUTT_INVALID_GLYF_COMPOSITE_X_COORD_FUNITS;
 					}
-				} else {
-					// lsb is in hmetrics array:
-					rglyph->lsb = mutt_funits_to_punits(font, font->hmtx->hmetrics[glyph_id].lsb, point_size, ppi);
-					// As well as advance width:
-					rglyph->advance_width = mutt_funits_to_punits(font, font->hmtx->hmetrics[glyph_id].advance_width, point_size, ppi);
+					if (prog->y_min < -16384.f || prog->y_min > 16383.f ||
+						prog->y_max < -16384.f || prog->y_max > 16383.f) {
+						return MUTT_INVALID_GLYF_COMPOSITE_Y_COORD_FUNITS;
+					}
+
+					// Finish here if conversion to pixel-units is not being performed
+					if (!convert_to_punits) {
+						return MUTT_SUCCESS;
+					}
+
+					mutt_CompositePUnits(font, rglyph->points, rglyph, prog->x_min, prog->y_min, prog->x_max, prog->y_max, point_size, ppi);
+					return MUTT_SUCCESS;
 				}
-			}
 
-			/* Simple */
+				// Resolves every component of a composite glyph into an rglyph with points
+				// in FUnits, using data (of size mutt_composite_rglyph_max), with the x/y
+				// min/max of the points calculated in prog
+				// (scratch is mutt_composite_scratch_max bytes, or 0 to allocate it here)
+				muttResult mutt_CompositeResolve(muttFont* font, muttCompositeGlyph* glyph, muttRGlyph* rglyph, muByte* data, muttR_CompProg* prog, muByte* scratch) {
+					muttResult res = MUTT_SUCCESS;
 
-				// Simple glyph -> raster glyph
-				MUDEF muttResult mutt_simple_rglyph(muttFont* font, muttGlyphHeader* header, muttSimpleGlyph* glyph, muttRGlyph* rglyph, float point_size, float ppi, muByte* data, uint32_m* written) {
-					// For written calculations:
-					if (!data) {
-						uint32_m write = 0;
-						// points
-						write += sizeof(muttRPoint) * (glyph->end_pts_of_contours[header->number_of_contours-1] + 1);
-						// contour_ends
-						write += sizeof(uint16_m) * header->number_of_contours;
-						// Write data needed
-						*written = write;
-						return MUTT_SUCCESS;
+					// Allocate scratch memory
+					// This cannot be allocated within font, as it could lead to
+					// very unpredictable multi-threaded behavior
+					muByte* comp_scratch = scratch;
+					if (!comp_scratch) {
+						comp_scratch = (muByte*)mu_malloc(mutt_composite_scratch_max(font));
+						if (!comp_scratch) {
+							return MUTT_FAILED_MALLOC;
+						}
 					}
 
-					// Get data for arrays
-					muByte* orig_data = data;
-					// - points
-					rglyph->num_points = glyph->end_pts_of_contours[header->number_of_contours-1] + 1;
-					rglyph->points = (muttRPoint*)data;
-					data += sizeof(muttRPoint) * ((uint32_m)rglyph->num_points);
-					// - contour_ends
-					rglyph->num_contours = header->number_of_contours;
+					// Set rglyph data
 					rglyph->contour_ends = (uint16_m*)data;
-					data += sizeof(uint16_m) * ((uint32_m)rglyph->num_contours);
-					// Write written data amount
-					if (written) {
-						*written = data-orig_data;
-					}
+					rglyph->points = (muttRPoint*)((data + (((uint32_m)font->maxp->max_composite_contours)*2)));
 
-					// Calculate point offsets based on glyph's min/max values
-					float px = -mutt_funits_to_punits(font, header->x_min, point_size, ppi) + 1.f;
-					float py = -mutt_funits_to_punits(font, header->y_min, point_size, ppi) + 1.f;
+					// Initialize CompProg
+					muttR_CompProg_init(prog, rglyph, comp_scratch, font);
 
-					// Loop through each point
-					for (uint16_m p = 0; p < rglyph->num_points; ++p) {
-						// X and Y
-						rglyph->points[p].x = px + mutt_funits_to_punits(font, glyph->points[p].x, point_size, ppi);
-						rglyph->points[p].y = py + mutt_funits_to_punits(font, glyph->points[p].y, point_size, ppi);
-						// Flags
-						rglyph->points[p].flags = (glyph->points[p].flags & MUTT_ON_CURVE_POINT) ?(MUTTR_ON_CURVE) :(0);
+					// Loop through each component
+					for (uint16_m c = 0; c < glyph->component_count; ++c) {
+						// Process component
+						res = mutt_component_rglyph(font, prog, &glyph->components[c]);
+						if (mutt_result_is_fatal(res)) {
+							break;
+						}
 					}
 
-					// Copy over contour ends
-					mu_memcpy(rglyph->contour_ends, glyph->end_pts_of_contours, sizeof(uint16_m) * ((uint32_m)rglyph->num_contours));
+					// Calculate x/y min/max of the collected TrueType coordinates
+					if (!mutt_result_is_fatal(res)) {
+						res = mutt_composite_rglyph_coords(font, prog, rglyph, 0.f, 0.f, MU_FALSE);
+					}
 
-					// Caclculate x_max and y_max
-					rglyph->x_max = px + mutt_funits_to_punits(font, header->x_max, point_size, ppi);
-					rglyph->y_max = py + mutt_funits_to_punits(font, header->y_max, point_size, ppi);
+					// Free scratch memory
+					if (!scratch) {
+						mu_free(comp_scratch);
+					}
+					return res;
+				}
 
-					return MUTT_SUCCESS;
+				// Composite glyph -> raster glyph, with scratch memory
+				MUDEF muttResult mutt_composite_rglyph_scratch(muttFont* font, muttGlyphHeader* header, muttCompositeGlyph* glyph, muttRGlyph* rglyph, float point_size, float ppi, muByte* data, muByte* scratch) {
+					// Resolve components into TrueType coordinates
+					muttR_CompProg prog;
+					muttResult res = mutt_CompositeResolve(font, glyph, rglyph, data, &prog, scratch);
+					if (mutt_result_is_fatal(res)) {
+						return res;
+					}
+
+					// Convert collected TrueType coordinates to pixel coordinates
+					mutt_CompositePUnits(font, rglyph->points, rglyph, prog.x_min, prog.y_min, prog.x_max, prog.y_max, point_size, ppi);
+					return res; if (header) {}
 				}
 
-				// Memory maximum
-				MUDEF uint32_m mutt_simple_rglyph_max(muttFont* font) {
-					return
-						// points
-						(sizeof(muttRPoint) * font->maxp->max_points)
-						// contour_ends
-						+ (sizeof(uint16_m) * font->maxp->max_contours)
-					;
+				// Composite glyph -> raster glyph
+				// NO mem req abilities unfortunately
+				MUDEF muttResult mutt_composite_rglyph(muttFont* font, muttGlyphHeader* header, muttCompositeGlyph* glyph, muttRGlyph* rglyph, float point_size, float ppi, muByte* data) {
+					return mutt_composite_rglyph_scratch(font, header, glyph, rglyph, point_size, ppi, data, 0);
 				}
 
-			/* Composite */
+				// Deepest composite glyph nesting that mutt_CompositeBounds handles itself
+				#define MUTT_BOUNDS_MAX_DEPTH 8
 
-				// Used to pass data between function calls within composite glyph processing
-				struct muttR_CompProg {
-					// Progressives (move up between rglyphs):
-					uint32_m num_contours;
-					uint32_m num_points;
-					uint16_m* contour_ends;
-					muttRPoint* points;
-					float x_min;
-					float y_min;
-					float x_max;
-					float y_max;
-					// Actual rglyph being filled in:
-					muttRGlyph* rglyph;
-					// Temp simple glyph mem:
-					muByte* temp_simple_max;
-					// Max values:
-					uint16_m max_contours;
-					uint16_m max_points;
+				// A composite glyph whose bounds are being calculated by mutt_CompositeBounds
+				struct muttBoundsFrame {
+					// Component referring to this glyph
+					muttComponentGlyph comp;
+					// Header of this glyph and progress through its components
+					muttGlyphHeader header;
+					muByte* bprog;
+					muBool no_more;
+					uint32_m component_count;
+					// x/y min/max of this glyph's points (before comp's transformation)
+					muBool has_points;
+					float min[2];
+					float max[2];
 				};
-				typedef struct muttR_CompProg muttR_CompProg;
-
-				// Initializes a CompProg struct
-				void muttR_CompProg_init(muttR_CompProg* prog, muttRGlyph* rglyph, muByte* temp_simple_max, muttFont* font) {
-					// Set numerical progressives to 0
-					prog->num_contours = 0;
-					prog->num_points = 0;
-					prog->x_min = 0.f;
-					prog->y_min = 0.f;
-					prog->x_max = 0.f;
-					prog->y_max = 0.f;
-					// Set initial progressive pointers
-					prog->contour_ends = rglyph->contour_ends;
-					prog->points = rglyph->points;
-					// Rglyph
-					prog->rglyph = rglyph;
-					rglyph->num_points = 0;
-					rglyph->num_contours = 0;
-					// Temp simple max
-					prog->temp_simple_max = temp_simple_max;
-					// Max values
-					prog->max_contours = font->maxp->max_composite_contours;
-					prog->max_points = font->maxp->max_composite_points;
-				}
+				typedef struct muttBoundsFrame muttBoundsFrame;
 
-				// Converts simple glyph component to rglyph within the CompProg
-				// Glyph must have at least 1 contour
-				// This process gives the raw TrueType coordinates in float form;
-				// point and PPI are accounted for afterwards to separate that
-				// logic from the point alignment and such.
-				muttResult mutt_composite_simple_rglyph(muttR_CompProg* prog, muttGlyphHeader* header, muttSimpleGlyph* glyph, muttComponentGlyph* comp) {
-					// Account for number of contours
-					prog->num_contours += header->number_of_contours;
-					if (prog->num_contours > prog->max_contours) {
-						return MUTT_INVALID_RGLYPH_COMPOSITE_CONTOUR_COUNT;
-					}
-					// Account for number of points
-					prog->num_points += glyph->end_pts_of_contours[header->number_of_contours-1]+1;
-					if (prog->num_points > prog->max_points) {
-						return MUTT_INVALID_RGLYPH_COMPOSITE_POINT_COUNT;
+				// Gets the offset of an axis-aligned component with no point matching,
+				// giving if it is one
+				// (This code is considerably similar to mutt_ComponentTransform)
+				muBool mutt_ComponentAxisAligned(muttComponentGlyph* comp, float* scale, float* offset) {
+					// Point matching needs the actual points
+					if (!(comp->flags & MUTT_ARGS_ARE_XY_VALUES)) {
+						return MU_FALSE;
 					}
-					uint16_m num_points = glyph->end_pts_of_contours[header->number_of_contours-1]+1;
 
 					// Calculate scales
 					float xscale=1.f, scale01=0.f, scale10=0.f, yscale=1.f;
-
 					if (comp->flags & MUTT_WE_HAVE_A_SCALE) {
-						// One scale applied to x and y
 						xscale = yscale = comp->scales[0];
 					}
 					else if (comp->flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE) {
-						// Individual x and y scale
 						xscale = comp->scales[0];
 						yscale = comp->scales[1];
 					}
 					else if (comp->flags & MUTT_WE_HAVE_A_TWO_BY_TWO) {
-						// Full 2x2 affine transformation
 						xscale  = comp->scales[0];
 						scale01 = comp->scales[1];
 						scale10 = comp->scales[2];
 						yscale  = comp->scales[3];
+						if (scale01 != 0.f || scale10 != 0.f) {
+							return MU_FALSE;
+						}
 					}
 
+					// Calculate offsets
+					float argument1 = comp->argument1;
+					float argument2 = comp->argument2;
+					if (comp->flags & MUTT_SCALED_COMPONENT_OFFSET) {
+						float n_argument1 = (xscale  * argument1) + (scale10 * argument2);
+						float n_argument2 = (scale01 * argument1) + (yscale  * argument2);
+						argument1 = n_argument1;
+						argument2 = n_argument2;
+						if (comp->flags & MUTT_ROUND_XY_TO_GRID) {
+							argument1 = mu_roundf(argument1);
+							argument2 = mu_roundf(argument2);
+						}
+					}
 
-					// Calculate argument1 & argument2 offsets
-					float argument1, argument2;
-					if (comp->flags & MUTT_ARGS_ARE_XY_VALUES) {
-						// Just read the offsets
-						argument1 = comp->argument1;
-						argument2 = comp->argument2;
-						// Possible scaling:
-						if (comp->flags & MUTT_SCALED_COMPONENT_OFFSET) {
-							float n_argument1 = (xscale  * argument1) + (scale10 * argument2);
-							float n_argument2 = (scale01 * argument1) + (yscale  * argument2);
-							argument1 = n_argument1;
-							argument2 = n_argument2;
-							// Possible rounding:
-							if (comp->flags & MUTT_ROUND_XY_TO_GRID) {
-								argument1 = mu_roundf(argument1);
-								argument2 = mu_roundf(argument2);
-							}
+					scale[0] = xscale;
+					scale[1] = yscale;
+					offset[0] = argument1;
+					offset[1] = argument2;
+					return MU_TRUE;
+				}
+
+				// Transforms x/y min/max by an axis-aligned component's scale and offset,
+				// merging it into the x/y min/max of the glyph that the component is in
+				// (Rounding is monotonic, so the transformed min/max is the same as the
+				// min/max of the transformed points)
+				void mutt_BoundsMerge(muttBoundsFrame* parent, float* scale, float* offset, float* min, float* max) {
+					for (uint8_m a = 0; a < 2; ++a) {
+						float lo = (scale[a] * min[a]) + offset[a];
+						float hi = (scale[a] * max[a]) + offset[a];
+						if (scale[a] < 0.f) {
+							float t = lo;
+							lo = hi;
+							hi = t;
+						}
+						if (!parent->has_points || lo < parent->min[a]) {
+							parent->min[a] = lo;
+						}
+						if (!parent->has_points || hi > parent->max[a]) {
+							parent->max[a] = hi;
 						}
 					}
-					else {
-						// argument1 is parent (prog->rglyph) point number
-						// argument2 is child (glyph) point number
-						// Offset should align these two points
+					parent->has_points = MU_TRUE;
+				}
 
-						// NOTE: phantom points can be used in this process, but
-						// mutt v1.0.0 doesn't have support for gvar (which, as
-						// far as I can tell, is needed to process the phantom
-						// points); composite glyphs that depend on phantom
-						// points will, for now, render incorrectly or possibly
-						// not render successfully at all.
+				// Calculates the x/y min/max of a composite glyph from the x/y min/max of its
+				// components, without resolving any points, if every component (at every
+				// depth) is axis-aligned and placed without point matching; "handled" is set
+				// to false if it isn't, in which case the components need to be resolved
+				// (Same checks and results as mutt_composite_glyph_min_max_scratch)
+				muttResult mutt_CompositeBounds(muttFont* font, muttGlyphHeader* header, muBool* handled) {
+					muttResult res = MUTT_SUCCESS;
+					*handled = MU_FALSE;
+
+					// Start with the glyph itself (with no transformation)
+					muttBoundsFrame frames[MUTT_BOUNDS_MAX_DEPTH];
+					uint32_m num_frames = 1;
+					frames[0].header = *header;
+					frames[0].bprog = header->data;
+					frames[0].no_more = MU_FALSE;
+					frames[0].component_count = 0;
+					frames[0].has_points = MU_FALSE;
+					uint32_m num_contours = 0, num_points = 0;
+
+					while (num_frames != 0) {
+						muttBoundsFrame* frame = &frames[num_frames-1];
+						float scale[2], offset[2];
+
+						// Every component is processed; transform this glyph's min/max and pop it
+						if (frame->no_more) {
+							if (--num_frames == 0) {
+								break;
+							}
+							if (frame->has_points) {
+								mutt_ComponentAxisAligned(&frame->comp, scale, offset);
+								mutt_BoundsMerge(&frames[num_frames-1], scale, offset, frame->min, frame->max);
+							}
+							continue;
+						}
 
-						// - Parent point -
-						// Ensure point number is in range
-						if (comp->argument1 >= prog->rglyph->num_points) {
-							return MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_ARGUMENT1;
+						// Verify incremented component count
+						if (++frame->component_count > font->maxp->max_component_elements) {
+							return MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_COUNT;
 						}
-						// Get parent x and y
-						float parent_x = prog->rglyph->points[comp->argument1].x;
-						float parent_y = prog->rglyph->points[comp->argument1].y;
 
-						// - Child point -
-						// Ensure point number is in range
-						if (comp->argument2 >= num_points) {
-							return MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_ARGUMENT2;
+						// Get next component
+						muttComponentGlyph comp;
+						res = mutt_composite_component(font, &frame->header, &frame->bprog, &comp, &frame->no_more);
+						if (mutt_result_is_fatal(res)) {
+							return res;
+						}
+						if (!mutt_ComponentAxisAligned(&comp, scale, offset)) {
+							return MUTT_SUCCESS;
 						}
-						// Get child x and y
-						float t_child_x = glyph->points[comp->argument2].x;
-						float t_child_y = glyph->points[comp->argument2].y;
-						// Calculate it with scales applied so that point is still
-						// aligned with scales
-						float child_x = (xscale  * t_child_x) + (scale10 * t_child_y);
-						float child_y = (scale01 * t_child_x) + (yscale  * t_child_y);
 
-						// Calcaulte argument1 & argument2 to be offsets that align
-						// the child point to the parent point
-						argument1 = parent_x - child_x;
-						argument2 = parent_y - child_y;
-					}
+						// Get header of glyph index
+						muttGlyphHeader cheader;
+						res = mutt_GlyphHeader(font, comp.glyph_index, &cheader, MU_TRUE);
+						if (mutt_result_is_fatal(res)) {
+							return res;
+						}
 
-					// Loop through each point
-					for (uint16_m p = 0; p < num_points; ++p) {
-						// Calculate scaled point
-						float point_x = glyph->points[p].x;
-						float point_y = glyph->points[p].y;
-						prog->points[p].x = (xscale  * point_x) + (scale10 * point_y);
-						prog->points[p].y = (scale01 * point_x) + (yscale  * point_y);
-						// Add offsets
-						prog->points[p].x += argument1;
-						prog->points[p].y += argument2;
+						// Simple glyph with contours:
+						if (cheader.number_of_contours > 0) {
+							int32_m imin[2], imax[2];
+							uint16_m points;
+							res = mutt_SimpleBounds(font, &cheader, imin, imax, &points);
+							if (mutt_result_is_fatal(res)) {
+								return res;
+							}
+							if (imin[0] < -16384 || imax[0] > 16383) {
+								return MUTT_INVALID_GLYF_SIMPLE_X_COORD_FUNITS;
+							}
+							if (imin[1] < -16384 || imax[1] > 16383) {
+								return MUTT_INVALID_GLYF_SIMPLE_Y_COORD_FUNITS;
+							}
 
-						// Flags of this point
-						prog->points[p].flags = (glyph->points[p].flags & MUTT_ON_CURVE_POINT) ?(MUTTR_ON_CURVE) :(0);
+							// Account for number of contours and points
+							num_contours += cheader.number_of_contours;
+							if (num_contours > font->maxp->max_composite_contours) {
+								return MUTT_INVALID_RGLYPH_COMPOSITE_CONTOUR_COUNT;
+							}
+							num_points += points;
+							if (num_points > font->maxp->max_composite_points) {
+								return MUTT_INVALID_RGLYPH_COMPOSITE_POINT_COUNT;
+							}
+
+							float min[2] = { (float)imin[0], (float)imin[1] };
+							float max[2] = { (float)imax[0], (float)imax[1] };
+							mutt_BoundsMerge(frame, scale, offset, min, max);
+						}
+
+						// Composite glyph:
+						else if (cheader.number_of_contours < 0) {
+							// Verify depth
+							// (The components of the top composite glyph are at depth 1)
+							if (num_frames + 1 > font->maxp->max_component_depth) {
+								return MUTT_INVALID_RGLYPH_COMPOSITE_DEPTH;
+							}
+							// Verify that it isn't already being processed
+							for (uint32_m f = 1; f < num_frames; ++f) {
+								if (frames[f].comp.glyph_index == comp.glyph_index) {
+									return MUTT_INVALID_RGLYPH_COMPOSITE_CYCLE;
+								}
+							}
+							// Resolve deeper nesting than this the usual way
+							if (num_frames == MUTT_BOUNDS_MAX_DEPTH) {
+								return MUTT_SUCCESS;
+							}
+							// Push it
+							muttBoundsFrame* next = &frames[num_frames++];
+							next->comp = comp;
+							next->header = cheader;
+							next->bprog = cheader.data;
+							next->no_more = MU_FALSE;
+							next->component_count = 0;
+							next->has_points = MU_FALSE;
+						}
+					}
+
+					// Resolve glyphs with no points the usual way
+					if (!frames[0].has_points) {
+						return MUTT_SUCCESS;
 					}
-					// Push progressive points pointer
-					prog->points += num_points;
 
-					// Loop through each contour end
-					for (uint16_m c = 0; c < header->number_of_contours; ++c) {
-						// Each contour end is the glyph-relative contour end
-						// with the offset of all the previous points
-						// I'm bad at explaining numbers
-						prog->contour_ends[c] = prog->rglyph->num_points + glyph->end_pts_of_contours[c];
+					// Ensure FUnit range
+					if (frames[0].min[0] < -16384.f || frames[0].min[0] > 16383.f ||
+						frames[0].max[0] < -16384.f || frames[0].max[0] > 16383.f) {
+						return MUTT_INVALID_GLYF_COMPOSITE_X_COORD_FUNITS;
+					}
+					if (frames[0].min[1] < -16384.f || frames[0].min[1] > 16383.f ||
+						frames[0].max[1] < -16384.f || frames[0].max[1] > 16383.f) {
+						return MUTT_INVALID_GLYF_COMPOSITE_Y_COORD_FUNITS;
 					}
-					// Push progressive contour ends pointer
-					prog->contour_ends += header->number_of_contours;
 
-					// Add to rglyph
-					prog->rglyph->num_points += num_points;
-					prog->rglyph->num_contours += header->number_of_contours;
+					// Set x/y min/max values
+					header->x_min = mu_ceilf(frames[0].min[0]);
+					header->y_min = mu_ceilf(frames[0].min[1]);
+					header->x_max = mu_ceilf(frames[0].max[0]);
+					header->y_max = mu_ceilf(frames[0].max[1]);
+					*handled = MU_TRUE;
 					return MUTT_SUCCESS;
 				}
 
-				// Processes composite component for CompProg
-				muttResult mutt_component_rglyph(muttFont* font, muttR_CompProg* prog, muttComponentGlyph* comp, uint32_m depth) {
+				// X/Y min/max composite calculator that resolves every component's points,
+				// fully loading each simple glyph
+				muttResult mutt_CompositeMinMaxResolve(muttFont* font, muttGlyphHeader* header, muByte* data, muByte* scratch) {
 					muttResult res = MUTT_SUCCESS;
 
-					// Store point stuff BEFORE all points for this component are processed
-					uint16_m prev_num_points = prog->num_points;
-					muttRPoint* prev_points = prog->points;
+					// Much of this code is considerably similar to mutt_composite_rglyph
 
-					// Get header of glyph index
-					muttGlyphHeader header;
-					res = mutt_glyph_header(font, comp->glyph_index, &header);
-					if (mutt_result_is_fatal(res)) {
-						return res;
-					}
+					// Set rglyph data
+					muttRGlyph rglyph;
+					rglyph.contour_ends = (uint16_m*)data;
+					rglyph.points = (muttRPoint*)((data + (((uint32_m)font->maxp->max_composite_contours)*2)));
 
-					// Simple glyph with contours:
-					if (header.number_of_contours > 0) {
-						// Get simple glyph
-						muttSimpleGlyph glyph;
-						res = mutt_simple_glyph(font, &header, &glyph, prog->temp_simple_max, 0);
+					// Initialize CompProg
+					muttR_CompProg prog;
+					muttR_CompProg_init(&prog, &rglyph, scratch, font);
+
+					// Loop through each component
+					uint32_m component_count = 0;
+					muBool no_more = MU_FALSE;
+					muByte* bprog = header->data;
+					while (!no_more) {
+						// Verify incremented component count
+						if (++component_count > font->maxp->max_component_elements) {
+							return MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_COUNT;
+						}
+
+						// Get individual component
+						muttComponentGlyph this_component;
+						res = mutt_composite_component(font, header, &bprog, &this_component, &no_more);
 						if (mutt_result_is_fatal(res)) {
 							return res;
 						}
 
-						// Process simple glyph
-						res = mutt_composite_simple_rglyph(prog, &header, &glyph, comp);
+						// Process component
+						res = mutt_component_rglyph(font, &prog, &this_component);
 						if (mutt_result_is_fatal(res)) {
 							return res;
 						}
+					}
 
+					// Calculate x/y min/max
+					res = mutt_composite_rglyph_coords(font, &prog, &rglyph, 0.f, 0.f, MU_FALSE);
+					if (mutt_result_is_fatal(res)) {
 						return res;
 					}
 
-					// Simple glyph with no contours:
-					else if (header.number_of_contours == 0) {
-						// Do nothing for this guy
+					// Set x/y min/max values
+					header->x_min = mu_ceilf(prog.x_min);
+					header->y_min = mu_ceilf(prog.y_min);
+					header->x_max = mu_ceilf(prog.x_max);
+					header->y_max = mu_ceilf(prog.y_max);
+					return res;
+				}
+
+				// X/Y min/max composite calculator, with caller memory
+				MUDEF muttResult mutt_composite_glyph_min_max_scratch(muttFont* font, muttGlyphHeader* header, muByte* data, muByte* scratch) {
+					// Calculate from component bounds if possible
+					muBool handled;
+					muttResult res = mutt_CompositeBounds(font, header, &handled);
+					if (handled || mutt_result_is_fatal(res)) {
 						return res;
 					}
+					return mutt_CompositeMinMaxResolve(font, header, data, scratch);
+				}
 
-					// Composite glyph
-					else {
-						// Increment depth tracker
-						if (++depth > font->maxp->max_component_depth) {
-							return MUTT_INVALID_RGLYPH_COMPOSITE_DEPTH;
-						}
+				// X/Y min/max composite calculator
+				MUDEF muttResult mutt_composite_glyph_min_max(muttFont* font, muttGlyphHeader* header) {
+					// Calculate from component bounds if possible (needing no memory)
+					muBool handled;
+					muttResult res = mutt_CompositeBounds(font, header, &handled);
+					if (handled || mutt_result_is_fatal(res)) {
+						return res;
+					}
 
-						// Loop through each component
-						uint32_m component_count = 0;
-						muBool no_more = MU_FALSE;
-						muByte* bprog = header.data;
-						while (!no_more) {
-							// Verify incremented component count
-							if (++component_count > font->maxp->max_component_elements) {
-								return MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_COUNT;
-							}
+					// Allocate composite and scratch memory at once
+					uint32_m composite_size = MUTT_TABLE_ALIGN_UP(mutt_composite_rglyph_max(font));
+					muByte* composite_mem = (muByte*)mu_malloc(composite_size + mutt_composite_scratch_max(font));
+					if (!composite_mem) {
+						return MUTT_FAILED_MALLOC;
+					}
 
-							// Get individual component
-							muttComponentGlyph this_component;
-							res = mutt_composite_component(font, &header, &bprog, &this_component, &no_more);
-							if (mutt_result_is_fatal(res)) {
-								return res;
-							}
-							// Process component with this current function
-							// (Scary recursion)
-							res = mutt_component_rglyph(font, prog, &this_component, depth);
-							if (mutt_result_is_fatal(res)) {
-								return res;
-							}
+					res = mutt_CompositeMinMaxResolve(font, header, composite_mem, composite_mem + composite_size);
+					mu_free(composite_mem);
+					return res;
+				}
+
+				// Scratch memory maximum
+				MUDEF uint32_m mutt_composite_scratch_max(muttFont* font) {
+					return
+						// temp simple glyph memory
+						MUTT_TABLE_ALIGN_UP(mutt_simple_glyph_max_size(font))
+						// stack of composite glyphs
+						+ (sizeof(muttR_CompFrame) * font->maxp->max_component_depth)
+					;
+				}
+
+				// Memory maximum
+				MUDEF uint32_m mutt_composite_rglyph_max(muttFont* font) {
+					return
+						// contour_ends
+						(sizeof(uint16_m) * font->maxp->max_composite_contours)
+						// points
+						+ (sizeof(muttRPoint) * font->maxp->max_composite_points)
+					;
+				}
+
+				// Moves the contour ends and points of an rglyph converted from a composite
+				// glyph to dst, with the points right after the contour ends (rather than
+				// after room for the max amount of contours), returning the size it now takes
+				// (dst must be aligned, and not be after the rglyph's memory)
+				uint32_m mutt_RGlyphPack(muttRGlyph* rglyph, muByte* dst) {
+					// Move contour ends
+					uint32_m contours_size = sizeof(uint16_m) * ((uint32_m)rglyph->num_contours);
+					mu_memmove(dst, rglyph->contour_ends, contours_size);
+					rglyph->contour_ends = (uint16_m*)dst;
+
+					// Move points (aligned)
+					contours_size = (uint32_m)MUTT_ARENA_ALIGN_UP(contours_size);
+					mu_memmove(dst + contours_size, rglyph->points, sizeof(muttRPoint) * ((uint32_m)rglyph->num_points));
+					rglyph->points = (muttRPoint*)(dst + contours_size);
+
+					return contours_size + (sizeof(muttRPoint) * ((uint32_m)rglyph->num_points));
+				}
+
+				// Composite glyph -> raster glyph, with memory from an arena
+				MUDEF muttResult mutt_composite_rglyph_arena(muttFont* font, muttGlyphHeader* header, muttCompositeGlyph* glyph, muttRGlyph* rglyph, float point_size, float ppi, muttArena* arena) {
+					// Allocate max rglyph memory and scratch memory
+					uint64_m mark = mutt_arena_mark(arena);
+					uint32_m rglyph_size = MUTT_TABLE_ALIGN_UP(mutt_composite_rglyph_max(font));
+					muByte* data = (muByte*)mutt_arena_alloc(arena, rglyph_size + mutt_composite_scratch_max(font));
+					if (!data) {
+						return MUTT_FAILED_ARENA;
+					}
+
+					// Convert
+					muttResult res = mutt_composite_rglyph_scratch(font, header, glyph, rglyph, point_size, ppi, data, data + rglyph_size);
+					if (mutt_result_is_fatal(res)) {
+						mutt_arena_reset(arena, mark);
+						return res;
+					}
+
+					// Let go of everything but the exact rglyph memory
+					mutt_arena_reset(arena, mark);
+					mutt_arena_alloc(arena, mutt_RGlyphPack(rglyph, data));
+					return res;
+				}
+
+			/* Header */
 
+				// Decodes the x- and y-coordinates of each point of a simple glyph based on
+				// their raw flags, storing them as floats (still in FUnits) in the rglyph's
+				// points, and giving their min/max
+				// (This is mutt_DecodeCoords for rglyph points, with both axes decoded in the
+				// same loop and each delta selected without branching while 2 bytes can be
+				// read before end, as the kind of each coordinate is rather unpredictable)
+				void mutt_DecodeRPoints(muByte* xdata, muByte* ydata, muByte* end, muttRPoint* points, uint16_m num_points, int32_m* min, int32_m* max) {
+					int32_m x = 0, y = 0;
+					int32_m x_lo = 16383, x_hi = -16384, y_lo = 16383, y_hi = -16384;
+
+					for (uint16_m pi = 0; pi < num_points; ++pi) {
+						uint8_m flags = points[pi].flags;
+						int32_m x_short = (flags >> 1) & 1, x_same = (flags >> 4) & 1;
+						int32_m y_short = (flags >> 2) & 1, y_same = (flags >> 5) & 1;
+
+						// Add deltas to running coordinates
+						// (x-coordinates come before the y-coordinates, so only the latter
+						// need checking)
+						if (ydata + 1 < end) {
+							x += mutt_CoordDelta(&xdata, x_short, x_same);
+							y += mutt_CoordDelta(&ydata, y_short, y_same);
+						} else {
+							x += mutt_CoordDeltaSafe(&xdata, x_short, x_same);
+							y += mutt_CoordDeltaSafe(&ydata, y_short, y_same);
 						}
+
+						// Track min/max and store
+						x_lo = (x < x_lo) ?(x) :(x_lo);
+						x_hi = (x > x_hi) ?(x) :(x_hi);
+						y_lo = (y < y_lo) ?(y) :(y_lo);
+						y_hi = (y > y_hi) ?(y) :(y_hi);
+						points[pi].x = (float)x;
+						points[pi].y = (float)y;
 					}
 
-					// This code is considerably similar to mutt_composite_simple_rglyph
+					// Give 0s for no points
+					if (num_points == 0) {
+						x_lo = x_hi = y_lo = y_hi = 0;
+					}
+					min[0] = x_lo; max[0] = x_hi;
+					min[1] = y_lo; max[1] = y_hi;
+				}
 
-					// Calculate this component's values
-					uint16_m num_points = prog->num_points - prev_num_points;
+				// Converts the points of a simple glyph decoded into an rglyph (in FUnits) to
+				// pixel units, giving the x/y max of the rglyph
+				// (Same order of operations as mutt_funits_to_punits so that the result is
+				// the same as mutt_simple_rglyph's)
+				void mutt_RPointsToPUnits(muttFont* font, muttRGlyph* rglyph, int32_m x_min, int32_m y_min, int32_m x_max, int32_m y_max, float point_size, float ppi) {
+					float units = 72.f * font->head->units_per_em;
+					float px = -mutt_funits_to_punits(font, x_min, point_size, ppi) + 1.f;
+					float py = -mutt_funits_to_punits(font, y_min, point_size, ppi) + 1.f;
+					muttRPoint* rpoints = rglyph->points;
+					for (uint16_m p = 0; p < rglyph->num_points; ++p) {
+						rpoints[p].x = px + (point_size * rpoints[p].x * ppi / units);
+						rpoints[p].y = py + (point_size * rpoints[p].y * ppi / units);
+						rpoints[p].flags = (rpoints[p].flags & MUTT_ON_CURVE_POINT) ?(MUTTR_ON_CURVE) :(0);
+					}
 
-					// Calculate scales
-					float xscale=1.f, scale01=0.f, scale10=0.f, yscale=1.f;
+					// Calculate x_max and y_max
+					rglyph->x_max = px + mutt_funits_to_punits(font, x_max, point_size, ppi);
+					rglyph->y_max = py + mutt_funits_to_punits(font, y_max, point_size, ppi);
+				}
 
-					if (comp->flags & MUTT_WE_HAVE_A_SCALE) {
-						// One scale applied to x and y
-						xscale = yscale = comp->scales[0];
+				// Simple glyph header -> raster glyph, without verifying anything (for
+				// trusted fonts)
+				muttResult mutt_TrustedSimpleHeaderRGlyph(muttFont* font, muttGlyphHeader* header, muttRGlyph* rglyph, float point_size, float ppi, muByte* data, uint32_m* written) {
+					muByte* gdata = header->data;
+
+					// Get point count from last element of endPtsOfContours
+					uint16_m points = 0;
+					if (header->number_of_contours != 0) {
+						points = MU_RBEU16(gdata + (((uint32_m)(header->number_of_contours-1)) * 2)) + 1;
 					}
-					else if (comp->flags & MUTT_WE_HAVE_AN_X_AND_Y_SCALE) {
-						// Individual x and y scale
-						xscale = comp->scales[0];
-						yscale = comp->scales[1];
+
+					// Memory size calculation:
+					if (!data) {
+						*written = (sizeof(muttRPoint) * ((uint32_m)points)) + (sizeof(uint16_m) * ((uint32_m)header->number_of_contours));
+						return MUTT_SUCCESS;
 					}
-					else if (comp->flags & MUTT_WE_HAVE_A_TWO_BY_TWO) {
-						// Full 2x2 affine transformation
-						xscale  = comp->scales[0];
-						scale01 = comp->scales[1];
-						scale10 = comp->scales[2];
-						yscale  = comp->scales[3];
+
+					// Get data for arrays
+					muByte* orig_data = data;
+					rglyph->num_points = points;
+					rglyph->points = (muttRPoint*)data;
+					data += sizeof(muttRPoint) * ((uint32_m)points);
+					rglyph->num_contours = header->number_of_contours;
+					rglyph->contour_ends = (uint16_m*)data;
+					data += sizeof(uint16_m) * ((uint32_m)header->number_of_contours);
+
+					// Copy endPtsOfContours straight into contour_ends
+					for (uint16_m c = 0; c < header->number_of_contours; ++c) {
+						rglyph->contour_ends[c] = MU_RBEU16(gdata);
+						gdata += 2;
 					}
 
-					// Calculate argument1 and argument2 offsets
-					float argument1, argument2;
-					if (comp->flags & MUTT_ARGS_ARE_XY_VALUES) {
-						// Just read the offsets
-						argument1 = comp->argument1;
-						argument2 = comp->argument2;
-						// Possible scaling:
-						if (comp->flags & MUTT_SCALED_COMPONENT_OFFSET) {
-							float n_argument1 = (xscale  * argument1) + (scale10 * argument2);
-							float n_argument2 = (scale01 * argument1) + (yscale  * argument2);
-							argument1 = n_argument1;
-							argument2 = n_argument2;
-							// Possible rounding:
-							if (comp->flags & MUTT_ROUND_XY_TO_GRID) {
-								argument1 = mu_roundf(argument1);
-								argument2 = mu_roundf(argument2);
-							}
-						}
+					// Skip past instructions
+					gdata += 2 + MU_RBEU16(gdata);
+
+					// Decode flags and coordinates
+					uint32_m x_length;
+					gdata = mutt_TrustedFlags(gdata, &rglyph->points[0].flags, sizeof(muttRPoint), points, &x_length);
+					int32_m min[2], max[2];
+					mutt_DecodeRPoints(gdata, gdata + x_length, header->data + header->length, rglyph->points, points, min, max);
+
+					// Convert to pixel units
+					header->x_min = min[0];
+					header->y_min = min[1];
+					header->x_max = max[0];
+					header->y_max = max[1];
+					mutt_RPointsToPUnits(font, rglyph, min[0], min[1], max[0], max[1], point_size, ppi);
+
+					if (written) {
+						*written = data-orig_data;
 					}
-					else {
-						// argument1 is parent (rglyph->points, prev_num_points)
-						// argument2 is child (prev_points, num_points)
+					return MUTT_SUCCESS;
+				}
 
-						// - Parent point -
-						// Ensure point range
-						if (comp->argument1 >= prev_num_points) {
-							return MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_ARGUMENT1;
-						}
-						// Get parent x and y
-						float parent_x = prog->rglyph->points[comp->argument1].x;
-						float parent_y = prog->rglyph->points[comp->argument1].y;
+				// Simple glyph header -> raster glyph
+				MUDEF muttResult mutt_simple_header_rglyph(muttFont* font, muttGlyphHeader* header, muttRGlyph* rglyph, float point_size, float ppi, muByte* data, uint32_m* written) {
+					// Decode trusted glyphs without verifying anything
+					// (Glyphs with no data still go through the checks, which reject them)
+					if (mutt_HeaderTrusted(font, header)) {
+						return mutt_TrustedSimpleHeaderRGlyph(font, header, rglyph, point_size, ppi, data, written);
+					}
 
-						// - Child point -
-						// Ensure point range
-						if (comp->argument2 >= num_points) {
-							return MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_ARGUMENT2;
+					// Verify length for endPtsOfContours and instructionLength
+					// (req is u64 to avoid possible overflow)
+					uint64_m req = (((uint32_m)header->number_of_contours)*2) + 2;
+					if (header->length < req) {
+						return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+					}
+
+					// Glyph data:
+					muByte* gdata = header->data;
+
+					// Get point count from last element of endPtsOfContours
+					uint16_m points = 0;
+					if (header->number_of_contours != 0) {
+						points = MU_RBEU16(gdata + (((uint32_m)(header->number_of_contours-1)) * 2));
+						// Verify last element
+						if (points == 0xFFFF) {
+							return MUTT_INVALID_GLYF_SIMPLE_END_PTS_OF_CONTOURS;
 						}
-						// Get child x and y
-						float t_child_x = prev_points[comp->argument2].x;
-						float t_child_y = prev_points[comp->argument2].y;
-						// Calculate it with scales applied so that point is still
-						// aligned with scales
-						float child_x = (xscale  * t_child_x) + (scale10 * t_child_y);
-						float child_y = (scale01 * t_child_x) + (yscale  * t_child_y);
+						++points;
+					}
+					// Verify point count
+					if (points > font->maxp->max_points) {
+						return MUTT_INVALID_GLYF_SIMPLE_POINT_COUNT;
+					}
 
-						// Calculate argument1 & argument2 to be offsets that align
-						// the child point to the parent point
-						argument1 = parent_x - child_x;
-						argument2 = parent_y - child_y;
+					// Memory size calculation:
+					if (!data) {
+						*written = (sizeof(muttRPoint) * ((uint32_m)points)) + (sizeof(uint16_m) * ((uint32_m)header->number_of_contours));
+						return MUTT_SUCCESS;
 					}
 
-					// Loop through each point
-					for (uint16_m p = 0; p < num_points; ++p) {
-						// Calculate scaled point
-						float point_x = prev_points[p].x;
-						float point_y = prev_points[p].y;
-						prev_points[p].x = (xscale  * point_x) + (scale10 * point_y);
-						prev_points[p].y = (scale01 * point_x) + (yscale  * point_y);
-						// Add offsets
-						prev_points[p].x += argument1;
-						prev_points[p].y += argument2;
+					// Get data for arrays
+					// (Same layout as mutt_simple_rglyph)
+					muByte* orig_data = data;
+					// - points
+					rglyph->num_points = points;
+					rglyph->points = (muttRPoint*)data;
+					data += sizeof(muttRPoint) * ((uint32_m)points);
+					// - contour_ends
+					rglyph->num_contours = header->number_of_contours;
+					rglyph->contour_ends = (uint16_m*)data;
+					data += sizeof(uint16_m) * ((uint32_m)header->number_of_contours);
+
+					// Copy endPtsOfContours straight into contour_ends
+					for (uint16_m c = 0; c < header->number_of_contours; ++c) {
+						rglyph->contour_ends[c] = MU_RBEU16(gdata);
+						// Verify increasing order
+						if (c != 0 && rglyph->contour_ends[c] <= rglyph->contour_ends[c-1]) {
+							return MUTT_INVALID_GLYF_SIMPLE_END_PTS_OF_CONTOURS;
+						}
+						gdata += 2;
+					}
+
+					// instructionLength
+					uint16_m instruction_length = MU_RBEU16(gdata);
+					gdata += 2;
+					// + Verify instructionLength
+					if (instruction_length > font->maxp->max_size_of_instructions) {
+						return MUTT_INVALID_GLYF_SIMPLE_INSTRUCTION_LENGTH;
 					}
+					// Skip past instructions
+					req += instruction_length;
+					if (header->length < req) {
+						return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+					}
+					gdata += instruction_length;
 
-					return res;
-				}
-
-				// Converts all TrueType-calculated coordinates from a composite-converted rglyph
-				// to pixel coordinates
-				// OR, if convert_to_punits is false, it just calculates the x/y min/max within
-				// prog
-				muttResult mutt_composite_rglyph_coords(muttFont* font, muttR_CompProg* prog, muttRGlyph* rglyph, float point_size, float ppi, muBool convert_to_punits) {
-					// Calculate x/y min/max values
-					prog->x_min = prog->x_max = rglyph->points[0].x;
-					prog->y_min = prog->y_max = rglyph->points[0].y;
-					for (uint16_m p = 1; p < rglyph->num_points; ++p) {
-						// x min/max
-						if (rglyph->points[p].x < prog->x_min) {
-							prog->x_min = rglyph->points[p].x;
-						}
-						if (rglyph->points[p].x > prog->x_max) {
-							prog->x_max = rglyph->points[p].x;
+					// Decode raw flags into the points, filling each repeat run at once, and sum
+					// up how many bytes the x- and y-coordinates take
+					uint16_m pi = 0; // (point index)
+					uint32_m x_length = 0, coord_length = 0;
+					while (pi < points) {
+						// Verify length for this flag
+						if (header->length < ++req) {
+							return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
 						}
-						// y min/max
-						if (rglyph->points[p].y < prog->y_min) {
-							prog->y_min = rglyph->points[p].y;
+						uint8_m flags = *gdata++;
+
+						// Get amount of points with this flag
+						uint32_m run = 1;
+						if (flags & MUTT_REPEAT_FLAG) {
+							// Verify length for repeat count
+							if (header->length < ++req) {
+								return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
+							}
+							run += *gdata++;
+							// Cut off repeats past the point count
+							if (run > (uint32_m)(points-pi)) {
+								run = points-pi;
+							}
 						}
-						if (rglyph->points[p].y > prog->y_max) {
-							prog->y_max = rglyph->points[p].y;
+
+						// Fill flags
+						muttRPoint* point = rglyph->points + pi;
+						for (uint32_m r = 0; r < run; ++r) {
+							point[r].flags = flags;
 						}
+						pi += run;
+						x_length += run * mutt_XCoordLength(flags);
+						coord_length += run * mutt_CoordLength(flags);
 					}
 
-					// Ensure FUnit range
-					if (prog->x_min < -16384.f || prog->x_min > 16383.f ||
-						prog->x_max < -16384.f || prog->x_max > 16383.f) {
-						return MUTT_INVALID_GLYF_COMPOSITE_X_COORD_FUNITS;
-					}
-					if (prog->y_min < -16384.f || prog->y_min > 16383.f ||
-						prog->y_max < -16384.f || prog->y_max > 16383.f) {
-						return MUTT_INVALID_GLYF_COMPOSITE_Y_COORD_FUNITS;
+					// Verify length for every coordinate at once
+					req += coord_length;
+					if (header->length < req) {
+						return MUTT_INVALID_GLYF_SIMPLE_LENGTH;
 					}
 
-					// Finish here if conversion to pixel-units is not being performed
-					if (!convert_to_punits) {
-						return MUTT_SUCCESS;
+					// Decode x- and y-coordinates
+					// (The end of the glyph's data is given, past which nothing can be read)
+					int32_m min[2], max[2];
+					mutt_DecodeRPoints(gdata, gdata + x_length, header->data + header->length, rglyph->points, points, min, max);
+					int32_m x_min = min[0], x_max = max[0];
+					int32_m y_min = min[1], y_max = max[1];
+					// - Verify that they're within FUnit range
+					if (x_min < -16384 || x_max > 16383) {
+						return MUTT_INVALID_GLYF_SIMPLE_X_COORD_FUNITS;
 					}
-
-					// Much of this code is considerably similar to mutt_simple_rglyph
-
-					// Calculate point offsets based on glyph's min/max values
-					float px = -mutt_funits_to_punits(font, prog->x_min, point_size, ppi) + 1.f;
-					float py = -mutt_funits_to_punits(font, prog->y_min, point_size, ppi) + 1.f;
-
-					// Loop through each point
-					for (uint16_m p = 0; p < rglyph->num_points; ++p) {
-						// X and Y
-						rglyph->points[p].x = px + mutt_funits_to_punits(font, rglyph->points[p].x, point_size, ppi);
-						rglyph->points[p].y = py + mutt_funits_to_punits(font, rglyph->points[p].y, point_size, ppi);
+					if (y_min < -16384 || y_max > 16383) {
+						return MUTT_INVALID_GLYF_SIMPLE_Y_COORD_FUNITS;
 					}
 
-					// Calculate x/y max
-					rglyph->x_max = px + mutt_funits_to_punits(font, prog->x_max, point_size, ppi);
-					rglyph->y_max = py + mutt_funits_to_punits(font, prog->y_max, point_size, ppi);
+					// Write calculated x/y min/max values
+					header->x_min = x_min;
+					header->y_min = y_min;
+					header->x_max = x_max;
+					header->y_max = y_max;
+					// Convert points to pixel units while they're still in cache
+					mutt_RPointsToPUnits(font, rglyph, x_min, y_min, x_max, y_max, point_size, ppi);
 
+					// Write written data amount
+					if (written) {
+						*written = data-orig_data;
+					}
 					return MUTT_SUCCESS;
 				}
 
-				// Composite glyph -> raster glyph
-				// NO mem req abilities unfortunately
-				MUDEF muttResult mutt_composite_rglyph(muttFont* font, muttGlyphHeader* header, muttCompositeGlyph* glyph, muttRGlyph* rglyph, float point_size, float ppi, muByte* data) {
+				// Glyph header -> raster glyph
+				MUDEF muttResult mutt_header_rglyph(muttFont* font, muttGlyphHeader* header, muttRGlyph* rglyph, float point_size, float ppi, muByte* data, uint32_m* written) {
 					muttResult res = MUTT_SUCCESS;
+					uint32_m write0 = 0, write1 = 0;
 
-					// Allocate temp simple max memory
-					// This cannot be allocated within font, as it could lead to
-					// very unpredictable multi-threaded behavior
-					muByte* temp_simple_max = (muByte*)mu_malloc(mutt_simple_glyph_max_size(font));
-					if (!temp_simple_max) {
-						return MUTT_FAILED_MALLOC;
+					// Simple:
+					// (Decoded straight into the rglyph)
+					if (header->number_of_contours >= 0) {
+						return mutt_simple_header_rglyph(font, header, rglyph, point_size, ppi, data, written);
 					}
 
-					// Set rglyph data
-					rglyph->contour_ends = (uint16_m*)data;
-					rglyph->points = (muttRPoint*)((data + (((uint32_m)font->maxp->max_composite_contours)*2)));
-
-					// Initialize CompProg
-					muttR_CompProg prog;
-					muttR_CompProg_init(&prog, rglyph, temp_simple_max, font);
-
-					// Loop through each component
-					for (uint16_m c = 0; c < glyph->component_count; ++c) {
-						// Process component
-						res = mutt_component_rglyph(font, &prog, &glyph->components[c], 1);
+					// Just memory calculations:
+					if (!data) {
+						// Glyph data:
+						res = mutt_composite_glyph(font, header, 0, 0, &write0);
 						if (mutt_result_is_fatal(res)) {
-							mu_free(temp_simple_max);
 							return res;
 						}
+						// Rglyph data:
+						write1 = mutt_composite_rglyph_max(font);
+
+						// Write sum of memory needed
+						*written = write0 + write1;
+						return res;
 					}
 
-					// Convert collected TrueType coordinates to pixel coordinates
-					res = mutt_composite_rglyph_coords(font, &prog, rglyph, point_size, ppi, MU_TRUE);
+					// Composite:
+					// - Load composite glyph
+					muttCompositeGlyph glyph;
+					res = mutt_composite_glyph(font, header, &glyph, data, &write0);
 					if (mutt_result_is_fatal(res)) {
-						mu_free(temp_simple_max);
 						return res;
 					}
+					data += write0;
 
-					// Free temp simple max memory
-					mu_free(temp_simple_max);
-					return res; if (header) {}
+					// - Convert to rglyph
+					res = mutt_composite_rglyph(font, header, &glyph, rglyph, point_size, ppi, data);
+					if (mutt_result_is_fatal(res)) {
+						return res;
+					}
+					write1 = mutt_composite_rglyph_max(font);
+
+					// Write written
+					if (written) {
+						*written = write0 + write1;
+					}
+					return res;
 				}
 
-				// X/Y min/max composite calculator
-				MUDEF muttResult mutt_composite_glyph_min_max(muttFont* font, muttGlyphHeader* header) {
+				// Glyph header -> raster glyph, with memory from an arena
+				MUDEF muttResult mutt_header_rglyph_arena(muttFont* font, muttGlyphHeader* header, muttRGlyph* rglyph, float point_size, float ppi, muttArena* arena) {
 					muttResult res = MUTT_SUCCESS;
+					uint64_m mark = mutt_arena_mark(arena);
 
-					// Unfortunately, there's no realistic way to do this without
-					// doing the usual allocation as far as I'm aware.
+					// Simple:
+					if (header->number_of_contours >= 0) {
+						// Calculate exact memory needed
+						uint32_m size;
+						res = mutt_simple_header_rglyph(font, header, rglyph, point_size, ppi, 0, &size);
+						if (mutt_result_is_fatal(res)) {
+							return res;
+						}
 
-					// Much of this code is considerably similar to mutt_composite_rglyph
+						// Allocate it
+						muByte* data = (muByte*)mutt_arena_alloc(arena, size);
+						if (!data) {
+							return MUTT_FAILED_ARENA;
+						}
 
-					// Allocate composite memory
-					muByte* composite_mem = (muByte*)mu_malloc(mutt_composite_rglyph_max(font));
-					if (!composite_mem) {
-						return MUTT_FAILED_MALLOC;
+						// Convert straight to rglyph
+						res = mutt_simple_header_rglyph(font, header, rglyph, point_size, ppi, data, 0);
+						if (mutt_result_is_fatal(res)) {
+							mutt_arena_reset(arena, mark);
+						}
+						return res;
 					}
-					// Allocate temp simple max memory
-					muByte* temp_simple_max = (muByte*)mu_malloc(mutt_simple_glyph_max_size(font));
-					if (!temp_simple_max) {
-						mu_free(composite_mem);
-						return MUTT_FAILED_MALLOC;
+
+					// Composite:
+					// - Load composite glyph
+					muttCompositeGlyph glyph;
+					res = mutt_composite_glyph_arena(font, header, &glyph, arena);
+					if (mutt_result_is_fatal(res)) {
+						return res;
 					}
 
-					// Set rglyph data
-					muttRGlyph rglyph;
-					rglyph.contour_ends = (uint16_m*)composite_mem;
-					rglyph.points = (muttRPoint*)((composite_mem + (((uint32_m)font->maxp->max_composite_contours)*2)));
+					// - Convert to rglyph after it
+					muttResult rres = mutt_composite_rglyph_arena(font, header, &glyph, rglyph, point_size, ppi, arena);
+					if (mutt_result_is_fatal(rres)) {
+						mutt_arena_reset(arena, mark);
+						return rres;
+					}
 
-					// Initialize CompProg
+					// - Move the rglyph to where the glyph was, letting go of the glyph
+					mutt_arena_reset(arena, mark);
+					muByte* dst = (muByte*)mutt_arena_alloc(arena, 0);
+					mutt_arena_alloc(arena, mutt_RGlyphPack(rglyph, dst));
+					return res;
+				}
+
+				// Gets the flattened outline of a composite glyph from the cache, resolving and
+				// caching it if it's not there; resolving uses "data", which must be
+				// mutt_header_rglyph_max bytes
+				// The outline must be let go of with mutt_OutlineRelease
+				muttResult mutt_FlatAcquire(muttFont* font, uint16_m glyph_id, muttGlyphHeader* header, muByte* data, muttOutline** outline) {
+					// Give cached outline if it exists
+					muttOutline* cached = mutt_OutlineFind(font->outlines, glyph_id);
+					if (cached) {
+						*outline = cached;
+						return cached->result;
+					}
+
+					// Load composite glyph
+					muttCompositeGlyph glyph;
+					uint32_m write0;
+					muttResult res = mutt_composite_glyph(font, header, &glyph, data, &write0);
+					if (mutt_result_is_fatal(res)) {
+						return res;
+					}
+
+					// Resolve it
+					muttRGlyph flat;
 					muttR_CompProg prog;
-					muttR_CompProg_init(&prog, &rglyph, temp_simple_max, font);
+					res = mutt_CompositeResolve(font, &glyph, &flat, data + write0, &prog, 0);
+					if (mutt_result_is_fatal(res)) {
+						return res;
+					}
 
-					// Loop through each component
-					uint32_m component_count = 0;
-					muBool no_more = MU_FALSE;
-					muByte* bprog = header->data;
-					while (!no_more) {
-						// Verify incremented component count
-						if (++component_count > font->maxp->max_component_elements) {
-							return MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_COUNT;
-						}
+					// Allocate outline with contour ends and points after it
+					uint32_m points_size = sizeof(muttRPoint) * ((uint32_m)flat.num_points);
+					uint32_m size = sizeof(muttOutline) + points_size + (sizeof(uint16_m) * ((uint32_m)flat.num_contours));
+					muttOutline* created = (muttOutline*)mu_malloc(size);
+					if (!created) {
+						return MUTT_FAILED_MALLOC;
+					}
 
-						// Get individual component
-						muttComponentGlyph this_component;
-						res = mutt_composite_component(font, header, &bprog, &this_component, &no_more);
-						if (mutt_result_is_fatal(res)) {
-							mu_free(temp_simple_max);
-							mu_free(composite_mem);
+					// Fill it in
+					created->refs = 1;
+					created->size = size;
+					created->glyph_id = glyph_id;
+					created->result = res;
+					created->header = *header;
+					created->num_points = flat.num_points;
+					created->num_contours = flat.num_contours;
+					created->points = (muttRPoint*)(created + 1);
+					created->contour_ends = (uint16_m*)(((muByte*)(created + 1)) + points_size);
+					created->x_min = prog.x_min;
+					created->y_min = prog.y_min;
+					created->x_max = prog.x_max;
+					created->y_max = prog.y_max;
+					mu_memcpy(created->points, flat.points, points_size);
+					mu_memcpy(created->contour_ends, flat.contour_ends, sizeof(uint16_m) * ((uint32_m)flat.num_contours));
+
+					*outline = mutt_OutlineInsert(font->outlines, created);
+					return (*outline)->result;
+				}
+
+				// Glyph ID -> raster glyph
+				MUDEF muttResult mutt_glyph_rglyph(muttFont* font, uint16_m glyph_id, muttRGlyph* rglyph, float point_size, float ppi, muByte* data, uint32_m* written) {
+					// Get header
+					muttGlyphHeader header;
+					muttResult res = mutt_GlyphHeader(font, glyph_id, &header, MU_FALSE);
+					if (mutt_result_is_fatal(res)) {
+						return res;
+					}
+
+					// Convert by header if there's no cached outline to use
+					if (!font->outlines || header.number_of_contours == 0) {
+						return mutt_header_rglyph(font, &header, rglyph, point_size, ppi, data, written);
+					}
+
+					// Memory size calculation:
+					if (!data) {
+						res = mutt_header_rglyph(font, &header, rglyph, point_size, ppi, data, written);
+						if (mutt_result_is_fatal(res) || header.number_of_contours < 0) {
 							return res;
 						}
+						// A simple glyph that isn't cached yet is first decoded into
+						// data (see mutt_OutlineAcquire), which can need more memory
+						// than the rglyph itself
+						uint32_m glyph_size;
+						muttGlyphHeader validated = header;
+						muttResult glyph_res = mutt_simple_glyph(font, &validated, 0, 0, &glyph_size);
+						if (mutt_result_is_fatal(glyph_res)) {
+							return glyph_res;
+						}
+						if (glyph_size > *written) {
+							*written = glyph_size;
+						}
+						return res;
+					}
 
-						// Process component
-						res = mutt_component_rglyph(font, &prog, &this_component, 1);
+					// Composite:
+					if (header.number_of_contours < 0) {
+						// Get flattened outline from cache
+						muttOutline* outline;
+						res = mutt_FlatAcquire(font, glyph_id, &header, data, &outline);
 						if (mutt_result_is_fatal(res)) {
-							mu_free(temp_simple_max);
-							mu_free(composite_mem);
 							return res;
 						}
+
+						// Copy contour ends and convert points
+						rglyph->num_points = outline->num_points;
+						rglyph->num_contours = outline->num_contours;
+						rglyph->points = (muttRPoint*)data;
+						rglyph->contour_ends = (uint16_m*)(data + (sizeof(muttRPoint) * ((uint32_m)outline->num_points)));
+						mu_memcpy(rglyph->contour_ends, outline->contour_ends, sizeof(uint16_m) * ((uint32_m)outline->num_contours));
+						mutt_CompositePUnits(font, outline->points, rglyph, outline->x_min, outline->y_min, outline->x_max, outline->y_max, point_size, ppi);
+						mutt_OutlineRelease(font, outline);
+
+						if (written) {
+							*written = mutt_composite_rglyph_max(font);
+						}
+						return res;
 					}
 
-					// Calculate x/y min/max
-					res = mutt_composite_rglyph_coords(font, &prog, &rglyph, 0.f, 0.f, MU_FALSE);
+					// Get outline from cache
+					// (data is only used to decode it if it isn't cached)
+					muttOutline* outline;
+					res = mutt_OutlineAcquire(font, glyph_id, &header, data, &outline);
 					if (mutt_result_is_fatal(res)) {
-						mu_free(temp_simple_max);
-						mu_free(composite_mem);
 						return res;
 					}
 
-					// Set x/y min/max values
-					header->x_min = mu_ceilf(prog.x_min);
-					header->y_min = mu_ceilf(prog.y_min);
-					header->x_max = mu_ceilf(prog.x_max);
-					header->y_max = mu_ceilf(prog.y_max);
-
-					// Free and return
-					mu_free(temp_simple_max);
-					mu_free(composite_mem);
+					// Convert to rglyph
+					res = mutt_simple_rglyph(font, &outline->header, &outline->glyph, rglyph, point_size, ppi, data, written);
+					mutt_OutlineRelease(font, outline);
 					return res;
 				}
 
-				// Memory maximum
-				MUDEF uint32_m mutt_composite_rglyph_max(muttFont* font) {
-					return
-						// contour_ends
-						(sizeof(uint16_m) * font->maxp->max_composite_contours)
-						// points
-						+ (sizeof(muttRPoint) * font->maxp->max_composite_points)
-					;
-				}
-
-			/* Header */
-
-				// Glyph header -> raster glyph
-				MUDEF muttResult mutt_header_rglyph(muttFont* font, muttGlyphHeader* header, muttRGlyph* rglyph, float point_size, float ppi, muByte* data, uint32_m* written) {
-					muttResult res = MUTT_SUCCESS;
-					uint32_m write0 = 0, write1 = 0;
-
-					// Just memory calculations:
-					if (!data) {
-						// Simple:
-						if (header->number_of_contours >= 0) {
-							// Glyph data:
-							res = mutt_simple_glyph(font, header, 0, 0, &write0);
-							if (mutt_result_is_fatal(res)) {
-								return res;
-							}
-							// Rglyph data:
-							res = mutt_simple_rglyph(font, header, 0, 0, point_size, ppi, 0, &write1);
-							if (mutt_result_is_fatal(res)) {
-								return res;
-							}
-						}
-						// Composite:
-						else {
-							// Glyph data:
-							res = mutt_composite_glyph(font, header, 0, 0, &write0);
-							if (mutt_result_is_fatal(res)) {
-								return res;
-							}
-							// Rglyph data:
-							write1 = mutt_composite_rglyph_max(font);
-						}
+				// Decodes one glyph into an outline with memory from arena, using scratch
+				// memory for decoding the glyph and temp memory for processing components
+				muttResult mutt_DecodeOutline(muttFont* font, uint16_m glyph_id, muttArena* arena, muByte* scratch, muByte* temp, muttGlyphOutline* outline) {
+					// Get header
+					muttGlyphHeader header;
+					muttResult res = mutt_GlyphHeader(font, glyph_id, &header, MU_FALSE);
+					if (mutt_result_is_fatal(res)) {
+						return res;
+					}
 
-						// Write sum of memory needed
-						*written = write0 + write1;
+					// No outline:
+					if (header.number_of_contours == 0) {
+						mu_memset(outline, 0, sizeof(muttGlyphOutline));
 						return res;
 					}
 
 					// Simple:
-					if (header->number_of_contours >= 0) {
-						// Load simple glyph
+					if (header.number_of_contours > 0) {
+						// Decode
 						muttSimpleGlyph glyph;
-						res = mutt_simple_glyph(font, header, &glyph, data, &write0);
+						res = mutt_simple_glyph(font, &header, &glyph, scratch, 0);
 						if (mutt_result_is_fatal(res)) {
 							return res;
 						}
-						data += write0;
-
-						// Convert to rglyph
-						res = mutt_simple_rglyph(font, header, &glyph, rglyph, point_size, ppi, data, &write1);
-						if (mutt_result_is_fatal(res)) {
-							return res;
+						outline->num_contours = header.number_of_contours;
+						outline->num_points = glyph.end_pts_of_contours[outline->num_contours-1] + 1;
+
+						// Allocate
+						outline->points = (muttRPoint*)mutt_arena_alloc(arena, sizeof(muttRPoint) * ((uint64_m)outline->num_points));
+						outline->contour_ends = (uint16_m*)mutt_arena_alloc(arena, sizeof(uint16_m) * ((uint64_m)outline->num_contours));
+						if (!outline->points || !outline->contour_ends) {
+							return MUTT_FAILED_ARENA;
 						}
 
-						//data += write1;
+						// Fill in points, contour ends, and x/y min/max
+						for (uint16_m p = 0; p < outline->num_points; ++p) {
+							outline->points[p].x = glyph.points[p].x;
+							outline->points[p].y = glyph.points[p].y;
+							outline->points[p].flags = (glyph.points[p].flags & MUTT_ON_CURVE_POINT) ?(MUTTR_ON_CURVE) :(0);
+						}
+						mu_memcpy(outline->contour_ends, glyph.end_pts_of_contours, sizeof(uint16_m) * ((uint32_m)outline->num_contours));
+						outline->x_min = header.x_min;
+						outline->y_min = header.y_min;
+						outline->x_max = header.x_max;
+						outline->y_max = header.y_max;
+						return res;
 					}
+
 					// Composite:
-					else {
-						// Load composite glyph
-						muttCompositeGlyph glyph;
-						res = mutt_composite_glyph(font, header, &glyph, data, &write0);
-						if (mutt_result_is_fatal(res)) {
-							return res;
-						}
-						data += write0;
+					// - Load composite glyph
+					muttCompositeGlyph glyph;
+					uint32_m write0;
+					res = mutt_composite_glyph(font, &header, &glyph, scratch, &write0);
+					if (mutt_result_is_fatal(res)) {
+						return res;
+					}
+					// - Resolve it
+					muttRGlyph flat;
+					muttR_CompProg prog;
+					res = mutt_CompositeResolve(font, &glyph, &flat, scratch + write0, &prog, temp);
+					if (mutt_result_is_fatal(res)) {
+						return res;
+					}
+					outline->num_points = flat.num_points;
+					outline->num_contours = flat.num_contours;
 
-						// Convert to rglyph
-						res = mutt_composite_rglyph(font, header, &glyph, rglyph, point_size, ppi, data);
-						if (mutt_result_is_fatal(res)) {
-							return res;
+					// - Allocate
+					outline->points = (muttRPoint*)mutt_arena_alloc(arena, sizeof(muttRPoint) * ((uint64_m)outline->num_points));
+					outline->contour_ends = (uint16_m*)mutt_arena_alloc(arena, sizeof(uint16_m) * ((uint64_m)outline->num_contours));
+					if (!outline->points || !outline->contour_ends) {
+						return MUTT_FAILED_ARENA;
+					}
+
+					// - Copy points, contour ends, and x/y min/max
+					mu_memcpy(outline->points, flat.points, sizeof(muttRPoint) * ((uint32_m)outline->num_points));
+					mu_memcpy(outline->contour_ends, flat.contour_ends, sizeof(uint16_m) * ((uint32_m)outline->num_contours));
+					outline->x_min = prog.x_min;
+					outline->y_min = prog.y_min;
+					outline->x_max = prog.x_max;
+					outline->y_max = prog.y_max;
+					return res;
+				}
+
+				MUDEF muttResult mutt_glyphs_decode(muttFont* font, uint16_m* glyph_ids, uint32_m count, muttArena* arena, muttGlyphOutline* outlines) {
+					if (count == 0) {
+						return MUTT_SUCCESS;
+					}
+
+					// Allocate memory for the whole batch: glyph order, decoding scratch, and
+					// component processing scratch
+					// (Decoding scratch fits rather a simple glyph or a composite glyph with its rglyph)
+					uint32_m scratch_size = mutt_composite_glyph_max_size(font) + mutt_composite_rglyph_max(font);
+					if (mutt_simple_glyph_max_size(font) > scratch_size) {
+						scratch_size = mutt_simple_glyph_max_size(font);
+					}
+					scratch_size = MUTT_TABLE_ALIGN_UP(scratch_size);
+					uint64_m* order = (uint64_m*)mu_malloc((sizeof(uint64_m) * ((size_m)count)) + scratch_size + mutt_composite_scratch_max(font));
+					if (!order) {
+						return MUTT_FAILED_MALLOC;
+					}
+					muByte* scratch = (muByte*)(order + count);
+					muByte* temp = scratch + scratch_size;
+
+					// Sort glyphs by offset in glyf
+					// (Offset in upper 32 bits, index in lower 32 bits)
+					for (uint32_m i = 0; i < count; ++i) {
+						order[i] = (((uint64_m)mutt_loca_offset(font, glyph_ids[i])) << 32) | i;
+					}
+					mutt_SortKeys(order, count);
+
+					// Decode each glyph in that order
+					for (uint32_m i = 0; i < count; ++i) {
+						uint32_m index = (uint32_m)(order[i] & 0xFFFFFFFF);
+						muttGlyphOutline* outline = &outlines[index];
+						// (Arena is reset for glyphs that failed so nothing is left allocated)
+						uint64_m mark = mutt_arena_mark(arena);
+						outline->result = mutt_DecodeOutline(font, glyph_ids[index], arena, scratch, temp, outline);
+						if (mutt_result_is_fatal(outline->result)) {
+							mutt_arena_reset(arena, mark);
 						}
-						write1 = mutt_composite_rglyph_max(font);
-						//data += write1;
 					}
 
-					// Write written
+					mu_free(order);
+					return MUTT_SUCCESS;
+				}
+
+				MUDEF void mutt_glyph_outline_rglyph(muttFont* font, muttGlyphOutline* outline, muttRGlyph* rglyph, float point_size, float ppi, muByte* data, uint32_m* written) {
+					// Memory needed for points and contour ends
+					uint32_m points_size = sizeof(muttRPoint) * ((uint32_m)outline->num_points);
+					uint32_m size = points_size + (sizeof(uint16_m) * ((uint32_m)outline->num_contours));
+					if (!data) {
+						*written = size;
+						return;
+					}
+
+					// Copy contour ends and convert points
+					rglyph->num_points = outline->num_points;
+					rglyph->num_contours = outline->num_contours;
+					rglyph->points = (muttRPoint*)data;
+					rglyph->contour_ends = (uint16_m*)(data + points_size);
+					mu_memcpy(rglyph->contour_ends, outline->contour_ends, sizeof(uint16_m) * ((uint32_m)outline->num_contours));
+					mutt_CompositePUnits(font, outline->points, rglyph, outline->x_min, outline->y_min, outline->x_max, outline->y_max, point_size, ppi);
+
 					if (written) {
-						*written = write0 + write1;
+						*written = size;
 					}
-					return res;
 				}
 
 				// Glyph header x/y min/max -> raster x/y max
@@ -7262,6 +12080,10 @@ mutt is developed primarily off of these sources of documentation:
 				case MUTT_FAILED_MALLOC: return "MUTT_FAILED_MALLOC"; break;
 				case MUTT_FAILED_REALLOC: return "MUTT_FAILED_REALLOC"; break;
 				case MUTT_FAILED_FIND_TABLE: return "MUTT_FAILED_FIND_TABLE"; break;
+				case MUTT_FAILED_OPEN_FILE: return "MUTT_FAILED_OPEN_FILE"; break;
+				case MUTT_FAILED_MAP_FILE: return "MUTT_FAILED_MAP_FILE"; break;
+				case MUTT_FAILED_READ: return "MUTT_FAILED_READ"; break;
+				case MUTT_FAILED_ARENA: return "MUTT_FAILED_ARENA"; break;
 				case MUTT_INVALID_DIRECTORY_LENGTH: return "MUTT_INVALID_DIRECTORY_LENGTH"; break;
 				case MUTT_INVALID_DIRECTORY_SFNT_VERSION: return "MUTT_INVALID_DIRECTORY_SFNT_VERSION"; break;
 				case MUTT_INVALID_DIRECTORY_NUM_TABLES: return "MUTT_INVALID_DIRECTORY_NUM_TABLES"; break;
@@ -7349,6 +12171,19 @@ mutt is developed primarily off of these sources of documentation:
 				case MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_COUNT: return "MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_COUNT"; break;
 				case MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_ARGUMENT1: return "MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_ARGUMENT1"; break;
 				case MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_ARGUMENT2: return "MUTT_INVALID_RGLYPH_COMPOSITE_COMPONENT_ARGUMENT2"; break;
+				case MUTT_INVALID_RGLYPH_COMPOSITE_CYCLE: return "MUTT_INVALID_RGLYPH_COMPOSITE_CYCLE"; break;
+				case MUTT_INVALID_COLLECTION_LENGTH: return "MUTT_INVALID_COLLECTION_LENGTH"; break;
+				case MUTT_INVALID_COLLECTION_TAG: return "MUTT_INVALID_COLLECTION_TAG"; break;
+				case MUTT_INVALID_COLLECTION_VERSION: return "MUTT_INVALID_COLLECTION_VERSION"; break;
+				case MUTT_INVALID_COLLECTION_NUM_FONTS: return "MUTT_INVALID_COLLECTION_NUM_FONTS"; break;
+				case MUTT_INVALID_COLLECTION_TABLE_DIRECTORY_OFFSET: return "MUTT_INVALID_COLLECTION_TABLE_DIRECTORY_OFFSET"; break;
+				case MUTT_INVALID_COLLECTION_FACE_INDEX: return "MUTT_INVALID_COLLECTION_FACE_INDEX"; break;
+				case MUTT_INVALID_CACHE_LENGTH: return "MUTT_INVALID_CACHE_LENGTH"; break;
+				case MUTT_INVALID_CACHE_MAGIC: return "MUTT_INVALID_CACHE_MAGIC"; break;
+				case MUTT_INVALID_CACHE_VERSION: return "MUTT_INVALID_CACHE_VERSION"; break;
+				case MUTT_INVALID_CACHE_FONT: return "MUTT_INVALID_CACHE_FONT"; break;
+				case MUTT_CACHE_REQUIRES_DATA: return "MUTT_CACHE_REQUIRES_DATA"; break;
+				case MUTT_INVALID_CACHE_POINTER: return "MUTT_INVALID_CACHE_POINTER"; break;
 			}
 		}
 